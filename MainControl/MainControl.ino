@@ -14,10 +14,12 @@
 // 工具模块
 #include "src/Utilities/Timer.h"
 #include "src/Utilities/MathUtils.h"
+#include "src/Utilities/SnapshotBuffer.h"
 
 // 功能模块
 #include "src/Sensors/SensorManager.h"
 #include "src/Sensors/SensorFusion.h"
+#include "src/Sensors/DriftMonitor.h"
 #include "src/Control/ControlSystem.h"
 #include "src/Model/DigitalTwin.h"
 #include "src/Learning/LearningSystem.h"
@@ -25,6 +27,7 @@
 #include "src/Communication/SerialMonitor.h"
 // ========== 在原有包含后添加 ==========
 #include "src/Communication/WiFiComm.h"
+#include "src/Communication/CaptureStreamer.h"
 
 // ========== 全局对象实例 ==========
 SystemStateManager stateManager;
@@ -33,6 +36,9 @@ TimerManager timerManager;
 // 传感器模块
 SensorManager sensorManager;
 SensorFusion sensorFusion;
+#if SENSOR_DRIFT_MONITOR
+DriftMonitor driftMonitor;
+#endif
 
 // 控制模块
 ControlSystem controlSystem;
@@ -51,17 +57,34 @@ SerialMonitor serialMonitor;
 // WiFi通信模块
 WiFiComm wifiComm;
 
-// 定时器
-Timer sensorTimer(SAMPLING_INTERVAL);
+// 突发采集诊断输出
+enum CaptureTarget : uint8_t {
+  CAPTURE_TARGET_NONE = 0,
+  CAPTURE_TARGET_SERIAL,
+  CAPTURE_TARGET_WIFI
+};
+
+CaptureStreamer captureStreamer;
+CaptureTarget captureTarget = CAPTURE_TARGET_NONE;
+
+// 定时器（传感器按通道各自的周期由 SensorManager 调度）
 Timer controlTimer(CONTROL_INTERVAL);
 Timer learningTimer(LEARNING_INTERVAL);
 Timer displayTimer(5000);  // 5秒显示更新
 
 // 全局数据
-SensorData currentSensors;
+// 传感器样本经融合与能耗计算后整体发布，各处理阶段以常引用读取同一份快照
+SnapshotBuffer<SensorData> sensorSnapshot;
 DigitalTwinData currentTwin;
 ControlDecision currentDecision;
 
+#if EMERGENCY_FAST_PATH
+// 紧急快速通道：从触发转换完成到执行最大输出的延迟 (us)
+unsigned long emergencyLatency = 0;
+unsigned long emergencyLatencyMax = 0;
+uint16_t emergencyEvents = 0;
+#endif
+
 // ========== 辅助函数声明 ==========
 float calculateEnergyUsage(const SensorData& sensors);
 float calculateSystemEfficiency(const SensorData& sensors);
@@ -72,6 +95,16 @@ void logSystemData();
 void handleSerialCommands();
 void resetSystem();
 void calibrateSensors();
+void acquireSensorData();
+void checkEmergencyWatchdog();
+void serviceDriftMonitor();
+void printDriftStatus();
+void benchmarkPredictiveControl();
+void benchmarkFixedPoint();
+void serviceAutotune();
+void printAutotuneStatus();
+void generateExplicitTable();
+void printTableLine(const String& line);
 
 // ========== 其他状态处理函数 ==========
 void optimizingState();
@@ -84,6 +117,10 @@ void idleState();
 void handleWiFiCommands();
 void sendDataToWiFi();
 
+// ========== 突发采集诊断 ==========
+bool startDiagnosticCapture(uint8_t channel, uint16_t rateHz, uint16_t samples, CaptureTarget target);
+void serviceDiagnosticCapture();
+
 // ========== 系统初始化 ==========
 void setup() {
   // 初始化串口通信
@@ -101,6 +138,7 @@ void setup() {
   
   serialMonitor.printMessage("初始化传感器模块...");
   initSuccess &= sensorManager.initialize();
+  sensorFusion.initialize(sensorManager.getSamplePeriod(1));
   
   serialMonitor.printMessage("初始化控制模块...");
   initSuccess &= controlSystem.initialize();
@@ -136,7 +174,6 @@ void setup() {
   }
   
   serialMonitor.printMessage("初始化定时器...");
-  timerManager.addTimer(&sensorTimer);
   timerManager.addTimer(&controlTimer);
   timerManager.addTimer(&learningTimer);
   timerManager.addTimer(&displayTimer);
@@ -161,6 +198,9 @@ void loop() {
   // 更新定时器
   timerManager.update();
   
+  // 紧急快速通道：上一轮循环之后的超限立即响应
+  checkEmergencyWatchdog();
+  
   // ========== 在loop()中添加 ==========
   // 更新WiFi通信
   wifiComm.update();
@@ -197,39 +237,47 @@ void loop() {
   
   // 处理串口命令
   handleSerialCommands();
+  
+  // 分段输出突发采集数据
+  serviceDiagnosticCapture();
 }
 
 // ========== 运行状态处理 ==========
 void runningState() {
-  // 传感器数据采集
-  if (sensorTimer.check()) {
-    currentSensors = sensorManager.readAllSensors();
+  acquireSensorData();
     
-    // 传感器数据融合
-    currentSensors.pollutionLevel = sensorFusion.fuseSensorData(currentSensors);
-    
-    // 计算能耗和效率
-    currentSensors.energyUsage = calculateEnergyUsage(currentSensors);
-    currentSensors.systemEfficiency = calculateSystemEfficiency(currentSensors);
-  }
+  // 采集中触发紧急状态时本轮不再执行常规控制，避免覆盖最大输出
+  if (stateManager.getCurrentState() != STATE_RUNNING) return;
+  
+  const SensorData& sensors = sensorSnapshot.latest();
   
   // 控制计算
   if (controlTimer.check()) {
-    // 数字孪生仿真
-    currentTwin = digitalTwin.simulate(currentSensors);
+    // 数字孪生仿真：仅在有新样本时重新计算
+    static uint32_t simulatedSequence = 0;
+    if (sensorSnapshot.advance(simulatedSequence)) {
+      currentTwin = digitalTwin.simulate(sensors);
+      controlSystem.setReactorModel(digitalTwin.getSystemModel());
+    }
     
-    // 智能决策
-    currentDecision = makeControlDecision(currentSensors, currentTwin);
+    // 智能决策（控制器按周期运行，无新样本时沿用上一个样本）
+    currentDecision = makeControlDecision(sensors, currentTwin);
     
     // 执行控制
     controlSystem.executeControl(currentDecision.controlOutput);
+    
+    // 自整定结束时报告结果
+    serviceAutotune();
   }
   
   // 学习更新
   if (learningTimer.check()) {
-    learningSystem.performOnlineLearning(currentSensors, currentTwin);
+    learningSystem.performOnlineLearning(sensors, currentTwin);
   }
   
+  // 漂移监测（内部按 DRIFT_UPDATE_INTERVAL 节流）
+  serviceDriftMonitor();
+  
   // 显示更新
   if (displayTimer.check()) {
     displaySystemStatus();
@@ -251,6 +299,337 @@ void runningState() {
   }
 }
 
+// ========== 传感器数据采集 ==========
+void acquireSensorData() {
+  // 各通道按各自周期更新
+  bool updated = sensorManager.update();
+  
+  // 转换在 update() 中启动，紧急监视的结果不等待本批次完成
+  checkEmergencyWatchdog();
+  
+  if (updated) {
+    // 在后缓冲区中组装完整样本，处理完后再发布
+    SensorData& sample = sensorSnapshot.edit();
+    sample = sensorManager.readAllSensors();
+    
+    // 采样周期变化：融合滤波器按污染物通道的新周期换算
+    // 调试输出限制频率：周期频繁变化时逐条打印会占满串口，其间的变化只计数
+    static unsigned long lastRateLog = 0;
+    static uint16_t unloggedRateChanges = 0;
+    SampleRateEvent rateEvent;
+    while (sensorManager.pollSampleRateEvent(rateEvent)) {
+      if (rateEvent.sensorIndex == 1) {
+        sensorFusion.setSamplePeriod(rateEvent.newPeriod);
+      }
+      if (DEBUG_MODE) {
+        if (millis() - lastRateLog >= SAMPLE_RATE_LOG_INTERVAL) {
+          String message = "通道" + String(rateEvent.sensorIndex) + "采样周期: " +
+                           String(rateEvent.previousPeriod) + " -> " + String(rateEvent.newPeriod) + " ms";
+          if (unloggedRateChanges > 0) {
+            message += "（此前另有 " + String(unloggedRateChanges) + " 次变化）";
+          }
+          serialMonitor.printMessage(message);
+          lastRateLog = millis();
+          unloggedRateChanges = 0;
+        } else {
+          unloggedRateChanges++;
+        }
+      }
+    }
+    
+    // 故障通道以回归估计替代，避免异常数据进入数字孪生
+    sensorFusion.compensateFaults(sample);
+    
+    // 传感器数据融合（融合前的测量值保留在 measuredPollution 中）
+    sample.pollutionLevel = sensorFusion.fuseSensorData(sample);
+    
+    // 计算能耗和效率
+    sample.energyUsage = calculateEnergyUsage(sample);
+    sample.systemEfficiency = calculateSystemEfficiency(sample);
+    
+    sensorSnapshot.publish(millis());
+  }
+}
+
+// ========== 漂移监测 ==========
+void serviceDriftMonitor() {
+#if SENSOR_DRIFT_MONITOR
+  const char* const channelNames[5] = { "流量", "污染物", "光照", "pH值", "温度" };
+  
+  if (driftMonitor.update(sensorSnapshot.latest(), sensorFusion, currentTwin, millis())) {
+    uint8_t channel = driftMonitor.getSuspect();
+    const DriftStatus& drift = driftMonitor.getStatus(channel);
+    serialMonitor.printWarning(String(channelNames[channel]) + "传感器漂移 " + String(drift.error, 2) +
+                               "，建议修正: 偏移 " + String(drift.offset, 3) + ", 增益 " + String(drift.gain, 4));
+    
+    if (DRIFT_AUTO_CORRECT) {
+      if (driftMonitor.applyCorrection(channel, sensorManager)) {
+        serialMonitor.printMessage(String(channelNames[channel]) + "校准已自动修正");
+      } else {
+        serialMonitor.printError(String(channelNames[channel]) + "校准修正失败");
+      }
+    } else {
+      serialMonitor.printMessage("使用 'drift apply " + String(channel) + "' 确认修正");
+    }
+  }
+  
+  // 定期记录长期残差统计
+  static unsigned long lastDriftLog = 0;
+  if (millis() - lastDriftLog >= DRIFT_LOG_INTERVAL) {
+    lastDriftLog = millis();
+    for (uint8_t i = 0; i < 5; i++) {
+      dataStorage.logDriftStatus(i, driftMonitor.getStatus(i), lastDriftLog);
+    }
+  }
+#endif
+}
+
+void printDriftStatus() {
+#if SENSOR_DRIFT_MONITOR
+  // 阶段、长期残差与相对基线的漂移估计
+  serialMonitor.printSection("漂移监测");
+  const char* const channelNames[5] = { "流量", "污染物", "光照", "pH值", "温度" };
+  const char* const phaseNames[3] = { "等待模型", "记录基线", "监测" };
+  for (uint8_t i = 0; i < 5; i++) {
+    const DriftStatus& drift = driftMonitor.getStatus(i);
+    String line = String(phaseNames[drift.phase]) + ", 残差 " + String(drift.residualMean, 2) +
+                  " ± " + String(drift.residualRms, 2);
+    if (drift.phase == DRIFT_TRACKING) {
+      line += ", 漂移 " + String(drift.error, 2) + " (增益 " + String(drift.gain, 3) + ")";
+    }
+    if (drift.exceeded) {
+      line += " [超限]";
+    }
+    serialMonitor.printKeyValue(channelNames[i], line);
+  }
+#endif
+}
+
+void benchmarkPredictiveControl() {
+  // 以当前模型的副本测试，不影响正在运行的控制器
+  static const uint16_t horizons[] = { 10, 25, 50, 100, 200, 400 };
+  static const uint8_t SOLVES = 20;
+  
+  serialMonitor.printSection("预测控制求解耗时");
+  float measurement = sensorSnapshot.latest().pollutionLevel;
+  for (uint8_t i = 0; i < sizeof(horizons) / sizeof(horizons[0]); i++) {
+    PredictiveController bench = controlSystem.getPredictiveController();
+    bench.setHorizon(horizons[i]);
+    bench.reset();
+    
+    // 第一次求解包含 Hessian 预计算
+    float output = bench.compute(measurement, TARGET_POLLUTION, 0.0f);
+    unsigned long prepareTime = bench.getLastSolveTime();
+    unsigned long total = 0;
+    for (uint8_t k = 0; k < SOLVES; k++) {
+      output = bench.compute(measurement, TARGET_POLLUTION, output);
+      total += bench.getLastSolveTime();
+    }
+    serialMonitor.printKeyValue("N=" + String(horizons[i]), "预计算 " + String(prepareTime) + " us, 求解 " +
+                                String(total / SOLVES) + " us, 最大 " + String(bench.getMaxSolveTime()) + " us");
+  }
+}
+
+void benchmarkFixedPoint() {
+  // 每种运算重复 REPEAT 次，扣除只读取操作数的空循环；操作数为 volatile，避免编译期折叠
+  // 16 MHz 下 1 us = 16 周期
+  static const uint16_t REPEAT = 1000;
+  volatile float floatA = 123.456f;
+  volatile float floatB = 0.789f;
+  volatile int32_t rawA = Fix16(123.456f).raw();
+  volatile int32_t rawB = Fix16(0.789f).raw();
+  volatile float floatSink;
+  volatile int32_t rawSink;
+  const Fix16 alpha(0.3f);
+  const Fix16Scale scale(0.0625f);
+  
+  serialMonitor.printSection("定点与浮点运算耗时 (周期/次)");
+  unsigned long start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { floatSink = floatA; rawSink = rawA + rawB; }
+  unsigned long baseline = micros() - start;
+  
+  // 各运算依次为：加法、乘法、除法、乘Q8.24系数（只有定点）、滤波一步 y += alpha * (x - y)、
+  // PID一步（与 ControlSystem 相同，输入由 float 换算、输出换算回 float）
+  static const uint8_t OPERATIONS = 6;
+  static const char* const names[OPERATIONS] = { "加法", "乘法", "除法", "乘Q8.24系数", "滤波一步", "PID一步(含换算)" };
+  unsigned long floatTime[OPERATIONS] = { 0 };
+  unsigned long fixedTime[OPERATIONS] = { 0 };
+  
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { floatSink = floatA + floatB; rawSink = rawA; }
+  floatTime[0] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { rawSink = (Fix16::fromRaw(rawA) + Fix16::fromRaw(rawB)).raw(); }
+  fixedTime[0] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { floatSink = floatA * floatB; rawSink = rawA; }
+  floatTime[1] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { rawSink = (Fix16::fromRaw(rawA) * Fix16::fromRaw(rawB)).raw(); }
+  fixedTime[1] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { floatSink = floatA / floatB; rawSink = rawA; }
+  floatTime[2] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { rawSink = (Fix16::fromRaw(rawA) / Fix16::fromRaw(rawB)).raw(); }
+  fixedTime[2] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { rawSink = (Fix16::fromRaw(rawA) * scale).raw(); }
+  fixedTime[3] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) { floatSink = floatA + 0.3f * (floatB - floatA); rawSink = rawA; }
+  floatTime[4] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) {
+    Fix16 y = Fix16::fromRaw(rawA);
+    rawSink = (y + alpha * (Fix16::fromRaw(rawB) - y)).raw();
+  }
+  fixedTime[4] = micros() - start;
+  PIDControllerT<float> floatPid(1.0f, 0.5f, 0.05f);
+  PIDControllerT<Fix16> fixedPid(Fix16(1.0f), Fix16(0.5f), Fix16(0.05f));
+  unsigned long pidTime = 0;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) {
+    pidTime += CONTROL_INTERVAL * 1000UL;
+    floatSink = floatPid.compute(floatA, floatB, pidTime);
+    rawSink = rawA;
+  }
+  floatTime[5] = micros() - start;
+  pidTime = 0;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) {
+    pidTime += CONTROL_INTERVAL * 1000UL;
+    floatSink = toFloat(fixedPid.compute(Fix16(floatA), Fix16(floatB), pidTime));
+  }
+  fixedTime[5] = micros() - start;
+  
+  for (uint8_t i = 0; i < OPERATIONS; i++) {
+    String line = floatTime[i] > 0 ? "float " + String((floatTime[i] - min(floatTime[i], baseline)) * 16UL / REPEAT) + ", "
+                                   : String("float -, ");
+    line += "Fix16 " + String((fixedTime[i] - min(fixedTime[i], baseline)) * 16UL / REPEAT);
+    serialMonitor.printKeyValue(names[i], line);
+  }
+  
+  // 9 个 ADC 样本的窗口：普通平均、截尾和 trimmedSum<9,2>、中值 sortedMedian<9>
+  // 排序原地进行，三者每次都先复制窗口（含一个毛刺），复制的耗时计入结果
+  volatile uint16_t window[9] = { 512, 530, 498, 1023, 505, 520, 491, 515, 509 };
+  uint16_t samples[9];
+  unsigned long filterTime[3];
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) {
+    uint16_t sum = 0;
+    for (uint8_t i = 0; i < 9; i++) { samples[i] = window[i]; sum += samples[i]; }
+    rawSink = sum / 9;
+  }
+  filterTime[0] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) {
+    for (uint8_t i = 0; i < 9; i++) samples[i] = window[i];
+    rawSink = trimmedSum<9, 2>(samples) / 5;
+  }
+  filterTime[1] = micros() - start;
+  start = micros();
+  for (uint16_t k = 0; k < REPEAT; k++) {
+    for (uint8_t i = 0; i < 9; i++) samples[i] = window[i];
+    rawSink = sortedMedian<9>(samples);
+  }
+  filterTime[2] = micros() - start;
+  String line = "均值 " + String((filterTime[0] - min(filterTime[0], baseline)) * 16UL / REPEAT);
+  line += ", 截尾 " + String((filterTime[1] - min(filterTime[1], baseline)) * 16UL / REPEAT);
+  line += ", 中值 " + String((filterTime[2] - min(filterTime[2], baseline)) * 16UL / REPEAT);
+  serialMonitor.printKeyValue("9样本滤波", line);
+  (void)floatSink;
+  (void)rawSink;
+}
+
+void printTableLine(const String& line) {
+  serialMonitor.println(line);
+}
+
+void generateExplicitTable() {
+  // 在线求解器逐点求解，输出的内容保存为 src/Control/ExplicitMpcTable.h（耗时主要在串口输出）；
+  // 主机上可用 test/ 中的 make table 直接生成
+  PredictiveController solver = controlSystem.getPredictiveController();
+  solver.reset();
+  ExplicitController::generateTable(solver, printTableLine);
+}
+
+// ========== PID自整定 ==========
+void serviceAutotune() {
+  // 进行中 -> 完成/中止 的转换只报告一次
+  static RelayAutotuner::State reportedState = RelayAutotuner::AUTOTUNE_IDLE;
+  const RelayAutotuner& autotuner = controlSystem.getAutotuner();
+  RelayAutotuner::State state = autotuner.getState();
+  if (state == reportedState) return;
+  reportedState = state;
+  
+  if (state == RelayAutotuner::AUTOTUNE_DONE) {
+    float Kp, Ki, Kd;
+    controlSystem.getPIDParameters(Kp, Ki, Kd);
+    String result = "自整定完成: Kp=" + String(Kp, 3) + " Ki=" + String(Ki, 4) + " Kd=" + String(Kd, 3);
+    serialMonitor.printMessage(result);
+    wifiComm.sendLogMessage(result);
+  } else if (state == RelayAutotuner::AUTOTUNE_FAILED) {
+    const char* const faultNames[5] = { "无", "已中止", "偏离设定值过大", "超时", "振荡不稳定" };
+    String result = "自整定失败: " + String(faultNames[autotuner.getFault()]);
+    serialMonitor.printWarning(result);
+    wifiComm.sendLogMessage(result);
+  }
+}
+
+void printAutotuneStatus() {
+  const RelayAutotuner& autotuner = controlSystem.getAutotuner();
+  float Kp, Ki, Kd;
+  controlSystem.getPIDParameters(Kp, Ki, Kd);
+  
+  serialMonitor.printSection("PID自整定");
+  const char* const stateNames[4] = { "未运行", "进行中", "完成", "失败" };
+  serialMonitor.printKeyValue("状态", String(stateNames[autotuner.getState()]) + ", 周期 " +
+                              String(autotuner.getCycleCount()));
+  if (autotuner.getState() == RelayAutotuner::AUTOTUNE_DONE) {
+    serialMonitor.printKeyValue("临界点", "Ku=" + String(autotuner.getUltimateGain(), 3) + " %/ppm, Pu=" +
+                                String(autotuner.getUltimatePeriod(), 1) + " s, 幅值 " +
+                                String(autotuner.getAmplitude(), 2) + " ppm");
+    if (autotuner.hasModel()) {
+      serialMonitor.printKeyValue("过程模型", "K=" + String(autotuner.getProcessGain(), 3) + " ppm/%, τ=" +
+                                  String(autotuner.getTimeConstant(), 1) + " s, L=" +
+                                  String(autotuner.getDeadTime(), 1) + " s");
+    } else {
+      serialMonitor.printKeyValue("过程模型", "未辨识（描述函数近似）");
+    }
+  }
+  serialMonitor.printKeyValue("PID参数", "Kp=" + String(Kp, 3) + " Ki=" + String(Ki, 4) + " Kd=" + String(Kd, 3));
+}
+
+// ========== 紧急快速通道 ==========
+void checkEmergencyWatchdog() {
+#if EMERGENCY_FAST_PATH
+  EmergencyTrip trip;
+  if (!sensorManager.getEmergencyWatchdog().takeTrip(trip)) return;
+  
+  // 维护与错误状态下由各自的流程控制输出
+  SystemState state = stateManager.getCurrentState();
+  if (state != STATE_RUNNING && state != STATE_OPTIMIZING && state != STATE_EMERGENCY) return;
+  
+  if (state != STATE_EMERGENCY) {
+    stateManager.setState(STATE_EMERGENCY);
+  }
+  controlSystem.executeControl(100); // 最大控制输出
+  
+  emergencyLatency = micros() - trip.micros;
+  if (emergencyLatency > emergencyLatencyMax) {
+    emergencyLatencyMax = emergencyLatency;
+  }
+  emergencyEvents++;
+  
+  if (DEBUG_MODE) {
+    serialMonitor.printWarning("紧急通道触发: 原始值 " + String(trip.rawValue) +
+                               (trip.bySlope ? " (上升速率)" : "") +
+                               ", 延迟 " + String(emergencyLatency) + " us");
+  }
+#endif
+}
+
 // ========== 辅助函数实现 ==========
 float calculateEnergyUsage(const SensorData& sensors) {
   // 简化计算：基于流量和控制输出
@@ -319,6 +698,8 @@ String generateDecisionReasoning(const SensorData& sensors, const DigitalTwinDat
 void displaySystemStatus() {
   if (!DEBUG_MODE) return;
   
+  const SensorData& sensors = sensorSnapshot.latest();
+  
   serialMonitor.printSeparator();
   serialMonitor.printSection("系统状态");
   
@@ -327,15 +708,65 @@ void displaySystemStatus() {
   serialMonitor.printKeyValue("控制输出", String(currentDecision.controlOutput, 1) + "%");
   
   serialMonitor.printSection("传感器数据");
-  serialMonitor.printKeyValue("流量", String(currentSensors.flowRate, 1) + " cm/s");
-  serialMonitor.printKeyValue("污染物", String(currentSensors.pollutionLevel, 1) + " ppm");
-  serialMonitor.printKeyValue("光照", String(currentSensors.lightIntensity, 0) + " lux");
-  serialMonitor.printKeyValue("pH值", String(currentSensors.pH, 1));
-  serialMonitor.printKeyValue("温度", String(currentSensors.temperature, 1) + " °C");
+  serialMonitor.printKeyValue("流量", String(sensors.flowRate, 1) + " cm/s");
+  serialMonitor.printKeyValue("污染物", String(sensors.pollutionLevel, 1) + " ppm");
+  serialMonitor.printKeyValue("光照", String(sensors.lightIntensity, 0) + " lux");
+  serialMonitor.printKeyValue("pH值", String(sensors.pH, 1));
+  serialMonitor.printKeyValue("温度", String(sensors.temperature, 1) + " °C");
+  
+  // 各通道有效分辨率与最近一批转换耗时
+  serialMonitor.printSection("ADC采样");
+  const char* const channelNames[5] = { "流量", "污染物", "光照", "pH值", "温度" };
+  for (uint8_t i = 0; i < 5; i++) {
+    serialMonitor.printKeyValue(channelNames[i], String(sensors.resolutionBits[i]) + " bit, " +
+                                String(sensorManager.getConversionTime(i)) + " us");
+  }
+
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 最近一帧的频谱类型、主频与高频段噪声
+  serialMonitor.printSection("频谱分析");
+  const char* const spectrumNames[5] = { "未完成", "平稳", "周期波动", "宽带噪声", "漂移" };
+  for (uint8_t i = 0; i < 5; i++) {
+    const SpectrumFeatures& spectrum = sensorManager.getSpectrum(i);
+    serialMonitor.printKeyValue(channelNames[i], String(spectrumNames[spectrum.type]) + ", " +
+                                String(spectrum.dominantFrequency, 2) + " Hz, 噪声 " +
+                                String(spectrum.noiseRms, 1));
+  }
+#endif
+
+  // 预测控制求解耗时与约束情况
+  serialMonitor.printSection("预测控制");
+  PredictiveController& predictive = controlSystem.getPredictiveController();
+  serialMonitor.printKeyValue("求解耗时", String(predictive.getLastSolveTime()) + " us (最大 " +
+                              String(predictive.getMaxSolveTime()) + " us)");
+  serialMonitor.printKeyValue("迭代次数", String(predictive.getLastIterations()) +
+                              (predictive.wasConstrained() ? " (约束有效)" : ""));
+  serialMonitor.printKeyValue("扰动估计", String(predictive.getDisturbance(), 3) + " ppm/步");
+#if MPC_EXPLICIT
+  const ExplicitController& explicitLaw = controlSystem.getExplicitController();
+  serialMonitor.printKeyValue("控制律", String(explicitLaw.wasInTable() ? "查表 " : "在线求解 ") +
+                              String(explicitLaw.getLastLookupTime()) + " us (表外 " +
+                              String(explicitLaw.getMissCount()) + " 次)");
+#endif
+  
+  printDriftStatus();
+  printAutotuneStatus();
+
+#if EMERGENCY_FAST_PATH
+  // 原始值阈值、触发次数与从转换到执行的延迟
+  serialMonitor.printSection("紧急通道");
+  EmergencyWatchdog& watchdog = sensorManager.getEmergencyWatchdog();
+  serialMonitor.printKeyValue("阈值", String(sensorManager.getEmergencyTripRaw()) + " / " +
+                              String(sensorManager.getEmergencyClearRaw()) + " (原始值)");
+  serialMonitor.printKeyValue("状态", watchdog.isTripped() ? "触发" : "正常");
+  serialMonitor.printKeyValue("触发次数", String(emergencyEvents) + " / " + String(watchdog.getTripCount()));
+  serialMonitor.printKeyValue("响应延迟", String(emergencyLatency) + " us (最大 " +
+                              String(emergencyLatencyMax) + " us)");
+#endif
   
   serialMonitor.printSection("系统性能");
-  serialMonitor.printKeyValue("系统效率", String(currentSensors.systemEfficiency, 1) + "%");
-  serialMonitor.printKeyValue("能耗", String(currentSensors.energyUsage, 1) + "%");
+  serialMonitor.printKeyValue("系统效率", String(sensors.systemEfficiency, 1) + "%");
+  serialMonitor.printKeyValue("能耗", String(sensors.energyUsage, 1) + "%");
   serialMonitor.printKeyValue("健康度", String(currentTwin.systemHealth, 1) + "%");
   serialMonitor.printKeyValue("剩余寿命", String(currentTwin.remainingLife, 1) + "%");
   
@@ -343,8 +774,11 @@ void displaySystemStatus() {
 }
 
 void logSystemData() {
-  // 记录传感器数据
-  dataStorage.logSensorData(currentSensors, millis());
+  // 记录传感器数据（采样以来没有新样本时不重复记录）
+  static uint32_t loggedSequence = 0;
+  if (sensorSnapshot.advance(loggedSequence)) {
+    dataStorage.logSensorData(sensorSnapshot.latest(), sensorSnapshot.getTimestamp());
+  }
   
   // 记录控制决策
   dataStorage.logControlData(currentDecision, millis());
@@ -374,11 +808,80 @@ void handleSerialCommands() {
     } else if (command == "calibrate") {
       serialMonitor.printMessage("开始传感器校准...");
       calibrateSensors();
+    } else if (command.startsWith("capture ")) {
+      // 先按 unsigned long 解析并检查范围，再换算为 uint8_t/uint16_t，避免截断后落入有效范围
+      unsigned long channel = 0;
+      unsigned long rate = CAPTURE_DEFAULT_RATE;
+      unsigned long samples = CAPTURE_MAX_SAMPLES;
+      int fields = sscanf(command.c_str() + 8, "%lu %lu %lu", &channel, &rate, &samples);
+      CaptureBuffer::ArgumentError error = (fields < 1) ? CaptureBuffer::ARGUMENT_CHANNEL :
+                                           CaptureBuffer::checkArguments(channel, rate, samples);
+      if (error == CaptureBuffer::ARGUMENT_CHANNEL) {
+        serialMonitor.printError("通道应为 0-" + String(SENSOR_COUNT - 1));
+      } else if (error == CaptureBuffer::ARGUMENT_RATE) {
+        serialMonitor.printError("采样率应为 1-" + String(CAPTURE_MAX_RATE) + " Hz");
+      } else if (error == CaptureBuffer::ARGUMENT_SAMPLES) {
+        serialMonitor.printError("样本数应为 1-" + String(CAPTURE_MAX_SAMPLES));
+      } else if (startDiagnosticCapture(static_cast<uint8_t>(channel), static_cast<uint16_t>(rate),
+                                        static_cast<uint16_t>(samples), CAPTURE_TARGET_SERIAL)) {
+        serialMonitor.printMessage("开始突发采集: 通道" + String(channel) + ", " + String(rate) + "Hz");
+      } else {
+        serialMonitor.printError("无法开始采集（上次采集未结束）");
+      }
+    } else if (command == "autotune") {
+      float setpoint = currentTwin.optimalSetpoint > 0.0f ? currentTwin.optimalSetpoint : TARGET_POLLUTION;
+      if (controlSystem.startAutotune(setpoint)) {
+        serialMonitor.printMessage("开始继电反馈自整定，设定值 " + String(setpoint, 1) + " ppm");
+      } else {
+        serialMonitor.printError("自整定已在进行中");
+      }
+    } else if (command == "autotune stop") {
+      controlSystem.abortAutotune();
+    } else if (command == "autotune status") {
+      printAutotuneStatus();
+    } else if (command == "mpc bench") {
+      benchmarkPredictiveControl();
+    } else if (command == "fixed bench") {
+      benchmarkFixedPoint();
+    } else if (command == "mpc table") {
+      generateExplicitTable();
+#if MPC_EXPLICIT
+    } else if (command == "mpc check") {
+      serialMonitor.printMessage("比较各网格单元中心的查表与在线求解结果...");
+      PredictiveController solver = controlSystem.getPredictiveController();
+      float rmsError;
+      float maxError = ExplicitController::verifyTable(solver, rmsError);
+      serialMonitor.printKeyValue("查表误差", "最大 " + String(maxError, 2) + "%, 均方根 " +
+                                  String(rmsError, 3) + "%");
+#endif
+#if SENSOR_DRIFT_MONITOR
+    } else if (command == "drift") {
+      printDriftStatus();
+    } else if (command.startsWith("drift apply ")) {
+      int channel = command.substring(12).toInt();
+      if (channel >= 0 && channel < 5 && driftMonitor.applyCorrection(channel, sensorManager)) {
+        serialMonitor.printMessage("通道" + String(channel) + "漂移修正已写入校准");
+      } else {
+        serialMonitor.printError("通道" + String(channel) + "没有可用的修正建议");
+      }
+#endif
     } else if (command == "help") {
       serialMonitor.printSection("可用命令");
       serialMonitor.println("  status     - 显示系统状态");
       serialMonitor.println("  mode <n>   - 切换控制模式 (0-4)");
       serialMonitor.println("  calibrate  - 开始传感器校准");
+      serialMonitor.println("  capture <通道> [采样率] [样本数] - 原始ADC突发采集");
+      serialMonitor.println("  autotune   - 继电反馈自整定PID参数 (stop 中止, status 查看)");
+      serialMonitor.println("  mpc bench  - 测试不同预测时域的求解耗时");
+      serialMonitor.println("  mpc table  - 生成显式MPC查找表 (ExplicitMpcTable.h)");
+      serialMonitor.println("  fixed bench - 测试定点与浮点运算的周期数");
+#if MPC_EXPLICIT
+      serialMonitor.println("  mpc check  - 校验查找表与在线求解的误差");
+#endif
+#if SENSOR_DRIFT_MONITOR
+      serialMonitor.println("  drift      - 显示漂移监测状态");
+      serialMonitor.println("  drift apply <通道> - 按建议修正该通道校准");
+#endif
       serialMonitor.println("  reset      - 重置系统");
       serialMonitor.println("  help       - 显示帮助信息");
     } else {
@@ -406,6 +909,12 @@ void handleWiFiCommands() {
       wifiComm.sendLogMessage("传感器校准完成");
     }
     
+    if (cmd.captureRequested) {
+      if (!startDiagnosticCapture(cmd.captureChannel, cmd.captureRate, cmd.captureSamples, CAPTURE_TARGET_WIFI)) {
+        wifiComm.sendLogMessage("无法开始采集", 1);
+      }
+    }
+    
     if (cmd.manualOverride) {
       // 手动控制模式
       controlSystem.setControlMode(MAINTENANCE);
@@ -434,8 +943,11 @@ void handleWiFiCommands() {
 void sendDataToWiFi() {
   if (!wifiComm.isConnected()) return;
   
-  // 发送传感器数据
-  wifiComm.sendSensorData(currentSensors);
+  // 发送传感器数据（没有新样本时不重复发送）
+  static uint32_t sentSequence = 0;
+  if (sensorSnapshot.advance(sentSequence)) {
+    wifiComm.sendSensorData(sensorSnapshot.latest());
+  }
   
   // 发送控制数据
   wifiComm.sendControlData(currentDecision);
@@ -444,6 +956,44 @@ void sendDataToWiFi() {
   wifiComm.sendTwinData(currentTwin);
 }
 
+// ========== 突发采集诊断 ==========
+bool startDiagnosticCapture(uint8_t channel, uint16_t rateHz, uint16_t samples, CaptureTarget target) {
+  // 上一次的数据尚未输出完时不覆盖缓冲区
+  if (captureTarget != CAPTURE_TARGET_NONE) return false;
+  
+  if (!sensorManager.getSource().startCapture(channel, rateHz, samples)) return false;
+  
+  captureTarget = target;
+  return true;
+}
+
+void serviceDiagnosticCapture() {
+  if (captureTarget == CAPTURE_TARGET_NONE) return;
+  
+  const CaptureBuffer& capture = sensorManager.getSource().getCapture();
+  if (!captureStreamer.isActive()) {
+    // 采集在中断中进行，完成后开始输出
+    if (capture.isRunning()) return;
+    
+    CaptureStreamer::Format format = (captureTarget == CAPTURE_TARGET_WIFI) ?
+                                     CaptureStreamer::FORMAT_JSON : CaptureStreamer::FORMAT_TEXT;
+    if (!captureStreamer.begin(capture, format)) {
+      captureTarget = CAPTURE_TARGET_NONE;
+      return;
+    }
+  }
+  
+  if (captureTarget == CAPTURE_TARGET_WIFI) {
+    wifiComm.streamCapture(captureStreamer);
+  } else {
+    serialMonitor.streamCapture(captureStreamer);
+  }
+  
+  if (!captureStreamer.isActive()) {
+    captureTarget = CAPTURE_TARGET_NONE;
+  }
+}
+
 void resetSystem() {
   // 重置各模块
   for (int i = 0; i < 5; i++) {
@@ -452,9 +1002,11 @@ void resetSystem() {
   controlSystem.reset();
   digitalTwin.reset();
   learningSystem.reset();
+#if SENSOR_DRIFT_MONITOR
+  driftMonitor.initialize();
+#endif
   
   // 重置定时器
-  sensorTimer.reset();
   controlTimer.reset();
   learningTimer.reset();
   displayTimer.reset();
@@ -476,7 +1028,11 @@ void calibrateSensors() {
   // 这里可以实现具体的校准逻辑
   for (int i = 0; i < 5; i++) {
     serialMonitor.printMessage("校准传感器 " + String(i) + "...");
-    // sensorManager.calibrateSensor(i, knownValue);
+    // 校准点写入后，漂移基线按新的校准重新记录（SENSOR_DRIFT_MONITOR 时）；
+    // 未写入校准时保留原基线，否则已累积的漂移估计会被清除
+    // if (sensorManager.calibrateSensor(i, knownValue)) {
+    //   driftMonitor.rebaseline(i);
+    // }
     delay(1000);
   }
   
@@ -573,12 +1129,21 @@ void emergencyState() {
   
   if (!emergencyAlertSent) {
     serialMonitor.printError("!!! 紧急状态 !!!");
-    serialMonitor.printError("污染物浓度过高: " + String(currentSensors.pollutionLevel, 1) + "ppm");
+    serialMonitor.printError("污染物浓度过高: " + String(sensorSnapshot.latest().pollutionLevel, 1) + "ppm");
+#if EMERGENCY_FAST_PATH
+    serialMonitor.printMessage("响应延迟: " + String(emergencyLatency) + " us");
+#endif
     serialMonitor.printMessage("启动应急处理程序...");
     
     emergencyAlertSent = true;
   }
   
+  // 继续采样，紧急监视据此判断解除
+  acquireSensorData();
+  
+  // 紧急状态下不再继续自整定
+  controlSystem.abortAutotune();
+  
   // 紧急停止或安全处理
   controlSystem.executeControl(100); // 最大控制输出
   
@@ -588,13 +1153,21 @@ void emergencyState() {
   if (millis() - emergencyStart > 2000) {
     emergencyStart = millis();
     
-    if (currentSensors.pollutionLevel < 400.0f) {
+    const SensorData& sensors = sensorSnapshot.latest();
+#if EMERGENCY_FAST_PATH
+    // 滞回：原始值持续低于解除值后紧急监视自动解除
+    bool recovered = !sensorManager.getEmergencyWatchdog().isTripped() &&
+                     sensors.pollutionLevel < EMERGENCY_CLEAR_LEVEL;
+#else
+    bool recovered = sensors.pollutionLevel < 400.0f;
+#endif
+    if (recovered) {
       stateManager.setState(STATE_RUNNING);
       emergencyAlertSent = false;
       serialMonitor.printMessage("紧急状态解除，恢复运行");
     } else {
       serialMonitor.printWarning("污染物浓度仍然过高: " + 
-                                String(currentSensors.pollutionLevel, 1) + "ppm");
+                                String(sensors.pollutionLevel, 1) + "ppm");
     }
   }
 }
@@ -0,0 +1,99 @@
+#include "CaptureStreamer.h"
+#include <stdio.h>
+
+CaptureStreamer::CaptureStreamer()
+  : capture(nullptr),
+    format(FORMAT_TEXT),
+    stage(STAGE_DONE),
+    nextSample(0),
+    lineLength(0),
+    linePosition(0) {
+  line[0] = '\0';
+}
+
+bool CaptureStreamer::begin(const CaptureBuffer& buffer, Format outputFormat) {
+  if (buffer.getState() != CaptureBuffer::CAPTURE_COMPLETE || buffer.size() == 0) {
+    return false;
+  }
+  
+  capture = &buffer;
+  format = outputFormat;
+  stage = STAGE_HEADER;
+  nextSample = 0;
+  lineLength = 0;
+  linePosition = 0;
+  return true;
+}
+
+void CaptureStreamer::cancel() {
+  stage = STAGE_DONE;
+  lineLength = 0;
+  linePosition = 0;
+}
+
+bool CaptureStreamer::isActive() const {
+  return stage != STAGE_DONE || linePosition < lineLength;
+}
+
+size_t CaptureStreamer::peek(const char*& data) {
+  if (linePosition >= lineLength) {
+    if (stage == STAGE_DONE) return 0;
+    formatLine();
+  }
+  
+  data = line + linePosition;
+  return lineLength - linePosition;
+}
+
+void CaptureStreamer::consume(size_t count) {
+  size_t remaining = lineLength - linePosition;
+  linePosition += count < remaining ? count : remaining;
+}
+
+uint16_t CaptureStreamer::getProgress() const {
+  return nextSample;
+}
+
+void CaptureStreamer::formatLine() {
+  bool json = (format == FORMAT_JSON);
+  int length = 0;
+  
+  switch (stage) {
+    case STAGE_HEADER:
+      length = snprintf(line, LINE_LENGTH,
+                        json ? "{\"type\":\"captureBegin\",\"channel\":%u,\"samples\":%u,\"rate\":%u,\"duration\":%lu}\n"
+                             : "# capture channel=%u samples=%u rate=%u duration_us=%lu\n",
+                        capture->getChannel(), capture->size(), capture->getRate(), capture->getDuration());
+      stage = STAGE_DATA;
+      break;
+    
+    case STAGE_DATA: {
+      length = snprintf(line, LINE_LENGTH, json ? "{\"type\":\"capture\",\"offset\":%u,\"data\":[" : "%u",
+                        nextSample);
+      uint16_t end = nextSample + CAPTURE_LINE_SAMPLES;
+      if (end > capture->size()) end = capture->size();
+      for (uint16_t i = nextSample; i < end; i++) {
+        const char* separator = (json && i == nextSample) ? "" : ",";
+        length += snprintf(line + length, LINE_LENGTH - length, "%s%u", separator, capture->get(i));
+      }
+      length += snprintf(line + length, LINE_LENGTH - length, json ? "]}\n" : "\n");
+      
+      nextSample = end;
+      if (nextSample >= capture->size()) {
+        stage = STAGE_FOOTER;
+      }
+      break;
+    }
+    
+    case STAGE_FOOTER:
+      length = snprintf(line, LINE_LENGTH, json ? "{\"type\":\"captureEnd\"}\n" : "# end\n");
+      stage = STAGE_DONE;
+      break;
+    
+    default:
+      break;
+  }
+  
+  lineLength = length < LINE_LENGTH ? length : LINE_LENGTH - 1;
+  linePosition = 0;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef CAPTURE_STREAMER_H
+#define CAPTURE_STREAMER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+#include "../Sensors/CaptureBuffer.h"
+
+// 突发采集数据的分段输出
+// 每次只格式化一行（头部、CAPTURE_LINE_SAMPLES 个样本或结束标记），
+// 输出端按当前不会阻塞的字节数逐步取走，loop() 不因输出而停顿。
+// 文本格式（串口）：
+//   # capture channel=1 samples=1024 rate=1000 duration_us=1023000
+//   <起始序号>,<样本>,<样本>,...
+//   # end
+// JSON格式（WiFi），每行一个对象：
+//   {"type":"captureBegin",...} / {"type":"capture","offset":n,"data":[...]} / {"type":"captureEnd"}
+class CaptureStreamer {
+public:
+  enum Format : uint8_t {
+    FORMAT_TEXT = 0,
+    FORMAT_JSON
+  };
+  
+private:
+  enum Stage : uint8_t {
+    STAGE_HEADER = 0,
+    STAGE_DATA,
+    STAGE_FOOTER,
+    STAGE_DONE
+  };
+  
+  // 每个样本最多5个字符（分隔符与4位数字），另加行首与行尾
+  static const uint8_t LINE_LENGTH = 48 + CAPTURE_LINE_SAMPLES * 5;
+  static_assert(CAPTURE_LINE_SAMPLES >= 8 && CAPTURE_LINE_SAMPLES <= 32, "CAPTURE_LINE_SAMPLES must be 8-32");
+  
+  const CaptureBuffer* capture;
+  Format format;
+  Stage stage;
+  uint16_t nextSample;
+  
+  // 当前行及已输出的字节数
+  char line[LINE_LENGTH];
+  uint8_t lineLength;
+  uint8_t linePosition;
+  
+public:
+  CaptureStreamer();
+  
+  // 开始输出已完成的采集，采集未完成或为空时返回 false
+  bool begin(const CaptureBuffer& buffer, Format outputFormat);
+  void cancel();
+  bool isActive() const;
+  
+  // 取得待输出的数据（当前行输出完时格式化下一行），全部输出后返回0
+  size_t peek(const char*& data);
+  void consume(size_t count);
+  
+  // 已输出的样本数
+  uint16_t getProgress() const;
+  
+private:
+  void formatLine();
+};
+
+#endif // CAPTURE_STREAMER_H
\ No newline at end of file
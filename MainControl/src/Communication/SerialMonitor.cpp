@@ -1,4 +1,5 @@
 #include "SerialMonitor.h"
+#include "CaptureStreamer.h"
 
 SerialMonitor::SerialMonitor() {
   config.enabled = true;
@@ -199,6 +200,24 @@ void SerialMonitor::printDataStream(const String& label, float value,
   println(formatted);
 }
 
+void SerialMonitor::streamCapture(CaptureStreamer& streamer) {
+  if (!config.enabled) {
+    streamer.cancel();
+    return;
+  }
+  
+  const char* data;
+  size_t length = streamer.peek(data);
+  int space = Serial.availableForWrite();
+  while (length > 0 && space > 0) {
+    size_t count = length < (size_t)space ? length : (size_t)space;
+    Serial.write(reinterpret_cast<const uint8_t*>(data), count);
+    streamer.consume(count);
+    space -= count;
+    length = streamer.peek(data);
+  }
+}
+
 void SerialMonitor::clearScreen() {
   if (!config.enabled) return;
   
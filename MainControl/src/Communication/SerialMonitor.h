@@ -3,6 +3,8 @@
 
 #include <Arduino.h>
 
+class CaptureStreamer;
+
 class SerialMonitor {
 private:
   // 显示配置
@@ -62,6 +64,9 @@ public:
   void printDataStream(const String& label, float value, 
                       const String& unit = "", uint8_t decimals = 2);
   
+  // 突发采集数据：只写入发送缓冲区的空闲字节，不等待串口
+  void streamCapture(CaptureStreamer& streamer);
+  
   // 清屏和光标控制
   void clearScreen();
   void setCursor(uint8_t row, uint8_t col);
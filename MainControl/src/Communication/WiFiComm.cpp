@@ -1,4 +1,5 @@
 #include "WiFiComm.h"
+#include "CaptureStreamer.h"
 #include <SoftwareSerial.h>
 #include <ArduinoJson.h>
 
@@ -27,6 +28,10 @@ WiFiComm::WiFiComm()
     currentCommand.resetRequested = false;
     currentCommand.calibrateRequested = false;
     currentCommand.commandType = "";
+    currentCommand.captureRequested = false;
+    currentCommand.captureChannel = 0;
+    currentCommand.captureRate = CAPTURE_DEFAULT_RATE;
+    currentCommand.captureSamples = CAPTURE_MAX_SAMPLES;
 }
 
 WiFiComm::~WiFiComm() {
@@ -156,6 +161,20 @@ void WiFiComm::processReceivedData(String data) {
             } else if (command == "calibrate") {
                 currentCommand.calibrateRequested = true;
                 sendLogMessage("传感器校准请求");
+            } else if (command == "capture") {
+                // 与串口命令相同：检查范围后再换算为 uint8_t/uint16_t
+                unsigned long channel = doc["channel"] | 0UL;
+                unsigned long rate = doc["rate"] | (unsigned long)CAPTURE_DEFAULT_RATE;
+                unsigned long samples = doc["samples"] | (unsigned long)CAPTURE_MAX_SAMPLES;
+                if (CaptureBuffer::checkArguments(channel, rate, samples) == CaptureBuffer::ARGUMENT_OK) {
+                    currentCommand.captureRequested = true;
+                    currentCommand.captureChannel = static_cast<uint8_t>(channel);
+                    currentCommand.captureRate = static_cast<uint16_t>(rate);
+                    currentCommand.captureSamples = static_cast<uint16_t>(samples);
+                    sendLogMessage("突发采集请求: 通道" + String(currentCommand.captureChannel));
+                } else {
+                    sendLogMessage("突发采集参数超出范围", 1);
+                }
             }
         }
     } else {
@@ -186,6 +205,13 @@ void WiFiComm::processReceivedData(String data) {
             currentCommand.calibrateRequested = true;
             currentCommand.commandType = "calibrate";
             sendLogMessage("传感器校准请求");
+        } else if (data.startsWith("CAPTURE:")) {
+            currentCommand.captureRequested = true;
+            currentCommand.captureChannel = data.substring(8).toInt();
+            currentCommand.captureRate = CAPTURE_DEFAULT_RATE;
+            currentCommand.captureSamples = CAPTURE_MAX_SAMPLES;
+            currentCommand.commandType = "capture";
+            sendLogMessage("突发采集请求: 通道" + String(currentCommand.captureChannel));
         }
     }
 }
@@ -275,10 +301,30 @@ void WiFiComm::sendLogMessage(const String& message, uint8_t level) {
     espSerial->println(json);
 }
 
+void WiFiComm::streamCapture(CaptureStreamer& streamer) {
+    if (!connected || espSerial == nullptr) {
+        streamer.cancel();
+        return;
+    }
+    
+    // 软件串口发送时阻塞，限制每次的字节数以免拖慢主循环
+    size_t budget = CAPTURE_WIFI_BYTES;
+    const char* data;
+    size_t length = streamer.peek(data);
+    while (length > 0 && budget > 0) {
+        size_t count = length < budget ? length : budget;
+        espSerial->write(reinterpret_cast<const uint8_t*>(data), count);
+        streamer.consume(count);
+        budget -= count;
+        length = streamer.peek(data);
+    }
+}
+
 // ========== 修改这里 ==========
 bool WiFiComm::hasCommand() const {
     return currentCommand.resetRequested || 
            currentCommand.calibrateRequested ||
+           currentCommand.captureRequested ||
            (currentCommand.commandType.length() > 0);  // 修改这里
 }
 
@@ -289,6 +335,7 @@ WiFiCommand WiFiComm::getCommand() const {
 void WiFiComm::clearCommand() {
     currentCommand.resetRequested = false;
     currentCommand.calibrateRequested = false;
+    currentCommand.captureRequested = false;
     currentCommand.commandType = "";
 }
 
@@ -4,6 +4,8 @@
 #include <Arduino.h>
 #include "../Core/CommonTypes.h"
 
+class CaptureStreamer;
+
 // WiFi配置结构体
 struct WiFiConfig {
     String ssid;
@@ -25,6 +27,10 @@ struct WiFiCommand {
     bool resetRequested;    // 重置请求
     bool calibrateRequested; // 校准请求
     String commandType;     // 命令类型
+    bool captureRequested;  // 突发采集请求
+    uint8_t captureChannel; // 采集通道
+    uint16_t captureRate;   // 采样率 (Hz)
+    uint16_t captureSamples; // 样本数
 };
 
 class WiFiComm {
@@ -68,6 +74,9 @@ public:
     void sendTwinData(const DigitalTwinData& twin);
     void sendLogMessage(const String& message, uint8_t level = 2);
     
+    // 突发采集数据，每次调用最多发送 CAPTURE_WIFI_BYTES 字节
+    void streamCapture(CaptureStreamer& streamer);
+    
     // 接收命令
     bool hasCommand() const;
     WiFiCommand getCommand() const;
@@ -1,12 +1,38 @@
 #include "ControlSystem.h"
+#include <EEPROM.h>
+#include "FuzzyRuleBases.h"
+#include "GainSchedule.h"
+
+// PID参数的校验和：逐字节异或并循环移位，未写入过的EEPROM（全为0xFF）不能通过
+static uint8_t gainsChecksum(const float gains[3]) {
+  uint8_t sum = 0x5A;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(gains);
+  for (uint8_t i = 0; i < 3 * sizeof(float); i++) {
+    sum = ((sum << 1) | (sum >> 7)) ^ bytes[i];
+  }
+  return sum;
+}
+
 
 ControlSystem::ControlSystem() 
-  : currentMode(STANDARD),
+  : baseKp(1.0f),
+    baseKi(0.1f),
+    baseKd(0.05f),
+    lastError(0.0f),
+    scheduleMode(0xFF),
+    scheduleBand(0xFF),
+    scheduledKp(1.0f),
+    scheduledKi(0.1f),
+    scheduledKd(0.05f),
+    pidOutput(0.0f),
+    pidEngaged(false),
+    transferCount(0),
+    currentMode(STANDARD),
     previousMode(STANDARD),
     controlOutput(0.0f),
     previousOutput(0.0f),
-    predictionHorizon(3.0f),
-    controlHorizon(2.0f),
+    reactionRate(0.1f),
+    steadyOutput(0.0f),
     controlEffort(0.0f),
     trackingError(0.0f),
     energyConsumption(0.0f),
@@ -18,16 +44,30 @@ bool ControlSystem::initialize() {
   pinMode(BUZZER_PIN, OUTPUT);
   stressServo.write(0);
   
-  // 初始化PID控制器
-  pidController = PIDController(1.0f, 0.1f, 0.05f);
+  // 初始化PID控制器（优先使用自整定保存的参数）
+  if (loadGains() && DEBUG_MODE) {
+    Serial.println("使用已保存的PID参数");
+  }
+  pidController = PIDController(PIDValue(baseKp), PIDValue(baseKi), PIDValue(baseKd));
+  pidController.setReverseActing(true); // 污染物浓度高于设定值时加大应力
+  scheduleMode = 0xFF;                  // 第一次计算时按当前模式与档位调度
+  
+  // 初始化模糊系统：使用当前模式的规则库
+  fuzzySystem.initialize(&FUZZY_RULE_BASES[currentMode]);
   
-  // 初始化模糊系统（简化）
+  // 初始化MPC
+  predictiveController.setHorizon(MPC_HORIZON);
+  predictiveController.setWeights(MPC_TRACKING_WEIGHT, MPC_MOVE_WEIGHT, MPC_ENERGY_WEIGHT);
+  predictiveController.setLimits(0.0f, 100.0f, MPC_MAX_RATE);
+  predictiveController.reset();
   
   initialized = true;
   return true;
 }
 
 void ControlSystem::setControlMode(ControlMode mode) {
+  // 人工或远程切换模式时中止自整定
+  abortAutotune();
   previousMode = currentMode;
   currentMode = mode;
   handleModeTransition(mode);
@@ -44,6 +84,19 @@ ControlMode ControlSystem::getPreviousMode() const {
 float ControlSystem::computeControl(const SensorData& sensors, const DigitalTwinData& twin) {
   float output = 0.0f;
   
+  // 自整定期间由继电器给出输出；完成后应用并保存参数，下一周期恢复正常控制
+  if (autotuner.isActive()) {
+    output = autotuner.update(sensors.pollutionLevel, millis());
+    if (autotuner.getState() == RelayAutotuner::AUTOTUNE_DONE) {
+      float Kp, Ki, Kd;
+      autotuner.getParameters(Kp, Ki, Kd);
+      updatePIDParameters(Kp, Ki, Kd);
+      saveGains();
+    }
+    controlOutput = output;
+    return output;
+  }
+  
   switch (currentMode) {
     case ENERGY_SAVING:
       output = energySavingControl(sensors, twin);
@@ -80,8 +133,8 @@ float ControlSystem::standardControl(const SensorData& sensors, const DigitalTwi
 }
 
 float ControlSystem::energySavingControl(const SensorData& sensors, const DigitalTwinData& twin) {
-  float baseControl = adaptiveFuzzyPID(sensors, twin);
-  return baseControl * 0.7f; // 节能模式下降低控制强度
+  // 节能模式下降低控制强度（增益调度）
+  return adaptiveFuzzyPID(sensors, twin);
 }
 
 float ControlSystem::highEfficiencyControl(const SensorData& sensors, const DigitalTwinData& twin) {
@@ -89,8 +142,8 @@ float ControlSystem::highEfficiencyControl(const SensorData& sensors, const Digi
 }
 
 float ControlSystem::shockLoadControl(const SensorData& sensors, const DigitalTwinData& twin) {
-  float baseControl = adaptiveFuzzyPID(sensors, twin);
-  return min(100.0f, baseControl * 1.5f); // 冲击负荷时增强控制
+  // 冲击负荷时增强控制（增益调度）
+  return adaptiveFuzzyPID(sensors, twin);
 }
 
 float ControlSystem::maintenanceControl(const SensorData& sensors, const DigitalTwinData& twin) {
@@ -99,31 +152,84 @@ float ControlSystem::maintenanceControl(const SensorData& sensors, const Digital
 }
 
 float ControlSystem::modelPredictiveControl(const SensorData& sensors, const DigitalTwinData& twin) {
-  float bestControl = 50.0f; // 默认值
-  float bestCost = 1e9;
+  float setpoint = twin.optimalSetpoint > 0.0f ? twin.optimalSetpoint : TARGET_POLLUTION;
+  float baseRate = reactorBaseRate(sensors);
+  trackingError = fabs(sensors.pollutionLevel - setpoint);
   
-  // 简化的MPC：评估几个可能的控制量
-  for (int testControl = 0; testControl <= 100; testControl += 20) {
-    float cost = evaluateControlCost(testControl, sensors, twin, HIGH_EFFICIENCY);
+#if MPC_EXPLICIT
+  // 与生成表格时相同，在 TARGET_POLLUTION 与稳态输出处线性化；
+  // 稳态输出由扰动估计换算，线性化取上一周期的值，稳态下两者一致
+  if (explicitController.acceptsSetpoint(setpoint)) {
+    float a, b;
+    ExplicitController::reactorModel(baseRate, steadyOutput, TARGET_POLLUTION, a, b);
+    predictiveController.setModel(a, b);
+    float estimate = predictiveController.observe(sensors.pollutionLevel, previousOutput);
+    steadyOutput = constrain(((1.0f - a) * TARGET_POLLUTION - estimate) / b, 0.0f, 100.0f);
     
-    if (cost < bestCost) {
-      bestCost = cost;
-      bestControl = testControl;
+    float output;
+    if (explicitController.compute(baseRate, steadyOutput, previousOutput, sensors.pollutionLevel - setpoint,
+                                   output)) {
+      return output;
     }
+    return predictiveController.plan(sensors.pollutionLevel, estimate, setpoint, previousOutput);
   }
+#endif
+  // 在当前 (C, u) 处线性化
+  float a, b;
+  ExplicitController::reactorModel(baseRate, previousOutput, sensors.pollutionLevel, a, b);
+  predictiveController.setModel(a, b);
+  return predictiveController.compute(sensors.pollutionLevel, setpoint, previousOutput);
+}
   
-  return bestControl;
+float ControlSystem::reactorBaseRate(const SensorData& sensors) const {
+  return reactionRate *
+         (1.0f + 0.1f * sensors.flowRate / 50.0f) *
+         (1.0f + 0.05f * sensors.lightIntensity / 500.0f);
+}
+
+void ControlSystem::setReactorModel(const SystemModel& model) {
+  reactionRate = model.reactionRate * model.degradation;
+}
+
+PredictiveController& ControlSystem::getPredictiveController() {
+  return predictiveController;
+}
+
+const ExplicitController& ControlSystem::getExplicitController() const {
+  return explicitController;
 }
 
 float ControlSystem::adaptiveFuzzyPID(const SensorData& sensors, const DigitalTwinData& twin) {
   float error = sensors.pollutionLevel - twin.optimalSetpoint;
-  float dt = 0.1f; // 假设时间间隔
+  unsigned long now = micros();
+  
+  // 执行器被其他控制律驱动过（MPC、维护、自整定、紧急、手动），或复位后、第一次计算：
+  // PID的计时与微分状态、上次误差都已过时，先复位，本周期误差变化率按 0 计
+  bool externalOutput = !pidEngaged || previousOutput != pidOutput;
+  if (externalOutput) {
+    pidController.reset();
+    lastError = error;
+  }
+  float dt = toFloat(pidController.elapsed(now)); // 实测间隔 (s)
+  
+  // 按模式与浓度档位调度参数，再按误差及其变化率调整 Kp
+  bool scheduleChanged = updateGainSchedule(sensors.pollutionLevel);
+  adjustPIDWithFuzzyLogic(error, (error - lastError) / dt);
+  lastError = error;
+  
+  // 参数切换或接管执行器：从当前输出无扰接续
+  if (scheduleChanged || externalOutput) {
+    pidController.track(PIDValue(previousOutput), PIDValue(twin.optimalSetpoint), PIDValue(sensors.pollutionLevel));
+    transferCount++;
+  }
   
   // 使用PID控制器
-  float output = pidController.compute(twin.optimalSetpoint, sensors.pollutionLevel, dt);
+  float output = toFloat(pidController.compute(PIDValue(twin.optimalSetpoint), PIDValue(sensors.pollutionLevel), now));
   
   // 应用输出限制
   output = constrain(output, 0.0f, 100.0f);
+  pidOutput = output;
+  pidEngaged = true;
   
   // 更新跟踪误差
   trackingError = fabs(error);
@@ -132,7 +238,63 @@ float ControlSystem::adaptiveFuzzyPID(const SensorData& sensors, const DigitalTw
 }
 
 void ControlSystem::updatePIDParameters(float Kp, float Ki, float Kd) {
-  pidController.setParameters(Kp, Ki, Kd);
+  baseKp = Kp;
+  baseKi = Ki;
+  baseKd = Kd;
+  
+  // 下一周期按新的基准参数重新调度（并无扰切换）
+  scheduleMode = 0xFF;
+}
+
+void ControlSystem::getPIDParameters(float& Kp, float& Ki, float& Kd) const {
+  Kp = baseKp;
+  Ki = baseKi;
+  Kd = baseKd;
+}
+
+bool ControlSystem::startAutotune(float setpoint) {
+  return autotuner.start(setpoint, previousOutput, millis());
+}
+
+void ControlSystem::abortAutotune() {
+  autotuner.abort();
+}
+
+const RelayAutotuner& ControlSystem::getAutotuner() const {
+  return autotuner;
+}
+
+uint8_t ControlSystem::getScheduleBand() const {
+  return scheduleBand;
+}
+
+uint16_t ControlSystem::getTransferCount() const {
+  return transferCount;
+}
+
+bool ControlSystem::updateGainSchedule(float pollution) {
+  // 档位边界加滞回，避免浓度在边界附近时反复切换
+  static const float bounds[GAIN_SCHEDULE_BANDS - 1] = { GAIN_SCHEDULE_BAND_LOW, GAIN_SCHEDULE_BAND_HIGH };
+  uint8_t band = scheduleBand;
+  if (band >= GAIN_SCHEDULE_BANDS) {
+    band = 0;
+    while (band < GAIN_SCHEDULE_BANDS - 1 && pollution >= bounds[band]) band++;
+  } else {
+    while (band < GAIN_SCHEDULE_BANDS - 1 && pollution > bounds[band] + GAIN_SCHEDULE_HYSTERESIS) band++;
+    while (band > 0 && pollution < bounds[band - 1] - GAIN_SCHEDULE_HYSTERESIS) band--;
+  }
+  
+  uint8_t mode = min(static_cast<uint8_t>(currentMode), static_cast<uint8_t>(MAINTENANCE));
+  if (mode == scheduleMode && band == scheduleBand) return false;
+  scheduleMode = mode;
+  scheduleBand = band;
+  
+  GainScheduleEntry entry;
+  memcpy_P(&entry, &GAIN_SCHEDULE[mode][band], sizeof(GainScheduleEntry));
+  scheduledKp = baseKp * entry.kp * GAIN_SCHEDULE_UNIT;
+  scheduledKi = baseKi * entry.ki * GAIN_SCHEDULE_UNIT;
+  scheduledKd = baseKd * entry.kd * GAIN_SCHEDULE_UNIT;
+  return true;
 }
 
 void ControlSystem::updateFuzzyParameters(const LearningData& learningData) {
@@ -158,6 +320,10 @@ void ControlSystem::reset() {
   controlEffort = 0.0f;
   trackingError = 0.0f;
   energyConsumption = 0.0f;
+  lastError = 0.0f;
+  pidEngaged = false;
+  abortAutotune();
+  pidController.reset();
   lastControlTime = millis();
 }
 
@@ -169,21 +335,26 @@ ControlMode ControlSystem::selectOptimalMode(const SensorData& sensors, const Di
   return STANDARD;
 }
 
-float ControlSystem::evaluateControlCost(float control, const SensorData& sensors, 
-                                         const DigitalTwinData& twin, ControlMode mode) const {
-  // 简化成本评估
-  float pollutionCost = fabs(twin.predictedPollution - control * 0.5f - TARGET_POLLUTION);
-  float energyCost = control * 0.8f;
-  float lifeCost = control > 80.0f ? (control - 80.0f) * 2.0f : 0.0f;
-  
-  return pollutionCost + energyCost + lifeCost;
-}
-
 void ControlSystem::adjustPIDWithFuzzyLogic(float error, float errorChange) {
-  // 简化模糊逻辑调整
+  // 映射到论域 0-100，超出满量程的按边界处理
+  float input1 = 50.0f + 50.0f * error / FUZZY_ERROR_RANGE;
+  float input2 = 50.0f + 50.0f * errorChange / FUZZY_RATE_RANGE;
+  float factor = fuzzySystem.evaluate(input1, input2);
+  
+  pidController.setParameters(PIDValue(scheduledKp * factor), PIDValue(scheduledKi), PIDValue(scheduledKd));
 }
 
 void ControlSystem::handleModeTransition(ControlMode newMode) {
+  // 进入MPC模式时重新估计扰动，上次的解与工作集不沿用
+  if (newMode == HIGH_EFFICIENCY && previousMode != HIGH_EFFICIENCY) {
+    predictiveController.reset();
+  }
+  
+  // 切换到该模式的模糊规则库（只改指针并重新采样控制曲面）
+  if (newMode != previousMode && newMode <= MAINTENANCE) {
+    fuzzySystem.setRuleBase(&FUZZY_RULE_BASES[newMode]);
+  }
+  
   // 模式切换处理
   if (DEBUG_MODE) {
     Serial.print("控制模式切换: ");
@@ -191,4 +362,25 @@ void ControlSystem::handleModeTransition(ControlMode newMode) {
     Serial.print(" -> ");
     Serial.println((int)newMode);
   }
+}
+
+void ControlSystem::saveGains() const {
+  float gains[3] = { baseKp, baseKi, baseKd };
+  EEPROM.put(PID_EEPROM_ADDR, gains);
+  EEPROM.update(PID_EEPROM_ADDR + sizeof(gains), gainsChecksum(gains));
+}
+
+bool ControlSystem::loadGains() {
+  float gains[3];
+  EEPROM.get(PID_EEPROM_ADDR, gains);
+  if (EEPROM.read(PID_EEPROM_ADDR + sizeof(gains)) != gainsChecksum(gains)) return false;
+  
+  // 增益须非负且在合理范围内（也排除 NaN）
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!(gains[i] >= 0.0f && gains[i] < 1000.0f)) return false;
+  }
+  baseKp = gains[0];
+  baseKi = gains[1];
+  baseKd = gains[2];
+  return true;
 }
\ No newline at end of file
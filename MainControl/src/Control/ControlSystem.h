@@ -7,6 +7,9 @@
 #include "../Core/SystemConfig.h"
 #include "PIDController.h"
 #include "FuzzyLogic.h"
+#include "PredictiveController.h"
+#include "ExplicitController.h"
+#include "RelayAutotuner.h"
 
 class ControlSystem {
 private:
@@ -16,6 +19,24 @@ private:
   // 控制器
   PIDController pidController;
   FuzzyLogicSystem fuzzySystem;
+  float baseKp;                         // 模糊调整前的基准增益
+  float baseKi;
+  float baseKd;
+  float lastError;
+  
+  // 增益调度：当前所用的 [模式][浓度档位] 与调度后的参数；
+  // 档位或模式改变、或执行器由其他控制律驱动过（输出与PID上次输出不同）、复位后与第一次计算时无扰切换
+  uint8_t scheduleMode;
+  uint8_t scheduleBand;
+  float scheduledKp;
+  float scheduledKi;
+  float scheduledKd;
+  float pidOutput;
+  bool pidEngaged;                      // PID计算过且之后没有复位
+  uint16_t transferCount;
+  
+  // 继电反馈自整定，进行中时代替各模式的控制律
+  RelayAutotuner autotuner;
   
   // 控制模式
   ControlMode currentMode;
@@ -25,9 +46,11 @@ private:
   float controlOutput;
   float previousOutput;
   
-  // MPC参数
-  float predictionHorizon;
-  float controlHorizon;
+  // MPC控制器（在线求解与显式查表）与线性化所用的反应速率（数字孪生的反应速率×催化剂活性）
+  PredictiveController predictiveController;
+  ExplicitController explicitController;
+  float reactionRate;
+  float steadyOutput;                   // 显式MPC线性化所用的稳态输出（上一周期的估计）
   
   // 性能指标
   float controlEffort;
@@ -68,8 +91,23 @@ public:
   // 自适应模糊PID控制
   float adaptiveFuzzyPID(const SensorData& sensors, const DigitalTwinData& twin);
   
+  // 数字孪生更新后的反应模型，MPC在当前工作点线性化
+  void setReactorModel(const SystemModel& model);
+  PredictiveController& getPredictiveController();
+  const ExplicitController& getExplicitController() const;
+  
   // 更新控制器参数
   void updatePIDParameters(float Kp, float Ki, float Kd);
+  void getPIDParameters(float& Kp, float& Ki, float& Kd) const;
+  
+  // 增益调度状态
+  uint8_t getScheduleBand() const;
+  uint16_t getTransferCount() const;
+  
+  // 继电反馈自整定：以当前输出为中心在 setpoint 附近振荡，完成后写入并保存PID参数
+  bool startAutotune(float setpoint);
+  void abortAutotune();
+  const RelayAutotuner& getAutotuner() const;
   void updateFuzzyParameters(const LearningData& learningData);
   
   // 获取控制性能指标
@@ -84,15 +122,21 @@ private:
   // 选择最优控制模式
   ControlMode selectOptimalMode(const SensorData& sensors, const DigitalTwinData& twin) const;
   
-  // 评估控制成本
-  float evaluateControlCost(float control, const SensorData& sensors, 
-                           const DigitalTwinData& twin, ControlMode mode) const;
+  // 反应速率按数字孪生物理模型随流速和光照变化（按每秒计）
+  float reactorBaseRate(const SensorData& sensors) const;
   
   // 调整PID参数（模糊逻辑）
   void adjustPIDWithFuzzyLogic(float error, float errorChange);
   
+  // 按模式与浓度档位更新调度参数，返回是否改变
+  bool updateGainSchedule(float pollution);
+  
   // 模式切换处理
   void handleModeTransition(ControlMode newMode);
+  
+  // PID基准参数的EEPROM存取（PID_EEPROM_ADDR），数据无效时返回 false
+  void saveGains() const;
+  bool loadGains();
 };
 
 #endif // CONTROL_SYSTEM_H
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "ExplicitController.h"
+
+#if MPC_EXPLICIT
+#include "ExplicitMpcTable.h"
+
+// 表格按生成时的MPC参数求解，参数改变后必须重新生成
+static constexpr bool matches(double x, double y) {
+  return x - y < 1e-4 && y - x < 1e-4;
+}
+static_assert(EXPLICIT_MPC_HORIZON == MPC_HORIZON && EXPLICIT_MPC_BLOCKS == MPC_BLOCKS &&
+              matches(EXPLICIT_MPC_TRACKING_WEIGHT, MPC_TRACKING_WEIGHT) &&
+              matches(EXPLICIT_MPC_MOVE_WEIGHT, MPC_MOVE_WEIGHT) &&
+              matches(EXPLICIT_MPC_ENERGY_WEIGHT, MPC_ENERGY_WEIGHT) &&
+              matches(EXPLICIT_MPC_MAX_RATE, MPC_MAX_RATE) &&
+              matches(EXPLICIT_MPC_STRESS_GAIN, MPC_STRESS_GAIN) &&
+              matches(EXPLICIT_MPC_TARGET, TARGET_POLLUTION) &&
+              EXPLICIT_MPC_CONTROL_INTERVAL == CONTROL_INTERVAL,
+              "ExplicitMpcTable.h 与当前MPC参数不一致，请用 'mpc table' 命令或 make table 重新生成");
+static_assert(matches(EXPLICIT_MPC_RATE_MIN, MPC_TABLE_RATE_MIN) &&
+              matches(EXPLICIT_MPC_RATE_MAX, MPC_TABLE_RATE_MAX) &&
+              EXPLICIT_MPC_RATE_POINTS == MPC_TABLE_RATE_POINTS &&
+              EXPLICIT_MPC_OUTPUT_POINTS == MPC_TABLE_OUTPUT_POINTS &&
+              matches(EXPLICIT_MPC_ERROR_MIN, MPC_TABLE_ERROR_MIN) &&
+              matches(EXPLICIT_MPC_ERROR_MAX, MPC_TABLE_ERROR_MAX) &&
+              EXPLICIT_MPC_ERROR_POINTS == MPC_TABLE_ERROR_POINTS,
+              "ExplicitMpcTable.h 与当前表格网格不一致，请用 'mpc table' 命令或 make table 重新生成");
+#endif
+
+// 表格中控制量的单位 (%)
+static const float TABLE_SCALE = 0.01f;
+
+ExplicitController::ExplicitController()
+  : lastLookupTime(0),
+    lastInTable(false),
+    missCount(0) {
+}
+
+bool ExplicitController::compute(float baseRate, float steadyOutput, float previousOutput, float error,
+                                 float& output) {
+#if MPC_EXPLICIT
+  unsigned long start = micros();
+  
+  float position[4];
+  position[0] = log(baseRate / MPC_TABLE_RATE_MIN) / log(MPC_TABLE_RATE_MAX / MPC_TABLE_RATE_MIN) *
+                (RATE_POINTS - 1);
+  position[3] = (error - MPC_TABLE_ERROR_MIN) / (MPC_TABLE_ERROR_MAX - MPC_TABLE_ERROR_MIN) * (ERROR_POINTS - 1);
+  lastInTable = position[0] >= 0.0f && position[0] <= RATE_POINTS - 1 &&
+                position[3] >= 0.0f && position[3] <= ERROR_POINTS - 1;
+  if (!lastInTable) {
+    missCount++;
+    return false;
+  }
+  
+  // 稳态输出超出 0-100% 时负荷已无法抵消，与边界上的解相同
+  position[1] = constrain(steadyOutput, 0.0f, 100.0f) / 100.0f * (OUTPUT_POINTS - 1);
+  position[2] = constrain(previousOutput, 0.0f, 100.0f) / 100.0f * (OUTPUT_POINTS - 1);
+  
+  output = lookup(position, previousOutput);
+  
+  lastLookupTime = micros() - start;
+  return true;
+#else
+  lastInTable = false;
+  return false;
+#endif
+}
+
+bool ExplicitController::acceptsSetpoint(float setpoint) {
+#if MPC_EXPLICIT
+  if (fabs(setpoint - EXPLICIT_MPC_TARGET) <= MPC_TABLE_TARGET_TOLERANCE) {
+    return true;
+  }
+  missCount++;
+#endif
+  lastInTable = false;
+  return false;
+}
+
+bool ExplicitController::wasInTable() const {
+  return lastInTable;
+}
+
+unsigned long ExplicitController::getLastLookupTime() const {
+  return lastLookupTime;
+}
+
+uint16_t ExplicitController::getMissCount() const {
+  return missCount;
+}
+
+void ExplicitController::reactorModel(float baseRate, float output, float concentration, float& a, float& b) {
+  float rate = max(baseRate * (1.0f + MPC_STRESS_GAIN * output / 100.0f), 1e-4f);
+  float step = CONTROL_INTERVAL / 1000.0f;
+  a = exp(-rate * step);
+  b = -(1.0f - a) / rate * baseRate * MPC_STRESS_GAIN / 100.0f * max(concentration, 1.0f);
+}
+
+float ExplicitController::rateAt(uint8_t index) {
+  return MPC_TABLE_RATE_MIN * pow(MPC_TABLE_RATE_MAX / MPC_TABLE_RATE_MIN,
+                                  static_cast<float>(index) / (RATE_POINTS - 1));
+}
+
+float ExplicitController::outputAt(uint8_t index) {
+  return 100.0f * index / (OUTPUT_POINTS - 1);
+}
+
+float ExplicitController::errorAt(uint8_t index) {
+  return MPC_TABLE_ERROR_MIN + (MPC_TABLE_ERROR_MAX - MPC_TABLE_ERROR_MIN) * index / (ERROR_POINTS - 1);
+}
+
+float ExplicitController::solvePoint(PredictiveController& solver, float baseRate, float steadyOutput,
+                                     float previousOutput, float error) {
+  // 扰动取为使稳态输出恰好维持设定值的值
+  float a, b;
+  reactorModel(baseRate, steadyOutput, TARGET_POLLUTION, a, b);
+  solver.setModel(a, b, 0.0f);
+  float estimate = (1.0f - a) * TARGET_POLLUTION - b * steadyOutput;
+  return solver.plan(TARGET_POLLUTION + error, estimate, TARGET_POLLUTION, previousOutput);
+}
+
+float ExplicitController::verifyTable(PredictiveController& solver, float& rmsError) {
+  float maxError = 0.0f;
+  float sumSquares = 0.0f;
+  uint32_t count = 0;
+#if MPC_EXPLICIT
+  for (uint8_t r = 0; r + 1 < RATE_POINTS; r++) {
+    float baseRate = sqrt(rateAt(r) * rateAt(r + 1));
+    for (uint8_t s = 0; s + 1 < OUTPUT_POINTS; s++) {
+      float steadyOutput = 0.5f * (outputAt(s) + outputAt(s + 1));
+      for (uint8_t p = 0; p + 1 < OUTPUT_POINTS; p++) {
+        float previousOutput = 0.5f * (outputAt(p) + outputAt(p + 1));
+        for (uint8_t e = 0; e + 1 < ERROR_POINTS; e++) {
+          float error = 0.5f * (errorAt(e) + errorAt(e + 1));
+          float exact = solvePoint(solver, baseRate, steadyOutput, previousOutput, error);
+          
+          float position[4] = { r + 0.5f, s + 0.5f, p + 0.5f, e + 0.5f };
+          float difference = fabs(lookup(position, previousOutput) - exact);
+          maxError = max(maxError, difference);
+          sumSquares += difference * difference;
+          count++;
+        }
+      }
+    }
+  }
+#endif
+  rmsError = count > 0 ? sqrt(sumSquares / count) : 0.0f;
+  return maxError;
+}
+
+void ExplicitController::generateTable(PredictiveController& solver, void (*writeLine)(const String& line)) {
+  // 每个 (k0, 稳态输出) 只预计算一次
+  writeLine("// 显式MPC查找表，由 'mpc table' 命令或 make table 生成，请勿手工修改");
+  writeLine("// 下标 [k0][稳态输出][上次输出][跟踪误差]，单位 0.01%");
+  writeLine("#ifndef EXPLICIT_MPC_TABLE_H");
+  writeLine("#define EXPLICIT_MPC_TABLE_H");
+  writeLine("");
+  writeLine("#define EXPLICIT_MPC_HORIZON " + String(MPC_HORIZON));
+  writeLine("#define EXPLICIT_MPC_BLOCKS " + String(MPC_BLOCKS));
+  writeLine("#define EXPLICIT_MPC_TRACKING_WEIGHT " + String(MPC_TRACKING_WEIGHT, 4));
+  writeLine("#define EXPLICIT_MPC_MOVE_WEIGHT " + String(MPC_MOVE_WEIGHT, 4));
+  writeLine("#define EXPLICIT_MPC_ENERGY_WEIGHT " + String(MPC_ENERGY_WEIGHT, 4));
+  writeLine("#define EXPLICIT_MPC_MAX_RATE " + String(MPC_MAX_RATE, 4));
+  writeLine("#define EXPLICIT_MPC_STRESS_GAIN " + String(MPC_STRESS_GAIN, 4));
+  writeLine("#define EXPLICIT_MPC_TARGET " + String(TARGET_POLLUTION, 4));
+  writeLine("#define EXPLICIT_MPC_CONTROL_INTERVAL " + String(CONTROL_INTERVAL));
+  writeLine("#define EXPLICIT_MPC_RATE_MIN " + String(MPC_TABLE_RATE_MIN, 4));
+  writeLine("#define EXPLICIT_MPC_RATE_MAX " + String(MPC_TABLE_RATE_MAX, 4));
+  writeLine("#define EXPLICIT_MPC_RATE_POINTS " + String(MPC_TABLE_RATE_POINTS));
+  writeLine("#define EXPLICIT_MPC_OUTPUT_POINTS " + String(MPC_TABLE_OUTPUT_POINTS));
+  writeLine("#define EXPLICIT_MPC_ERROR_MIN " + String(MPC_TABLE_ERROR_MIN, 4));
+  writeLine("#define EXPLICIT_MPC_ERROR_MAX " + String(MPC_TABLE_ERROR_MAX, 4));
+  writeLine("#define EXPLICIT_MPC_ERROR_POINTS " + String(MPC_TABLE_ERROR_POINTS));
+  writeLine("");
+  writeLine("static const int16_t EXPLICIT_MPC_TABLE[" + String(TABLE_SIZE) + "] PROGMEM = {");
+  for (uint8_t r = 0; r < RATE_POINTS; r++) {
+    float baseRate = rateAt(r);
+    for (uint8_t s = 0; s < OUTPUT_POINTS; s++) {
+      float steadyOutput = outputAt(s);
+      writeLine("  // k0 = " + String(baseRate, 4) + ", 稳态输出 " + String(steadyOutput, 0) + "%");
+      for (uint8_t p = 0; p < OUTPUT_POINTS; p++) {
+        String line = " ";
+        for (uint8_t e = 0; e < ERROR_POINTS; e++) {
+          float output = solvePoint(solver, baseRate, steadyOutput, outputAt(p), errorAt(e));
+          line += " " + String(static_cast<int16_t>(lround(output * 100.0f))) + ",";
+        }
+        writeLine(line);
+      }
+    }
+  }
+  writeLine("};");
+  writeLine("");
+  writeLine("#endif // EXPLICIT_MPC_TABLE_H");
+}
+
+float ExplicitController::lookup(const float position[4], float previousOutput) {
+  // 插值结果在格点之间仍须满足第一步的约束
+  return constrain(interpolate(position), max(0.0f, previousOutput - MPC_MAX_RATE),
+                   min(100.0f, previousOutput + MPC_MAX_RATE));
+}
+
+float ExplicitController::interpolate(const float position[4]) {
+#if MPC_EXPLICIT
+  static const uint8_t points[4] = { RATE_POINTS, OUTPUT_POINTS, OUTPUT_POINTS, ERROR_POINTS };
+  static const uint16_t stride[4] = {
+    static_cast<uint16_t>(OUTPUT_POINTS) * OUTPUT_POINTS * ERROR_POINTS,
+    static_cast<uint16_t>(OUTPUT_POINTS) * ERROR_POINTS,
+    ERROR_POINTS,
+    1
+  };
+  
+  // 所在单元的起点与单元内的比例
+  uint16_t base = 0;
+  float fraction[4];
+  for (uint8_t d = 0; d < 4; d++) {
+    uint8_t cell = min(static_cast<uint8_t>(position[d]), static_cast<uint8_t>(points[d] - 2));
+    fraction[d] = position[d] - cell;
+    base += cell * stride[d];
+  }
+  
+  // 单元 16 个顶点的加权和
+  float result = 0.0f;
+  for (uint8_t corner = 0; corner < 16; corner++) {
+    float weight = 1.0f;
+    uint16_t index = base;
+    for (uint8_t d = 0; d < 4; d++) {
+      if (corner & (1 << d)) {
+        weight *= fraction[d];
+        index += stride[d];
+      } else {
+        weight *= 1.0f - fraction[d];
+      }
+    }
+    result += weight * static_cast<int16_t>(pgm_read_word(&EXPLICIT_MPC_TABLE[index]));
+  }
+  return result * TABLE_SCALE;
+#else
+  return 0.0f;
+#endif
+}
\ No newline at end of file
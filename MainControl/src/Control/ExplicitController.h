@@ -0,0 +1,67 @@
+#ifndef EXPLICIT_CONTROLLER_H
+#define EXPLICIT_CONTROLLER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+#include "PredictiveController.h"
+
+// 显式模型预测控制
+// PredictiveController 的二次规划只依赖少数几个参数：离线在参数网格上逐点求解，
+// 第一步控制量存为闪存中的查找表（ExplicitMpcTable.h，由 'mpc table' 命令或主机测试的 make table 生成），
+// 运行时按四维多线性插值，计算量为常数，与时域、分块数和约束数无关。
+// 参数：基础反应速率 k0（对数刻度）、当前负荷下维持设定值所需的稳态输出、
+// 上次输出（变化量约束与代价）、跟踪误差（测量值 - 设定值）。
+// 模型在 TARGET_POLLUTION 与稳态输出处线性化，扰动估计仍由 PredictiveController 在线完成；
+// 设定值与 TARGET_POLLUTION 相差超过 MPC_TABLE_TARGET_TOLERANCE 时模型不同，不能查表。
+class ExplicitController {
+public:
+  static const uint8_t RATE_POINTS = MPC_TABLE_RATE_POINTS;
+  static const uint8_t OUTPUT_POINTS = MPC_TABLE_OUTPUT_POINTS;
+  static const uint8_t ERROR_POINTS = MPC_TABLE_ERROR_POINTS;
+  static const uint16_t TABLE_SIZE = static_cast<uint16_t>(RATE_POINTS) * OUTPUT_POINTS * OUTPUT_POINTS * ERROR_POINTS;
+  
+private:
+  unsigned long lastLookupTime;         // (us)
+  bool lastInTable;
+  uint16_t missCount;                   // 超出表格范围或设定值不符、改为在线求解的次数
+  
+public:
+  ExplicitController();
+  
+  // 设定值是否与表格的线性化点一致；不一致时计为表外，由调用者在线求解
+  bool acceptsSetpoint(float setpoint);
+  
+  // 查表求本周期控制量；反应速率或误差超出表格范围时返回 false，由调用者在线求解
+  bool compute(float baseRate, float steadyOutput, float previousOutput, float error, float& output);
+  
+  bool wasInTable() const;
+  unsigned long getLastLookupTime() const;
+  uint16_t getMissCount() const;
+  
+  // 反应器 dC/dt = -k0·(1 + 增益·u/100)·C + 负荷 在 (u, C) 处线性化，按控制周期离散化
+  // （在线求解与表格共用）
+  static void reactorModel(float baseRate, float output, float concentration, float& a, float& b);
+  
+  // 网格坐标
+  static float rateAt(uint8_t index);
+  static float outputAt(uint8_t index);
+  static float errorAt(uint8_t index);
+  
+  // 以在线求解器求参数点上的控制量（生成与校验表格用），solver 需已按 MPC 参数配置；
+  // 连续求解同一 (k0, 稳态输出) 的点时只做一次预计算
+  static float solvePoint(PredictiveController& solver, float baseRate, float steadyOutput,
+                          float previousOutput, float error);
+  
+  // 在全部网格单元的中心比较查表与在线求解，返回最大误差，rmsError 为均方根误差 (%)
+  static float verifyTable(PredictiveController& solver, float& rmsError);
+  
+  // 逐点求解并逐行输出 ExplicitMpcTable.h 的内容（不含换行符）
+  static void generateTable(PredictiveController& solver, void (*writeLine)(const String& line));
+  
+private:
+  // 网格坐标系中的位置（各维 0..点数-1）上的多线性插值，并限制在第一步的约束内
+  static float lookup(const float position[4], float previousOutput);
+  static float interpolate(const float position[4]);
+};
+
+#endif // EXPLICIT_CONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,1214 @@
+// 显式MPC查找表，由 'mpc table' 命令或 make table 生成，请勿手工修改
+// 下标 [k0][稳态输出][上次输出][跟踪误差]，单位 0.01%
+#ifndef EXPLICIT_MPC_TABLE_H
+#define EXPLICIT_MPC_TABLE_H
+
+#define EXPLICIT_MPC_HORIZON 100
+#define EXPLICIT_MPC_BLOCKS 3
+#define EXPLICIT_MPC_TRACKING_WEIGHT 1.0000
+#define EXPLICIT_MPC_MOVE_WEIGHT 50.0000
+#define EXPLICIT_MPC_ENERGY_WEIGHT 0.0500
+#define EXPLICIT_MPC_MAX_RATE 5.0000
+#define EXPLICIT_MPC_STRESS_GAIN 2.0000
+#define EXPLICIT_MPC_TARGET 100.0000
+#define EXPLICIT_MPC_CONTROL_INTERVAL 100
+#define EXPLICIT_MPC_RATE_MIN 0.0050
+#define EXPLICIT_MPC_RATE_MAX 0.2000
+#define EXPLICIT_MPC_RATE_POINTS 9
+#define EXPLICIT_MPC_OUTPUT_POINTS 11
+#define EXPLICIT_MPC_ERROR_MIN -100.0000
+#define EXPLICIT_MPC_ERROR_MAX 300.0000
+#define EXPLICIT_MPC_ERROR_POINTS 13
+
+static const int16_t EXPLICIT_MPC_TABLE[14157] PROGMEM = {
+  // k0 = 0.0050, 稳态输出 0%
+  0, 0, 0, 0, 311, 500, 500, 500, 500, 500, 500, 500, 500,
+  510, 562, 673, 989, 1304, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1667, 1982, 2298, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2660, 2976, 3291, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3654, 3969, 4285, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4647, 4963, 5279, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5641, 5957, 6272, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6635, 6950, 7266, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7628, 7944, 8259, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8622, 8937, 9253, 9428, 9480, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9615, 9931, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 10%
+  0, 0, 0, 1, 314, 500, 500, 500, 500, 500, 500, 500, 500,
+  513, 564, 683, 995, 1308, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1676, 1989, 2301, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2670, 2982, 3295, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3663, 3976, 4288, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4657, 4970, 5282, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5651, 5963, 6276, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6644, 6957, 7269, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7638, 7950, 8263, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8632, 8944, 9257, 9428, 9480, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9625, 9938, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 20%
+  0, 0, 0, 8, 317, 500, 500, 500, 500, 500, 500, 500, 500,
+  515, 566, 692, 1001, 1311, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1686, 1995, 2305, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2679, 2989, 3298, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3673, 3982, 4292, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4667, 4976, 5286, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5660, 5970, 6279, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6654, 6963, 7273, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7648, 7957, 8267, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8641, 8951, 9260, 9428, 9479, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9635, 9944, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 30%
+  0, 0, 0, 14, 320, 500, 500, 500, 500, 500, 500, 500, 500,
+  517, 568, 701, 1008, 1314, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1695, 2001, 2308, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2689, 2995, 3301, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3682, 3989, 4295, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4676, 4983, 5289, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5670, 5976, 6283, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6664, 6970, 7276, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7657, 7964, 8270, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8651, 8957, 9264, 9428, 9479, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9645, 9951, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 40%
+  0, 0, 0, 20, 323, 500, 500, 500, 500, 500, 500, 500, 500,
+  520, 569, 710, 1014, 1317, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1704, 2008, 2311, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2698, 3001, 3305, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3692, 3995, 4299, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4685, 4989, 5292, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5679, 5983, 6286, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6673, 6976, 7280, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7667, 7970, 8274, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8660, 8964, 9267, 9428, 9478, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9654, 9958, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 50%
+  0, 0, 0, 26, 327, 500, 500, 500, 500, 500, 500, 500, 500,
+  522, 571, 719, 1020, 1320, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1713, 2014, 2314, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2707, 3007, 3308, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3701, 4001, 4302, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4695, 4995, 5296, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5688, 5989, 6289, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6682, 6983, 7283, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7676, 7977, 8277, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8670, 8970, 9271, 9428, 9477, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9664, 9964, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 60%
+  0, 0, 0, 32, 330, 500, 500, 500, 500, 500, 500, 500, 500,
+  524, 573, 728, 1026, 1323, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1722, 2020, 2317, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2716, 3014, 3311, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3710, 4007, 4305, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4704, 5001, 5299, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5698, 5995, 6293, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6691, 6989, 7286, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7685, 7983, 8280, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8679, 8977, 9274, 9428, 9477, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9673, 9970, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 70%
+  0, 0, 0, 38, 332, 500, 500, 500, 500, 500, 500, 500, 500,
+  526, 575, 737, 1032, 1326, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1731, 2026, 2320, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2725, 3019, 3314, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3719, 4013, 4308, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4713, 5007, 5302, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5706, 6001, 6296, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6700, 6995, 7290, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7694, 7989, 8284, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8688, 8983, 9278, 9428, 9476, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9682, 9977, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 80%
+  0, 0, 0, 44, 335, 500, 500, 500, 500, 500, 500, 500, 500,
+  528, 576, 746, 1037, 1329, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1740, 2031, 2323, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2734, 3025, 3317, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3727, 4019, 4311, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4721, 5013, 5305, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5715, 6007, 6299, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6709, 7001, 7293, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7703, 7995, 8287, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8697, 8989, 9281, 9428, 9476, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9691, 9983, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 90%
+  0, 0, 0, 49, 338, 500, 500, 500, 500, 500, 500, 500, 500,
+  530, 578, 754, 1043, 1332, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1748, 2037, 2326, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2742, 3031, 3320, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3736, 4025, 4314, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4730, 5019, 5308, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5724, 6013, 6302, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6718, 7007, 7296, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7712, 8001, 8290, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8706, 8995, 9284, 9427, 9475, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9700, 9989, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0050, 稳态输出 100%
+  0, 0, 0, 55, 341, 500, 500, 500, 500, 500, 500, 500, 500,
+  533, 580, 763, 1049, 1335, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1757, 2043, 2329, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2751, 3037, 3323, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3745, 4031, 4317, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4739, 5025, 5311, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5733, 6019, 6305, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6727, 7013, 7299, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7721, 8007, 8293, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8715, 9001, 9287, 9427, 9474, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9709, 9995, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 0%
+  0, 0, 0, 0, 471, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 506, 586, 980, 1456, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1964, 2440, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2949, 3425, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3933, 4409, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4918, 5394, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5902, 6379, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6887, 7363, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7871, 8348, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8856, 9332, 9472, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9841, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 10%
+  0, 0, 0, 10, 479, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 510, 589, 995, 1464, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1511, 1980, 2449, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2965, 3433, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3949, 4418, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4934, 5403, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5919, 6388, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6903, 7372, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7888, 8357, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8873, 9342, 9472, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9858, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 20%
+  0, 0, 0, 25, 487, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 515, 592, 1010, 1472, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1533, 1995, 2457, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2518, 2980, 3442, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3503, 3965, 4427, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4950, 5412, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5935, 6396, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6920, 7381, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7904, 8366, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8889, 9351, 9472, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9874, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 30%
+  0, 0, 0, 40, 495, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 519, 596, 1025, 1480, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1555, 2010, 2465, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2540, 2995, 3450, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3525, 3980, 4435, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4511, 4965, 5420, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5950, 6405, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6935, 7390, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7920, 8375, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8906, 9360, 9472, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9891, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 40%
+  0, 0, 0, 54, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 523, 599, 1040, 1487, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1577, 2025, 2473, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2562, 3010, 3458, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3547, 3995, 4443, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4532, 4980, 5428, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5518, 5966, 6414, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6503, 6951, 7399, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7936, 8384, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8921, 9369, 9472, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9907, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 50%
+  0, 0, 0, 68, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 528, 612, 1054, 1495, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1598, 2039, 2480, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2583, 3024, 3466, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3569, 4010, 4451, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4554, 4995, 5436, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5539, 5981, 6422, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6525, 6966, 7407, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7510, 7951, 8393, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8937, 9378, 9472, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9922, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 60%
+  0, 0, 0, 82, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 532, 633, 1067, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1618, 2053, 2488, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2604, 3039, 3473, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3590, 4024, 4459, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4575, 5010, 5444, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5561, 5995, 6430, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6546, 6981, 7415, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7532, 7966, 8401, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8517, 8952, 9386, 9471, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9503, 9937, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 70%
+  0, 0, 0, 95, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 535, 653, 1081, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1639, 2067, 2495, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2624, 3052, 3480, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3610, 4038, 4466, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4596, 5024, 5452, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5581, 6009, 6438, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6567, 6995, 7423, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7553, 7981, 8409, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8539, 8967, 9395, 9471, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9524, 9952, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 80%
+  0, 0, 0, 108, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 539, 672, 1094, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1658, 2080, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2644, 3066, 3487, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3630, 4052, 4473, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4616, 5038, 5459, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5602, 6023, 6445, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6588, 7009, 7431, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7574, 7995, 8417, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8559, 8981, 9400, 9471, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9545, 9967, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 90%
+  0, 0, 0, 121, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 543, 692, 1107, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1678, 2093, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2664, 3079, 3494, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3650, 4065, 4480, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4636, 5051, 5466, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5622, 6037, 6452, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6608, 7023, 7438, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7594, 8009, 8425, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8580, 8995, 9401, 9471, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9566, 9981, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0079, 稳态输出 100%
+  0, 0, 0, 133, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 547, 710, 1120, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1697, 2106, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2683, 3092, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3669, 4078, 4487, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4655, 5064, 5473, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5641, 6050, 6460, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6627, 7037, 7446, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7614, 8023, 8432, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8600, 9009, 9402, 9471, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9586, 9995, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 0%
+  0, 0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 544, 960, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1924, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2888, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3853, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4817, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5781, 6468, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6745, 7432, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7710, 8397, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8674, 9361, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9638, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 10%
+  0, 0, 0, 31, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 552, 995, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1960, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2925, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3890, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4855, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5820, 6491, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6785, 7456, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7750, 8421, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8714, 9386, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9679, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 20%
+  0, 0, 0, 64, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 560, 1030, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1995, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2961, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3926, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4892, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5857, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6823, 7479, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7788, 8444, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8754, 9410, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9719, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 30%
+  0, 0, 0, 97, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 567, 1063, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2029, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2995, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3961, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4927, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5894, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6860, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7826, 8466, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8792, 9413, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9758, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 40%
+  0, 0, 0, 129, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 574, 1096, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2062, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3029, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3995, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4962, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5929, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6895, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7862, 8488, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8828, 9416, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9795, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 50%
+  0, 0, 0, 160, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 581, 1127, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2094, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3061, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4028, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4995, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5963, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6930, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7897, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8864, 9418, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9831, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 60%
+  0, 0, 0, 189, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 587, 1157, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1526, 2125, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3092, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4060, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5028, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5995, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6963, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7931, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8899, 9421, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9866, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 70%
+  0, 0, 0, 218, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 601, 1186, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1569, 2154, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2538, 3122, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3506, 4091, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5059, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6027, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6995, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7964, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8932, 9423, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9900, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 80%
+  0, 0, 0, 245, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 642, 1214, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1611, 2183, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2580, 3152, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3549, 4120, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4517, 5089, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6058, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 7027, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7995, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8964, 9425, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9933, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 90%
+  0, 0, 0, 272, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 507, 682, 1241, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1652, 2210, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2621, 3180, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3590, 4149, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4559, 5118, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5529, 6088, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 7057, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 8026, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8995, 9427, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9965, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0126, 稳态输出 100%
+  0, 0, 0, 297, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 515, 721, 1267, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1691, 2237, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2660, 3207, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3630, 4177, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4600, 5146, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5570, 6116, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6540, 7086, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7509, 8056, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 9026, 9429, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9995, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 0%
+  0, 0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 920, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1843, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2767, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3691, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4614, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5538, 6451, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7374, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8298, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9222, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 10%
+  0, 0, 0, 70, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 504, 996, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1921, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2847, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3772, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4698, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5623, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6549, 7431, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8357, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9282, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 20%
+  0, 0, 0, 141, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 521, 1069, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1996, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2923, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3850, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4778, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5705, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6632, 7485, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7559, 8413, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9340, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 30%
+  0, 0, 0, 209, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 537, 1138, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2067, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2996, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3925, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4854, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5783, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6712, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7641, 8466, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8570, 9395, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 40%
+  0, 0, 0, 273, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 552, 1204, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2135, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3065, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3996, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4926, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5857, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6788, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7718, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8649, 9427, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9580, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 50%
+  0, 0, 0, 334, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 566, 1267, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2199, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3131, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4064, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4996, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5928, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6860, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7793, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8725, 9433, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9657, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 60%
+  0, 0, 0, 393, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 580, 1327, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1514, 2260, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3194, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4128, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5062, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5996, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6930, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7864, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8797, 9439, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9731, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 70%
+  0, 0, 0, 448, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 661, 1383, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1596, 2319, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2532, 3254, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4190, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5125, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6060, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6996, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7931, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8867, 9445, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9802, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 80%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 738, 1438, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1675, 2374, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2612, 3311, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3549, 4248, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5185, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6122, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 7059, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7996, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8933, 9450, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9870, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 90%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 812, 1489, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1751, 2427, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2689, 3366, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3627, 4304, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4566, 5242, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5504, 6181, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 7119, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 8057, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8996, 9455, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9934, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0199, 稳态输出 100%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 883, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1823, 2478, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2762, 3417, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3702, 4357, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4642, 5297, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5582, 6237, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6521, 7176, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 8116, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 9056, 9459, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9996, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 0%
+  0, 0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 854, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1711, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2568, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 4484, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 5341, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 6198, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7055, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7912, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8769, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9626, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 10%
+  0, 0, 0, 135, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 997, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1858, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2720, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3581, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 5454, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 6315, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7176, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8038, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8899, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9761, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 20%
+  0, 0, 0, 265, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 1131, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1997, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2862, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3728, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4593, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 6425, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7291, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8156, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9022, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9888, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 30%
+  0, 0, 0, 388, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 518, 1257, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2127, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2997, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3866, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4736, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5606, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7398, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8268, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9138, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 40%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 547, 1376, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2249, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3123, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3997, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4870, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5744, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6617, 7499, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8373, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9247, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 50%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 644, 1487, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1521, 2364, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3242, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4119, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4996, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5874, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6751, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7629, 8472, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8506, 9349, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 60%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 785, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1666, 2472, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2547, 3353, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4234, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5115, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5996, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6878, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7759, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8640, 9440, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9521, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 70%
+  0, 0, 33, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 918, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1802, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2687, 3457, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3572, 4342, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5227, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6112, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6996, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7881, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8766, 9453, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9651, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 80%
+  0, 0, 154, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 1042, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1930, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2819, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3707, 4443, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4595, 5332, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6220, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 7108, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7996, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8885, 9465, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9773, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 90%
+  0, 0, 267, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 501, 1159, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 2051, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2942, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3834, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4725, 5430, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5617, 6322, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6509, 7213, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 8105, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8996, 9476, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9888, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0316, 稳态输出 100%
+  0, 0, 374, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 595, 1269, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 2164, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 3058, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3953, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4848, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5743, 6417, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6638, 7312, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7533, 8207, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 9101, 9485, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9996, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 0%
+  0, 0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 773, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1549, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 3354, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 4130, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4906, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5681, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 7487, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 8262, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 9038, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9810, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 10%
+  0, 0, 0, 214, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 998, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1781, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2564, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 4319, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 5103, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5886, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6669, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 8424, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 9208, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9991, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 20%
+  0, 0, 0, 416, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 1207, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1998, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2788, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3579, 4496, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 5287, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 6078, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6868, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7659, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 9367, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 30%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 536, 1401, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 2199, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2997, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3796, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4594, 5459, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 6257, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7055, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7853, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8651, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 40%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 765, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1570, 2387, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 3192, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3997, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4803, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5608, 6424, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 7230, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8035, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8840, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9645, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 50%
+  0, 0, 166, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 978, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1790, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2602, 3373, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 4185, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4997, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5809, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6621, 7392, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 8204, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9016, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9828, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 60%
+  0, 0, 357, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 1176, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1994, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2813, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3632, 4360, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 5179, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5997, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6816, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7635, 8363, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 9181, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 70%
+  0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 671, 1359, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 2184, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 3009, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3834, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4659, 5347, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 6172, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6997, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7822, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8647, 9335, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 80%
+  0, 47, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 878, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1709, 2359, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2541, 3191, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 4022, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4853, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5685, 6334, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6516, 7166, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7997, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8828, 9460, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9660, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 90%
+  0, 232, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 1070, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1907, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2744, 3359, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3582, 4196, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 5033, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5871, 6485, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6708, 7322, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7545, 8160, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8997, 9480, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9834, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0501, 稳态输出 100%
+  0, 416, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  666, 1247, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1509, 2090, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2933, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3776, 4357, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4620, 5200, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 6044, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6887, 7468, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7730, 8311, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8573, 9154, 9498, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9997, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 0%
+  0, 0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 703, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1500, 2259, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 2963, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3665, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4500, 5223, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5900, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6504, 7480, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 8135, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8790, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 10%
+  0, 0, 0, 284, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 998, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1713, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 3222, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3936, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4647, 5445, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 6159, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6843, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 8371, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 9039, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9682, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 20%
+  0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 533, 1274, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1998, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2723, 3463, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 4188, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4913, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5634, 6377, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 7102, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7795, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 9275, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9955, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 30%
+  0, 0, 104, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 839, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1573, 2264, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2998, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3733, 4423, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 5158, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5892, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6624, 7317, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 8052, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8754, 9477, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 40%
+  0, 0, 378, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 1121, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1865, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2610, 3254, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3998, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4743, 5386, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 6131, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6875, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7618, 8263, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 9008, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9720, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 50%
+  0, 26, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 781, 1381, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1535, 2135, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2889, 3490, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3643, 4244, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4998, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5752, 6353, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6506, 7107, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7861, 8461, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8614, 9215, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9970, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 60%
+  0, 326, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 1060, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1823, 2384, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2586, 3147, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3910, 4471, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4674, 5234, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5998, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6761, 7322, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7525, 8085, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8849, 9409, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9612, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 70%
+  47, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  792, 1344, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1564, 2088, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2860, 3384, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3633, 4157, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4929, 5453, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5702, 6225, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6998, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7770, 8294, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8543, 9066, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9839, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 80%
+  344, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1087, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1841, 2357, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2623, 3112, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3893, 4383, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4675, 5164, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5946, 6435, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6727, 7216, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7508, 7998, 8487, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8779, 9268, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9560, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 90%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1372, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2121, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2885, 3367, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3675, 4133, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4922, 5380, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5712, 6170, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6502, 6960, 7418, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7750, 8208, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8540, 8998, 9455, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9788, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.0795, 稳态输出 100%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2392, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3150, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3923, 4373, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4721, 5150, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5520, 5948, 6376, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6746, 7174, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7544, 7973, 8401, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8771, 9199, 9496, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9569, 9997, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 0%
+  0, 0, 0, 0, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 655, 1302, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1500, 1958, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 2553, 3235, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3500, 3823, 4486, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4500, 4500, 5074, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5525, 6325, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 6836, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 8146, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 9414, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9808, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 10%
+  0, 0, 0, 331, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 999, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1667, 2260, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 2928, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3536, 4166, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4500, 4768, 5376, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5978, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 7189, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7671, 8399, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8921, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 20%
+  0, 0, 95, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 774, 1319, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1999, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2678, 3224, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3903, 4449, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4526, 5106, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5724, 6281, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6899, 7456, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 8074, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8542, 9249, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9741, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 30%
+  0, 0, 472, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 613, 1115, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1806, 2308, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2999, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3690, 4191, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4883, 5384, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5523, 6056, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6679, 7200, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7833, 8345, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8978, 9489, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 40%
+  0, 349, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  512, 983, 1469, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1670, 2131, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2834, 3296, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3537, 3999, 4460, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4701, 5163, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5866, 6327, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6526, 7014, 7484, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7646, 8132, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8767, 9250, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9887, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 50%
+  281, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  922, 1371, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1584, 2018, 2462, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2719, 3145, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3859, 4284, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4573, 4999, 5424, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5713, 6138, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6852, 7278, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7533, 7979, 8412, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8624, 9074, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9714, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 60%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1319, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1970, 2385, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2647, 3046, 3452, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3762, 4155, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4880, 5273, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5606, 5998, 6391, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6724, 7117, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7842, 8235, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8543, 8950, 9349, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9609, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 70%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2346, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3009, 3392, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3700, 4069, 4439, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4799, 5162, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5536, 5899, 6262, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6635, 6998, 7361, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7735, 8098, 8461, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8834, 9197, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9555, 9927, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 80%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3364, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4041, 4394, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4748, 5087, 5428, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5832, 6168, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6579, 6915, 7251, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7662, 7998, 8334, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8745, 9081, 9418, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9828, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 90%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4375, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  5067, 5392, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5790, 6102, 6418, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6548, 6860, 7171, 7483, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7617, 7929, 8241, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8686, 8998, 9310, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9755, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.1261, 稳态输出 100%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  5380, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  6088, 6386, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6827, 7116, 7406, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7594, 7884, 8173, 8463, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8651, 8941, 9230, 9483, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9708, 9998, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 0%
+  0, 0, 0, 0, 492, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 500, 625, 1117, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1500, 1703, 2148, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 2500, 2602, 3141, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 4074, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4933, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5791, 6404, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6650, 7263, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7508, 8122,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  // k0 = 0.2000, 稳态输出 10%
+  0, 0, 0, 360, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 500, 558, 999, 1441, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1500, 1638, 2080, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2500, 2687, 3088, 3488, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3500, 3554, 4053, 4453, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4500, 4500, 4500, 4929, 5418, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5759, 6305, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6589, 7134, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7964, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8794,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  // k0 = 0.2000, 稳态输出 20%
+  0, 0, 321, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  500, 552, 949, 1347, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1500, 1601, 1999, 2397, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2500, 2651, 3049, 3447, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3500, 3677, 4040, 4402, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4500, 4524, 4982, 5345, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5500, 5822, 6288, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6632, 7119, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7929, 8416, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8740, 9226,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9550,
+  // k0 = 0.2000, 稳态输出 30%
+  71, 487, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  667, 996, 1326, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1500, 1615, 1975, 2334, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2500, 2640, 2999, 3358, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3500, 3664, 4023, 4383, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4500, 4672, 5001, 5331, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5500, 5509, 5927, 6257, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 6743, 7179, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7542, 7978, 8414, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8777, 9212, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9576, 10000,
+  // k0 = 0.2000, 稳态输出 40%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1113, 1492, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  1726, 2026, 2327, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2500, 2670, 2995, 3321, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3500, 3673, 3999, 4325, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4500, 4677, 5002, 5328, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5500, 5671, 5971, 6271, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6500, 6504, 6884, 7185, 7485, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7500, 7500, 7689, 8080, 8398, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8873, 9264, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9666, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 50%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2146, 2488, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  2775, 3050, 3325, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3500, 3716, 4012, 4309, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4500, 4702, 4999, 5295, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5500, 5689, 5985, 6282, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6500, 6673, 6947, 7222, 7497, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7500, 7508, 7851, 8126, 8401, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8500, 8500, 8652, 9005, 9305, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9797, 10000, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 60%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3170, 3478, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  3815, 4068, 4323, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4500, 4755, 5026, 5296, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5500, 5500, 5728, 5999, 6269, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6500, 6500, 6701, 6972, 7242, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7500, 7674, 7929, 8182, 8434, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8500, 8518, 8827, 9079, 9331, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9500, 9500, 9630, 9949, 10000, 10000, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 70%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4187, 4464, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  4849, 5081, 5322, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5541, 5789, 6036, 6284, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6500, 6503, 6751, 6999, 7246, 7494, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7500, 7500, 7713, 7961, 8208, 8456, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8500, 8675, 8916, 9148, 9380, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9500, 9531, 9809, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 80%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  5200, 5447, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  5876, 6091, 6318, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6590, 6817, 7045, 7272, 7499, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7500, 7544, 7771, 7998, 8226, 8453, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8500, 8500, 8725, 8952, 9179, 9407, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9500, 9500, 9679, 9905, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 90%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  6207, 6429, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  6899, 7104, 7313, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7633, 7842, 8051, 8260, 8470, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8500, 8580, 8789, 8998, 9207, 9417, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9500, 9527, 9736, 9945, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+  // k0 = 0.2000, 稳态输出 100%
+  500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500,
+  1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+  2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
+  3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
+  4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500, 4500,
+  5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500, 5500,
+  6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500, 6500,
+  7212, 7410, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500, 7500,
+  7921, 8114, 8307, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+  8670, 8863, 9056, 9249, 9442, 9500, 9500, 9500, 9500, 9500, 9500, 9500, 9500,
+  9500, 9612, 9805, 9998, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000,
+};
+
+#endif // EXPLICIT_MPC_TABLE_H
\ No newline at end of file
@@ -1,83 +1,82 @@
 #include "FuzzyLogic.h"
 
-FuzzyLogicSystem::FuzzyLogicSystem() : rules(nullptr), ruleCount(0) {
+FuzzyLogicSystem::FuzzyLogicSystem() : ruleBase(nullptr) {
   clearMembership();
+  buildSurface();
 }
 
-FuzzyLogicSystem::~FuzzyLogicSystem() {
-  if (rules != nullptr) {
-    delete[] rules;
-  }
+bool FuzzyLogicSystem::initialize(const RuleBase* base) {
+  setRuleBase(base);
+  return base != nullptr;
 }
 
-bool FuzzyLogicSystem::initialize(const MembershipParams& params, const FuzzyRule* rules, uint8_t count) {
-  setMembershipParams(params);
-  setRules(rules, count);
-  return true;
+void FuzzyLogicSystem::setRuleBase(const RuleBase* base) {
+  ruleBase = base;
+  buildSurface();
 }
 
-void FuzzyLogicSystem::setMembershipParams(const MembershipParams& params) {
-  membershipParams = params;
+const FuzzyLogicSystem::RuleBase* FuzzyLogicSystem::getRuleBase() const {
+  return ruleBase;
 }
 
-void FuzzyLogicSystem::setRules(const FuzzyRule* rules, uint8_t count) {
-  if (this->rules != nullptr) {
-    delete[] this->rules;
-  }
-  
-  if (count > 0 && rules != nullptr) {
-    this->rules = new FuzzyRule[count];
-    for (uint8_t i = 0; i < count; i++) {
-      this->rules[i] = rules[i];
-    }
-    ruleCount = count;
-  } else {
-    this->rules = nullptr;
-    ruleCount = 0;
+void FuzzyLogicSystem::calculateMembership(float inputValue) {
+  if (ruleBase == nullptr) {
+    clearMembership();
+    return;
   }
+  fuzzify(inputValue, membershipValues);
 }
 
-void FuzzyLogicSystem::calculateMembership(float inputValue) {
-  clearMembership();
+float FuzzyLogicSystem::infer(float input1, float input2) const {
+  if (ruleBase == nullptr) return 0.0f;
   
-  // 简化实现：使用三角隶属度函数
-  // 这里使用一个简化的方法，实际应该根据membershipParams计算
+  float membership1[5];
+  float membership2[5];
+  fuzzify(input1, membership1);
+  fuzzify(input2, membership2);
   
-  if (inputValue <= 25.0f) {
-    membershipValues[FUZZY_VERY_LOW] = 1.0f;
-  } else if (inputValue <= 50.0f) {
-    membershipValues[FUZZY_VERY_LOW] = (50.0f - inputValue) / 25.0f;
-    membershipValues[FUZZY_LOW] = (inputValue - 25.0f) / 25.0f;
-  } else if (inputValue <= 75.0f) {
-    membershipValues[FUZZY_LOW] = (75.0f - inputValue) / 25.0f;
-    membershipValues[FUZZY_MEDIUM] = (inputValue - 50.0f) / 25.0f;
-  } else if (inputValue <= 100.0f) {
-    membershipValues[FUZZY_MEDIUM] = (100.0f - inputValue) / 25.0f;
-    membershipValues[FUZZY_HIGH] = (inputValue - 75.0f) / 25.0f;
-  } else {
-    membershipValues[FUZZY_HIGH] = 1.0f;
+  // 同一输出等级的规则激活度相加，等价于逐条规则加权平均
+  float strengths[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+  uint8_t ruleCount = pgm_read_byte(&ruleBase->ruleCount);
+  if (ruleCount > MAX_RULES) ruleCount = MAX_RULES;
+  for (uint8_t i = 0; i < ruleCount; i++) {
+    FuzzyRule rule;
+    memcpy_P(&rule, &ruleBase->rules[i], sizeof(FuzzyRule));
+    if (rule.input1Level >= 5 || rule.input2Level >= 5 || rule.outputLevel >= 5) continue;
+    strengths[rule.outputLevel] += evaluateRule(rule, membership1[rule.input1Level],
+                                                membership2[rule.input2Level]);
   }
+  return defuzzify(strengths);
 }
 
-float FuzzyLogicSystem::infer(float input1, float input2) {
-  // 简化实现：返回输入的平均值
-  return (input1 + input2) / 2.0f;
+float FuzzyLogicSystem::evaluate(float input1, float input2) const {
+  float position1 = constrain(input1, 0.0f, 100.0f) * (SURFACE_POINTS - 1) / 100.0f;
+  float position2 = constrain(input2, 0.0f, 100.0f) * (SURFACE_POINTS - 1) / 100.0f;
+  uint8_t i = min(static_cast<uint8_t>(position1), static_cast<uint8_t>(SURFACE_POINTS - 2));
+  uint8_t j = min(static_cast<uint8_t>(position2), static_cast<uint8_t>(SURFACE_POINTS - 2));
+  float u = position1 - i;
+  float v = position2 - j;
+  
+  return (1.0f - u) * ((1.0f - v) * surface[i][j] + v * surface[i][j + 1]) +
+         u * ((1.0f - v) * surface[i + 1][j] + v * surface[i + 1][j + 1]);
 }
 
-float FuzzyLogicSystem::defuzzify(const float* outputValues) const {
+float FuzzyLogicSystem::defuzzify(const float* strengths) const {
+  if (ruleBase == nullptr) return 0.0f;
+  
   float numerator = 0.0f;
   float denominator = 0.0f;
   
   for (int i = 0; i < 5; i++) {
-    numerator += membershipValues[i] * outputValues[i];
-    denominator += membershipValues[i];
+    numerator += strengths[i] * pgm_read_float(&ruleBase->outputLevels[i]);
+    denominator += strengths[i];
   }
   
   if (denominator > 0.0f) {
     return numerator / denominator;
   }
   
-  return 0.5f; // 默认值
+  return pgm_read_float(&ruleBase->outputLevels[FUZZY_MEDIUM]); // 没有规则激活时取中间等级
 }
 
 const float* FuzzyLogicSystem::getMembershipValues() const {
@@ -90,6 +89,28 @@ void FuzzyLogicSystem::clearMembership() {
   }
 }
 
+void FuzzyLogicSystem::fuzzify(float inputValue, float values[5]) const {
+  // 参数在闪存中，按地址读取
+  const MembershipParams& params = ruleBase->membership;
+  const float* levels[5] = { params.veryLow, params.low, params.medium, params.high, params.veryHigh };
+  for (uint8_t i = 0; i < 5; i++) {
+    values[i] = triangleMF(inputValue, pgm_read_float(&levels[i][0]), pgm_read_float(&levels[i][1]));
+  }
+  
+  // 两端为肩形，超出最外侧中心后保持完全隶属
+  if (inputValue <= pgm_read_float(&levels[FUZZY_VERY_LOW][0])) values[FUZZY_VERY_LOW] = 1.0f;
+  if (inputValue >= pgm_read_float(&levels[FUZZY_VERY_HIGH][0])) values[FUZZY_VERY_HIGH] = 1.0f;
+}
+
+void FuzzyLogicSystem::buildSurface() {
+  for (uint8_t i = 0; i < SURFACE_POINTS; i++) {
+    float input1 = 100.0f * i / (SURFACE_POINTS - 1);
+    for (uint8_t j = 0; j < SURFACE_POINTS; j++) {
+      surface[i][j] = infer(input1, 100.0f * j / (SURFACE_POINTS - 1));
+    }
+  }
+}
+
 float FuzzyLogicSystem::triangleMF(float x, float center, float width) const {
   float left = center - width;
   float right = center + width;
@@ -3,9 +3,17 @@
 
 #include <Arduino.h>
 #include "../Core/CommonTypes.h"
+#include "../Core/SystemConfig.h"
 
+// 双输入零阶 Sugeno 模糊推理
+// 两个输入的论域均为 0-100，各有五个三角隶属度函数（两端为肩形），
+// 规则以“与”（取小）得到激活度，按输出等级的单点值加权平均得到输出。
+// 隶属度函数、输出等级与规则组成规则库，定义为闪存中的常量表（见 FuzzyRuleBases.h），
+// 推理时直接从闪存读取，切换规则库只改指针，不占用堆。
+// 切换规则库时把完整推理在 FUZZY_SURFACE_POINTS² 的网格上采样为控制曲面；
+// 每个控制周期只做一次双线性插值。
 class FuzzyLogicSystem {
-private:
+public:
   // 隶属度函数参数
   struct MembershipParams {
     float veryLow[2];    // [中心, 宽度]
@@ -23,34 +31,48 @@ private:
     float weight;
   };
   
-  MembershipParams membershipParams;
-  FuzzyRule* rules;
-  uint8_t ruleCount;
+  static const uint8_t MAX_RULES = 25;
+  
+  // 规则库（闪存中的常量表）
+  struct RuleBase {
+    MembershipParams membership;
+    float outputLevels[5];         // 各输出等级的单点值
+    uint8_t ruleCount;
+    FuzzyRule rules[MAX_RULES];
+  };
+  
+  static const uint8_t SURFACE_POINTS = FUZZY_SURFACE_POINTS;
+  
+private:
+  const RuleBase* ruleBase;        // 指向闪存
+  
+  // 控制曲面：surface[i][j] 为输入 (i, j) 号网格点上的推理结果
+  float surface[SURFACE_POINTS][SURFACE_POINTS];
   
   // 隶属度值
   float membershipValues[5];
   
 public:
   FuzzyLogicSystem();
-  ~FuzzyLogicSystem();
   
   // 初始化模糊系统
-  bool initialize(const MembershipParams& params, const FuzzyRule* rules, uint8_t count);
-  
-  // 设置隶属度函数参数
-  void setMembershipParams(const MembershipParams& params);
+  bool initialize(const RuleBase* base);
   
-  // 设置模糊规则
-  void setRules(const FuzzyRule* rules, uint8_t count);
+  // 切换规则库（base 须指向 PROGMEM 中的表），并重新采样控制曲面
+  void setRuleBase(const RuleBase* base);
+  const RuleBase* getRuleBase() const;
   
   // 计算隶属度
   void calculateMembership(float inputValue);
   
-  // 模糊推理
-  float infer(float input1, float input2);
+  // 完整模糊推理（逐条评估规则），未设置规则库时返回 0
+  float infer(float input1, float input2) const;
   
-  // 去模糊化（重心法）
-  float defuzzify(const float* outputValues) const;
+  // 控制曲面上双线性插值，控制周期内使用
+  float evaluate(float input1, float input2) const;
+  
+  // 去模糊化（重心法）：各输出等级的激活度对单点值加权平均
+  float defuzzify(const float* strengths) const;
   
   // 获取隶属度值
   const float* getMembershipValues() const;
@@ -59,6 +81,12 @@ public:
   void clearMembership();
   
 private:
+  // 五个隶属度函数在 inputValue 处的值
+  void fuzzify(float inputValue, float values[5]) const;
+  
+  // 重新采样控制曲面
+  void buildSurface();
+  
   // 计算三角隶属度函数
   float triangleMF(float x, float center, float width) const;
   
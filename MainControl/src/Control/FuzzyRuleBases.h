@@ -0,0 +1,79 @@
+// 各控制模式的模糊 Kp 调整规则库，存于闪存，按 ControlMode 索引
+// 输入1为跟踪误差，输入2为误差变化率（论域 0-100，各自 50 为零），输出为 Kp 倍数
+#ifndef FUZZY_RULE_BASES_H
+#define FUZZY_RULE_BASES_H
+
+#include "FuzzyLogic.h"
+
+static constexpr FuzzyLogicSystem::RuleBase FUZZY_RULE_BASES[] PROGMEM = {
+  // 节能：零附近隶属度函数加宽形成死区，增益整体偏低以减少执行器动作
+  {
+    { { 0.0f, 25.0f }, { 25.0f, 25.0f }, { 50.0f, 35.0f }, { 75.0f, 25.0f }, { 100.0f, 25.0f } },
+    { 0.5f, 0.7f, 0.85f, 1.0f, 1.2f },
+    25,
+    {
+      { 0, 0, FUZZY_HIGH, 1.0f }, { 0, 1, FUZZY_HIGH, 1.0f }, { 0, 2, FUZZY_MEDIUM, 1.0f }, { 0, 3, FUZZY_MEDIUM, 1.0f }, { 0, 4, FUZZY_MEDIUM, 1.0f },
+      { 1, 0, FUZZY_MEDIUM, 1.0f }, { 1, 1, FUZZY_MEDIUM, 1.0f }, { 1, 2, FUZZY_LOW, 1.0f }, { 1, 3, FUZZY_LOW, 1.0f }, { 1, 4, FUZZY_MEDIUM, 1.0f },
+      { 2, 0, FUZZY_LOW, 1.0f }, { 2, 1, FUZZY_VERY_LOW, 1.0f }, { 2, 2, FUZZY_VERY_LOW, 1.0f }, { 2, 3, FUZZY_VERY_LOW, 1.0f }, { 2, 4, FUZZY_LOW, 1.0f },
+      { 3, 0, FUZZY_MEDIUM, 1.0f }, { 3, 1, FUZZY_LOW, 1.0f }, { 3, 2, FUZZY_LOW, 1.0f }, { 3, 3, FUZZY_MEDIUM, 1.0f }, { 3, 4, FUZZY_MEDIUM, 1.0f },
+      { 4, 0, FUZZY_MEDIUM, 1.0f }, { 4, 1, FUZZY_MEDIUM, 1.0f }, { 4, 2, FUZZY_MEDIUM, 1.0f }, { 4, 3, FUZZY_HIGH, 1.0f }, { 4, 4, FUZZY_HIGH, 1.0f }
+    }
+  },
+  // 标准：误差大时加大 Kp 以快速消除，误差小且正在收敛时减小 Kp 以抑制超调
+  {
+    { { 0.0f, 25.0f }, { 25.0f, 25.0f }, { 50.0f, 25.0f }, { 75.0f, 25.0f }, { 100.0f, 25.0f } },
+    { 0.6f, 0.8f, 1.0f, 1.3f, 1.6f },
+    25,
+    {
+      { 0, 0, FUZZY_VERY_HIGH, 1.0f }, { 0, 1, FUZZY_VERY_HIGH, 1.0f }, { 0, 2, FUZZY_HIGH, 1.0f }, { 0, 3, FUZZY_MEDIUM, 1.0f }, { 0, 4, FUZZY_MEDIUM, 1.0f },
+      { 1, 0, FUZZY_HIGH, 1.0f }, { 1, 1, FUZZY_HIGH, 1.0f }, { 1, 2, FUZZY_MEDIUM, 1.0f }, { 1, 3, FUZZY_LOW, 1.0f }, { 1, 4, FUZZY_MEDIUM, 1.0f },
+      { 2, 0, FUZZY_MEDIUM, 1.0f }, { 2, 1, FUZZY_LOW, 1.0f }, { 2, 2, FUZZY_VERY_LOW, 1.0f }, { 2, 3, FUZZY_LOW, 1.0f }, { 2, 4, FUZZY_MEDIUM, 1.0f },
+      { 3, 0, FUZZY_MEDIUM, 1.0f }, { 3, 1, FUZZY_LOW, 1.0f }, { 3, 2, FUZZY_MEDIUM, 1.0f }, { 3, 3, FUZZY_HIGH, 1.0f }, { 3, 4, FUZZY_HIGH, 1.0f },
+      { 4, 0, FUZZY_MEDIUM, 1.0f }, { 4, 1, FUZZY_MEDIUM, 1.0f }, { 4, 2, FUZZY_HIGH, 1.0f }, { 4, 3, FUZZY_VERY_HIGH, 1.0f }, { 4, 4, FUZZY_VERY_HIGH, 1.0f }
+    }
+  },
+  // 高效：该模式由MPC控制，PID仅作后备，规则同标准模式、增益略高
+  {
+    { { 0.0f, 25.0f }, { 25.0f, 25.0f }, { 50.0f, 25.0f }, { 75.0f, 25.0f }, { 100.0f, 25.0f } },
+    { 0.7f, 0.9f, 1.0f, 1.4f, 1.8f },
+    25,
+    {
+      { 0, 0, FUZZY_VERY_HIGH, 1.0f }, { 0, 1, FUZZY_VERY_HIGH, 1.0f }, { 0, 2, FUZZY_HIGH, 1.0f }, { 0, 3, FUZZY_MEDIUM, 1.0f }, { 0, 4, FUZZY_MEDIUM, 1.0f },
+      { 1, 0, FUZZY_HIGH, 1.0f }, { 1, 1, FUZZY_HIGH, 1.0f }, { 1, 2, FUZZY_MEDIUM, 1.0f }, { 1, 3, FUZZY_LOW, 1.0f }, { 1, 4, FUZZY_MEDIUM, 1.0f },
+      { 2, 0, FUZZY_MEDIUM, 1.0f }, { 2, 1, FUZZY_LOW, 1.0f }, { 2, 2, FUZZY_VERY_LOW, 1.0f }, { 2, 3, FUZZY_LOW, 1.0f }, { 2, 4, FUZZY_MEDIUM, 1.0f },
+      { 3, 0, FUZZY_MEDIUM, 1.0f }, { 3, 1, FUZZY_LOW, 1.0f }, { 3, 2, FUZZY_MEDIUM, 1.0f }, { 3, 3, FUZZY_HIGH, 1.0f }, { 3, 4, FUZZY_HIGH, 1.0f },
+      { 4, 0, FUZZY_MEDIUM, 1.0f }, { 4, 1, FUZZY_MEDIUM, 1.0f }, { 4, 2, FUZZY_HIGH, 1.0f }, { 4, 3, FUZZY_VERY_HIGH, 1.0f }, { 4, 4, FUZZY_VERY_HIGH, 1.0f }
+    }
+  },
+  // 冲击负荷：污染高于设定值（正误差）时强烈加大 Kp，低于设定值时保守
+  {
+    { { 0.0f, 25.0f }, { 25.0f, 25.0f }, { 50.0f, 25.0f }, { 75.0f, 25.0f }, { 100.0f, 25.0f } },
+    { 0.8f, 1.0f, 1.3f, 1.7f, 2.2f },
+    25,
+    {
+      { 0, 0, FUZZY_HIGH, 1.0f }, { 0, 1, FUZZY_MEDIUM, 1.0f }, { 0, 2, FUZZY_MEDIUM, 1.0f }, { 0, 3, FUZZY_LOW, 1.0f }, { 0, 4, FUZZY_LOW, 1.0f },
+      { 1, 0, FUZZY_MEDIUM, 1.0f }, { 1, 1, FUZZY_MEDIUM, 1.0f }, { 1, 2, FUZZY_LOW, 1.0f }, { 1, 3, FUZZY_LOW, 1.0f }, { 1, 4, FUZZY_MEDIUM, 1.0f },
+      { 2, 0, FUZZY_MEDIUM, 1.0f }, { 2, 1, FUZZY_LOW, 1.0f }, { 2, 2, FUZZY_LOW, 1.0f }, { 2, 3, FUZZY_MEDIUM, 1.0f }, { 2, 4, FUZZY_HIGH, 1.0f },
+      { 3, 0, FUZZY_MEDIUM, 1.0f }, { 3, 1, FUZZY_MEDIUM, 1.0f }, { 3, 2, FUZZY_HIGH, 1.0f }, { 3, 3, FUZZY_VERY_HIGH, 1.0f }, { 3, 4, FUZZY_VERY_HIGH, 1.0f },
+      { 4, 0, FUZZY_HIGH, 1.0f }, { 4, 1, FUZZY_HIGH, 1.0f }, { 4, 2, FUZZY_VERY_HIGH, 1.0f }, { 4, 3, FUZZY_VERY_HIGH, 1.0f }, { 4, 4, FUZZY_VERY_HIGH, 1.0f }
+    }
+  },
+  // 维护：低增益，只维持基本处理
+  {
+    { { 0.0f, 25.0f }, { 25.0f, 25.0f }, { 50.0f, 25.0f }, { 75.0f, 25.0f }, { 100.0f, 25.0f } },
+    { 0.3f, 0.4f, 0.5f, 0.6f, 0.7f },
+    25,
+    {
+      { 0, 0, FUZZY_VERY_HIGH, 1.0f }, { 0, 1, FUZZY_VERY_HIGH, 1.0f }, { 0, 2, FUZZY_HIGH, 1.0f }, { 0, 3, FUZZY_MEDIUM, 1.0f }, { 0, 4, FUZZY_MEDIUM, 1.0f },
+      { 1, 0, FUZZY_HIGH, 1.0f }, { 1, 1, FUZZY_HIGH, 1.0f }, { 1, 2, FUZZY_MEDIUM, 1.0f }, { 1, 3, FUZZY_LOW, 1.0f }, { 1, 4, FUZZY_MEDIUM, 1.0f },
+      { 2, 0, FUZZY_MEDIUM, 1.0f }, { 2, 1, FUZZY_LOW, 1.0f }, { 2, 2, FUZZY_VERY_LOW, 1.0f }, { 2, 3, FUZZY_LOW, 1.0f }, { 2, 4, FUZZY_MEDIUM, 1.0f },
+      { 3, 0, FUZZY_MEDIUM, 1.0f }, { 3, 1, FUZZY_LOW, 1.0f }, { 3, 2, FUZZY_MEDIUM, 1.0f }, { 3, 3, FUZZY_HIGH, 1.0f }, { 3, 4, FUZZY_HIGH, 1.0f },
+      { 4, 0, FUZZY_MEDIUM, 1.0f }, { 4, 1, FUZZY_MEDIUM, 1.0f }, { 4, 2, FUZZY_HIGH, 1.0f }, { 4, 3, FUZZY_VERY_HIGH, 1.0f }, { 4, 4, FUZZY_VERY_HIGH, 1.0f }
+    }
+  }
+};
+
+static_assert(sizeof(FUZZY_RULE_BASES) / sizeof(FUZZY_RULE_BASES[0]) == MAINTENANCE + 1,
+              "每个控制模式都需要一套模糊规则库");
+
+#endif // FUZZY_RULE_BASES_H
\ No newline at end of file
@@ -0,0 +1,30 @@
+// PID增益调度表，存于闪存，按 [ControlMode][污染物浓度档位] 索引
+// 各项为PID基准参数（自整定或 updatePIDParameters 设定）的倍数，单位 1/32（32 即 1.0）
+#ifndef GAIN_SCHEDULE_H
+#define GAIN_SCHEDULE_H
+
+#include <Arduino.h>
+#include "../Core/CommonTypes.h"
+
+struct GainScheduleEntry {
+  uint8_t kp;
+  uint8_t ki;
+  uint8_t kd;
+};
+
+static const uint8_t GAIN_SCHEDULE_BANDS = 3;     // 低、中、高浓度（分界见 GAIN_SCHEDULE_BAND_LOW/HIGH）
+static const float GAIN_SCHEDULE_UNIT = 1.0f / 32.0f;
+
+static constexpr GainScheduleEntry GAIN_SCHEDULE[][GAIN_SCHEDULE_BANDS] PROGMEM = {
+  //  低浓度          中浓度          高浓度
+  { { 20, 16, 24 }, { 22, 22, 22 }, { 26, 26, 26 } },  // 节能：整体减弱，减少执行器动作
+  { { 28, 24, 32 }, { 32, 32, 32 }, { 40, 40, 32 } },  // 标准
+  { { 28, 24, 32 }, { 32, 32, 32 }, { 40, 40, 32 } },  // 高效：由MPC控制，PID参数同标准模式
+  { { 40, 32, 32 }, { 48, 48, 40 }, { 56, 56, 48 } },  // 冲击负荷：整体增强，高浓度时更强
+  { { 16, 16, 16 }, { 16, 16, 16 }, { 16, 16, 16 } }   // 维护：输出固定，不使用PID
+};
+
+static_assert(sizeof(GAIN_SCHEDULE) / sizeof(GAIN_SCHEDULE[0]) == MAINTENANCE + 1,
+              "每个控制模式都需要一行增益调度");
+
+#endif // GAIN_SCHEDULE_H
\ No newline at end of file
@@ -1,135 +1,238 @@
 #include "PIDController.h"
 #include <Arduino.h>
 
-PIDController::PIDController(float Kp, float Ki, float Kd)
+// 微秒数换算为秒
+static float intervalSeconds(unsigned long interval, float) {
+  return interval * 1e-6f;
+}
+
+static Fix16 intervalSeconds(unsigned long interval, Fix16) {
+  // 分母须在16位以内：以16us为单位，1s = 62500 单位
+  return Fix16::fromRatio(interval >> 4, 62500U);
+}
+
+template<typename T>
+PIDControllerT<T>::PIDControllerT(T Kp, T Ki, T Kd)
   : Kp(Kp), Ki(Ki), Kd(Kd),
-    integralTerm(0.0f),
-    previousError(0.0f),
-    previousMeasurement(0.0f),
-    outputMin(0.0f),
-    outputMax(100.0f),
-    integralMin(-1000.0f),
-    integralMax(1000.0f),
+    integralTerm(T(0.0f)),
+    previousError(T(0.0f)),
+    previousMeasurement(T(0.0f)),
+    outputMin(T(0.0f)),
+    outputMax(T(100.0f)),
+    integralMin(T(-1000.0f)),
+    integralMax(T(1000.0f)),
     antiWindupEnabled(true),
-    windupThreshold(0.8f),
-    derivativeFilterAlpha(0.3f),
-    filteredDerivative(0.0f),
+    windupThreshold(T(0.8f)),
+    derivativeFilterAlpha(T(0.3f)),
+    filteredDerivative(T(0.0f)),
     adaptiveMode(false),
-    adaptiveGain(0.1f) {}
+    adaptiveGain(T(0.1f)),
+    reverseActing(false),
+    lastTime(0),
+    timeValid(false),
+    lastInterval(T(0.0f)),
+    lastOutput(T(0.0f)),
+    overrunCount(0) {}
 
-void PIDController::setParameters(float Kp, float Ki, float Kd) {
+template<typename T>
+void PIDControllerT<T>::setParameters(T Kp, T Ki, T Kd) {
   this->Kp = Kp;
   this->Ki = Ki;
   this->Kd = Kd;
 }
 
-void PIDController::getParameters(float& Kp, float& Ki, float& Kd) const {
+template<typename T>
+void PIDControllerT<T>::getParameters(T& Kp, T& Ki, T& Kd) const {
   Kp = this->Kp;
   Ki = this->Ki;
   Kd = this->Kd;
 }
 
-void PIDController::setOutputLimits(float min, float max) {
+template<typename T>
+void PIDControllerT<T>::setOutputLimits(T min, T max) {
   outputMin = min;
   outputMax = max;
 }
 
-void PIDController::setIntegralLimits(float min, float max) {
+template<typename T>
+void PIDControllerT<T>::setIntegralLimits(T min, T max) {
   integralMin = min;
   integralMax = max;
 }
 
-void PIDController::enableAntiWindup(bool enable, float threshold) {
+template<typename T>
+void PIDControllerT<T>::enableAntiWindup(bool enable, T threshold) {
   antiWindupEnabled = enable;
   windupThreshold = threshold;
 }
 
-void PIDController::setDerivativeFilter(float alpha) {
+template<typename T>
+void PIDControllerT<T>::setDerivativeFilter(T alpha) {
   derivativeFilterAlpha = alpha;
 }
 
-void PIDController::enableAdaptiveMode(bool enable, float gain) {
+template<typename T>
+void PIDControllerT<T>::enableAdaptiveMode(bool enable, T gain) {
   adaptiveMode = enable;
   adaptiveGain = gain;
 }
 
-float PIDController::compute(float setpoint, float measurement, float dt) {
-  if (dt <= 0.0f) dt = 0.01f; // 避免除以零
+template<typename T>
+void PIDControllerT<T>::setReverseActing(bool reverse) {
+  reverseActing = reverse;
+}
   
-  float error = setpoint - measurement;
+template<typename T>
+T PIDControllerT<T>::compute(T setpoint, T measurement) {
+  return compute(setpoint, measurement, micros());
+}
+
+template<typename T>
+T PIDControllerT<T>::elapsed(unsigned long now) const {
+  if (!timeValid) return intervalSeconds(CONTROL_INTERVAL * 1000UL, T());
+  
+  // 无符号减法，micros() 回绕后仍得到正确的间隔
+  unsigned long interval = now - lastTime;
+  interval = constrain(interval, PID_MIN_INTERVAL, PID_MAX_INTERVAL);
+  return intervalSeconds(interval, T());
+}
+
+template<typename T>
+T PIDControllerT<T>::compute(T setpoint, T measurement, unsigned long now) {
+  // 间隔过短：同一周期内重复调用，保持上次输出
+  bool derivativeValid = timeValid;
+  if (timeValid) {
+    unsigned long interval = now - lastTime;
+    if (interval < PID_MIN_INTERVAL) return lastOutput;
+    if (interval > PID_MAX_INTERVAL) {
+      overrunCount++;
+      derivativeValid = false;
+    }
+  }
+  T dt = elapsed(now);
+  lastTime = now;
+  timeValid = true;
+  lastInterval = dt;
+  
+  T error = errorOf(setpoint, measurement);
   
   // 比例项
-  float proportional = Kp * error;
+  T proportional = Kp * error;
   
   // 积分项
   integralTerm += Ki * error * dt;
   
   // 抗饱和处理
   if (antiWindupEnabled) {
-    integralTerm = constrain(integralTerm, integralMin, integralMax);
+    integralTerm = clampValue(integralTerm, integralMin, integralMax);
   }
   
-  // 微分项
-  float derivative = (measurement - previousMeasurement) / dt;
+  // 微分项（对测量值微分，超时或首次计算时沿用上次的滤波值）
+  if (derivativeValid) {
+    T derivative = (measurement - previousMeasurement) / dt;
   
-  // 应用导数滤波器
-  filteredDerivative = derivativeFilterAlpha * derivative + 
-                      (1.0f - derivativeFilterAlpha) * filteredDerivative;
+    // 应用导数滤波器
+    filteredDerivative = derivativeFilterAlpha * derivative +
+                        (T(1.0f) - derivativeFilterAlpha) * filteredDerivative;
+  }
   
-  float derivativeTerm = -Kd * filteredDerivative; // 负号是因为是对测量值微分
+  T derivativeTerm = derivativeOutput();
   
   // 自适应调整
   if (adaptiveMode) {
-    float adaptiveFactor = calculateAdaptiveGain(error, dt);
+    T adaptiveFactor = calculateAdaptiveGain(error, dt);
     proportional *= adaptiveFactor;
   }
   
   // 计算输出
-  float output = proportional + integralTerm + derivativeTerm;
+  T output = proportional + integralTerm + derivativeTerm;
   
   // 抗饱和处理
-  if (antiWindupEnabled && fabs(output) > windupThreshold * outputMax) {
+  if (antiWindupEnabled && absValue(output) > windupThreshold * outputMax) {
     handleIntegralWindup(output, dt);
   }
   
   // 限制输出
-  output = constrain(output, outputMin, outputMax);
+  output = clampValue(output, outputMin, outputMax);
   
   // 更新状态
   previousError = error;
   previousMeasurement = measurement;
+  lastOutput = output;
   
   return output;
 }
 
-void PIDController::reset() {
-  integralTerm = 0.0f;
-  previousError = 0.0f;
-  previousMeasurement = 0.0f;
-  filteredDerivative = 0.0f;
+template<typename T>
+void PIDControllerT<T>::track(T output, T setpoint, T measurement) {
+  T error = errorOf(setpoint, measurement);
+  integralTerm = clampValue(output - Kp * error - derivativeOutput(), integralMin, integralMax);
+  previousError = error;
+  lastOutput = output;
+}
+
+template<typename T>
+void PIDControllerT<T>::reset() {
+  integralTerm = T(0.0f);
+  previousError = T(0.0f);
+  previousMeasurement = T(0.0f);
+  filteredDerivative = T(0.0f);
+  timeValid = false;
+  lastInterval = T(0.0f);
+  lastOutput = T(0.0f);
 }
 
-float PIDController::getIntegralTerm() const {
+template<typename T>
+T PIDControllerT<T>::getIntegralTerm() const {
   return integralTerm;
 }
 
-float PIDController::getDerivativeTerm() const {
+template<typename T>
+T PIDControllerT<T>::getDerivativeTerm() const {
   return filteredDerivative;
 }
 
-float PIDController::getProportionalTerm() const {
+template<typename T>
+T PIDControllerT<T>::getProportionalTerm() const {
   return previousError * Kp;
 }
 
-float PIDController::calculateAdaptiveGain(float error, float dt) {
+template<typename T>
+T PIDControllerT<T>::getLastInterval() const {
+  return lastInterval;
+}
+
+template<typename T>
+uint16_t PIDControllerT<T>::getOverrunCount() const {
+  return overrunCount;
+}
+
+template<typename T>
+T PIDControllerT<T>::errorOf(T setpoint, T measurement) const {
+  return reverseActing ? measurement - setpoint : setpoint - measurement;
+}
+
+template<typename T>
+T PIDControllerT<T>::derivativeOutput() const {
+  // 负号是因为是对测量值微分；反向作用时误差随测量值增大
+  return reverseActing ? Kd * filteredDerivative : -(Kd * filteredDerivative);
+}
+
+template<typename T>
+T PIDControllerT<T>::calculateAdaptiveGain(T error, T dt) {
   // 简化自适应增益计算
-  float adaptiveFactor = 1.0f + adaptiveGain * fabs(error);
+  T adaptiveFactor = T(1.0f) + adaptiveGain * absValue(error);
   return adaptiveFactor;
 }
 
-void PIDController::handleIntegralWindup(float output, float dt) {
+template<typename T>
+void PIDControllerT<T>::handleIntegralWindup(T output, T dt) {
   // 简化抗饱和处理
-  if (fabs(output) > outputMax) {
-    integralTerm *= 0.95f; // 减小积分项
+  if (absValue(output) > outputMax) {
+    integralTerm = integralTerm * T(0.95f); // 减小积分项
   }
-}
\ No newline at end of file
+}
+
+// 两种数值类型都在此实例化
+template class PIDControllerT<float>;
+template class PIDControllerT<Fix16>;
\ No newline at end of file
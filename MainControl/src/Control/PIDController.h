@@ -1,67 +1,114 @@
 #ifndef PID_CONTROLLER_H
 #define PID_CONTROLLER_H
 
-class PIDController {
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+#include "../Utilities/FixedPoint.h"
+
+// PID控制器，数值类型 T 为 float 或 Fix16（Q16.16）
+// Fix16 的乘除使用64位中间结果，ControlSystem 每周期还要在 float 与 Fix16 之间换算，
+// 在AVR上未必比软件浮点快；两者的实际耗时以串口命令 fixed bench 的“PID一步”为准。
+// 积分与微分按两次计算之间实测的时间间隔 (micros()) 计算：
+// 计数器回绕由无符号减法处理；间隔短于 PID_MIN_INTERVAL 时不更新状态，
+// 长于 PID_MAX_INTERVAL（阻塞、暂停）时按上限积分，并跳过本次微分；
+// 第一次计算（及 reset 之后）按控制周期积分，不计算微分，避免微分冲击。
+template<typename T>
+class PIDControllerT {
 private:
   // PID参数
-  float Kp, Ki, Kd;
-  float integralTerm;
-  float previousError;
-  float previousMeasurement;
+  T Kp, Ki, Kd;
+  T integralTerm;
+  T previousError;
+  T previousMeasurement;
   
   // 限制参数
-  float outputMin, outputMax;
-  float integralMin, integralMax;
+  T outputMin, outputMax;
+  T integralMin, integralMax;
   
   // 抗饱和参数
   bool antiWindupEnabled;
-  float windupThreshold;
+  T windupThreshold;
   
   // 滤波器参数
-  float derivativeFilterAlpha;
-  float filteredDerivative;
+  T derivativeFilterAlpha;
+  T filteredDerivative;
   
   // 自适应参数
   bool adaptiveMode;
-  float adaptiveGain;
+  T adaptiveGain;
+  
+  // 反向作用：测量值高于设定值时增大输出
+  bool reverseActing;
+  
+  // 计时
+  unsigned long lastTime;               // 上次计算的时间 (us)
+  bool timeValid;
+  T lastInterval;                       // 上次计算所用的间隔 (s)
+  T lastOutput;
+  uint16_t overrunCount;
   
 public:
-  PIDController(float Kp = 1.0f, float Ki = 0.1f, float Kd = 0.05f);
+  PIDControllerT(T Kp = T(1.0f), T Ki = T(0.1f), T Kd = T(0.05f));
   
   // 配置PID参数
-  void setParameters(float Kp, float Ki, float Kd);
-  void getParameters(float& Kp, float& Ki, float& Kd) const;
+  void setParameters(T Kp, T Ki, T Kd);
+  void getParameters(T& Kp, T& Ki, T& Kd) const;
   
   // 设置输出限制
-  void setOutputLimits(float min, float max);
-  void setIntegralLimits(float min, float max);
+  void setOutputLimits(T min, T max);
+  void setIntegralLimits(T min, T max);
   
   // 抗饱和设置
-  void enableAntiWindup(bool enable, float threshold = 0.8f);
+  void enableAntiWindup(bool enable, T threshold = T(0.8f));
   
   // 滤波器设置
-  void setDerivativeFilter(float alpha);
+  void setDerivativeFilter(T alpha);
   
   // 自适应设置
-  void enableAdaptiveMode(bool enable, float gain = 0.1f);
+  void enableAdaptiveMode(bool enable, T gain = T(0.1f));
+  
+  // 作用方向（默认正向：误差 = 设定值 - 测量值）
+  void setReverseActing(bool reverse);
   
-  // 计算控制输出
-  float compute(float setpoint, float measurement, float dt);
+  // 计算控制输出，now 为当前时间 (us)
+  T compute(T setpoint, T measurement, unsigned long now);
+  T compute(T setpoint, T measurement);
+  
+  // 在时间 now 计算时将使用的间隔 (s)，已限制在上下限之间
+  T elapsed(unsigned long now) const;
+  
+  // 无扰切换：按当前参数重新初始化积分项，使比例+积分+微分恰好等于 output，
+  // 下一次计算从该输出连续变化（参数改变或其他控制律接管执行器之后调用）
+  void track(T output, T setpoint, T measurement);
   
   // 重置控制器
   void reset();
   
   // 获取内部状态
-  float getIntegralTerm() const;
-  float getDerivativeTerm() const;
-  float getProportionalTerm() const;
+  T getIntegralTerm() const;
+  T getDerivativeTerm() const;
+  T getProportionalTerm() const;
+  T getLastInterval() const;
+  uint16_t getOverrunCount() const;
   
 private:
+  // 按作用方向计算误差与微分项
+  T errorOf(T setpoint, T measurement) const;
+  T derivativeOutput() const;
+  
   // 计算自适应增益
-  float calculateAdaptiveGain(float error, float dt);
+  T calculateAdaptiveGain(T error, T dt);
   
   // 抗饱和处理
-  void handleIntegralWindup(float output, float dt);
+  void handleIntegralWindup(T output, T dt);
 };
 
+// PIDValue 为控制器的数值类型，调用方由 float 显式换算
+#if PID_FIXED_POINT
+typedef Fix16 PIDValue;
+#else
+typedef float PIDValue;
+#endif
+typedef PIDControllerT<PIDValue> PIDController;
+
 #endif // PID_CONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,483 @@
+#include "PredictiveController.h"
+
+PredictiveController::PredictiveController()
+  : modelA(0.0f),
+    modelB(0.0f),
+    trackingWeight(MPC_TRACKING_WEIGHT),
+    moveWeight(MPC_MOVE_WEIGHT),
+    energyWeight(MPC_ENERGY_WEIGHT),
+    horizon(MPC_HORIZON),
+    outputMin(0.0f),
+    outputMax(100.0f),
+    maxRate(MPC_MAX_RATE),
+    prepared(false),
+    maxSolveTime(0) {
+  updateBlocks();
+  reset();
+}
+
+void PredictiveController::setModel(float a, float b, float tolerance) {
+  // 线性化点缓慢变化时沿用已有的预计算结果
+  if (prepared &&
+      fabs(a - modelA) <= tolerance * fabs(modelA) &&
+      fabs(b - modelB) <= tolerance * fabs(modelB)) {
+    return;
+  }
+  
+  // 扰动估计保留：重新线性化不改变被控对象，c 由预测误差继续修正
+  modelA = a;
+  modelB = b;
+  prepared = false;
+}
+
+void PredictiveController::setWeights(float tracking, float move, float energy) {
+  trackingWeight = tracking;
+  moveWeight = move;
+  energyWeight = energy;
+  prepared = false;
+}
+
+void PredictiveController::setHorizon(uint16_t steps) {
+  horizon = steps > BLOCKS ? steps : BLOCKS;
+  updateBlocks();
+  prepared = false;
+}
+
+void PredictiveController::setLimits(float minOutput, float maxOutput, float rate) {
+  outputMin = minOutput;
+  outputMax = maxOutput;
+  maxRate = rate;
+}
+
+void PredictiveController::reset() {
+  disturbance = 0.0f;
+  lastMeasurement = 0.0f;
+  observerReady = false;
+  solutionValid = false;
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+    activeSet[i] = 0;
+  }
+  lastIterations = 0;
+  lastConstrained = false;
+  lastSolveTime = 0;
+}
+
+float PredictiveController::compute(float measurement, float reference, float previousOutput) {
+  unsigned long start = micros();
+  
+  float output = plan(measurement, observe(measurement, previousOutput), reference, previousOutput);
+  
+  lastSolveTime = micros() - start;
+  if (lastSolveTime > maxSolveTime) {
+    maxSolveTime = lastSolveTime;
+  }
+  return output;
+}
+  
+float PredictiveController::observe(float measurement, float previousOutput) {
+  // 扰动估计：上一周期的预测误差修正 c；复位后的第一次按稳态估计
+  if (observerReady) {
+    float predicted = modelA * lastMeasurement + modelB * previousOutput + disturbance;
+    disturbance += MPC_DISTURBANCE_GAIN * (measurement - predicted);
+  } else {
+    disturbance = (1.0f - modelA) * measurement - modelB * previousOutput;
+    observerReady = true;
+  }
+  lastMeasurement = measurement;
+  return disturbance;
+}
+
+float PredictiveController::plan(float measurement, float estimate, float reference, float previousOutput) {
+  if (!prepared) {
+    prepare();
+  }
+  
+  // 线性项 f
+  float linear[BLOCKS];
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    linear[j] = 2.0f * trackingWeight * (measurement * stateGain[j] + estimate * disturbanceGain[j] -
+                                         reference * referenceGain[j]) +
+                energyWeight * blockLength[j];
+  }
+  linear[0] -= 2.0f * moveWeight * previousOutput;
+  
+  // 约束：各段输出范围（第一段同时受相对上次输出的变化量限制）及段间变化量
+  float lower[CONSTRAINTS];
+  float upper[CONSTRAINTS];
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    lower[j] = outputMin;
+    upper[j] = outputMax;
+  }
+  for (uint8_t j = BLOCKS; j < CONSTRAINTS; j++) {
+    lower[j] = -maxRate;
+    upper[j] = maxRate;
+  }
+  lower[0] = max(lower[0], previousOutput - maxRate);
+  upper[0] = min(upper[0], previousOutput + maxRate);
+  
+  float solution[BLOCKS];
+  solve(linear, lower, upper, solution);
+  
+  // 迭代次数用尽时保证第一步满足约束
+  return constrain(solution[0], lower[0], upper[0]);
+}
+
+void PredictiveController::updateBlocks() {
+  uint16_t previousEnd = 0;
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    uint16_t end = (j + 1 == BLOCKS) ? horizon :
+                   static_cast<uint16_t>(pow(static_cast<float>(horizon), (j + 1.0f) / BLOCKS) + 0.5f);
+    // 每段至少一步，并为后面的段留出位置
+    if (end <= previousEnd) end = previousEnd + 1;
+    if (end > horizon - (BLOCKS - 1 - j)) end = horizon - (BLOCKS - 1 - j);
+    blockLength[j] = end - previousEnd;
+    previousEnd = end;
+  }
+}
+
+void PredictiveController::prepare() {
+  // 逐步递推各段单位输入的响应 Φ(k, j)，累加 ΦᵀΦ 与线性项系数，
+  // 不保存 N×BLOCKS 的矩阵
+  float response[BLOCKS];
+  float hessian[BLOCKS][BLOCKS];
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    response[j] = 0.0f;
+    stateGain[j] = 0.0f;
+    disturbanceGain[j] = 0.0f;
+    referenceGain[j] = 0.0f;
+    for (uint8_t l = 0; l < BLOCKS; l++) {
+      hessian[j][l] = 0.0f;
+    }
+  }
+  
+  float freeState = 1.0f;        // a^k
+  float freeDisturbance = 0.0f;  // Σ_{i<k} a^i
+  uint8_t block = 0;
+  uint16_t blockEnd = blockLength[0];
+  for (uint16_t k = 1; k <= horizon; k++) {
+    // 第 k-1 步的输入所在的段
+    if (k - 1 >= blockEnd && block + 1 < BLOCKS) {
+      block++;
+      blockEnd += blockLength[block];
+    }
+    for (uint8_t j = 0; j <= block; j++) {
+      response[j] = modelA * response[j] + (j == block ? modelB : 0.0f);
+    }
+    freeState *= modelA;
+    freeDisturbance = modelA * freeDisturbance + 1.0f;
+    
+    for (uint8_t j = 0; j <= block; j++) {
+      stateGain[j] += response[j] * freeState;
+      disturbanceGain[j] += response[j] * freeDisturbance;
+      referenceGain[j] += response[j];
+      for (uint8_t l = 0; l <= j; l++) {
+        hessian[j][l] += response[j] * response[l];
+      }
+    }
+  }
+  
+  // H = 2q·ΦᵀΦ + 2ρ·DᵀD（D 为段间差分，三对角），只用下三角
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    for (uint8_t l = 0; l <= j; l++) {
+      hessian[j][l] *= 2.0f * trackingWeight;
+    }
+    hessian[j][j] += 2.0f * moveWeight * (j + 1 < BLOCKS ? 2.0f : 1.0f);
+    if (j > 0) {
+      hessian[j][j - 1] -= 2.0f * moveWeight;
+    }
+  }
+  
+  // Cholesky分解 H = L·Lᵀ（原位存放在下三角）
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    float diagonal = hessian[j][j];
+    for (uint8_t l = 0; l < j; l++) {
+      diagonal -= hessian[j][l] * hessian[j][l];
+    }
+    hessian[j][j] = sqrt(max(diagonal, 1e-9f));
+    for (uint8_t i = j + 1; i < BLOCKS; i++) {
+      float value = hessian[i][j];
+      for (uint8_t l = 0; l < j; l++) {
+        value -= hessian[i][l] * hessian[j][l];
+      }
+      hessian[i][j] = value / hessian[j][j];
+    }
+  }
+  
+  // H⁻¹ 的各列：L·Lᵀ·x = e_c
+  for (uint8_t c = 0; c < BLOCKS; c++) {
+    float column[BLOCKS];
+    for (uint8_t i = 0; i < BLOCKS; i++) {
+      float value = (i == c) ? 1.0f : 0.0f;
+      for (uint8_t l = 0; l < i; l++) {
+        value -= hessian[i][l] * column[l];
+      }
+      column[i] = value / hessian[i][i];
+    }
+    for (int8_t i = BLOCKS - 1; i >= 0; i--) {
+      float value = column[i];
+      for (uint8_t l = i + 1; l < BLOCKS; l++) {
+        value -= hessian[l][i] * column[l];
+      }
+      column[i] = value / hessian[i][i];
+    }
+    for (uint8_t i = 0; i < BLOCKS; i++) {
+      hessianInverse[i][c] = column[i];
+    }
+  }
+  
+  // 对偶矩阵 P = G·H⁻¹·Gᵀ
+  for (uint8_t c = 0; c < CONSTRAINTS; c++) {
+    float unit[CONSTRAINTS];
+    for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+      unit[i] = (i == c) ? 1.0f : 0.0f;
+    }
+    float row[BLOCKS];
+    constraintTranspose(unit, row);
+    
+    float column[BLOCKS];
+    for (uint8_t i = 0; i < BLOCKS; i++) {
+      column[i] = 0.0f;
+      for (uint8_t l = 0; l < BLOCKS; l++) {
+        column[i] += hessianInverse[i][l] * row[l];
+      }
+    }
+    for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+      dualMatrix[i][c] = constraintRow(i, column);
+    }
+  }
+  
+  solutionValid = false;
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+    activeSet[i] = 0;
+  }
+  prepared = true;
+}
+
+float PredictiveController::constraintRow(uint8_t row, const float values[BLOCKS]) const {
+  // 行 0..B-1：各段输出；行 B+j-1：第 j 段与第 j-1 段之差
+  if (row < BLOCKS) return values[row];
+  uint8_t j = row - BLOCKS + 1;
+  return values[j] - values[j - 1];
+}
+
+void PredictiveController::constraintTranspose(const float dual[CONSTRAINTS], float result[BLOCKS]) const {
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    result[j] = dual[j];
+    if (j > 0) {
+      result[j] += dual[BLOCKS + j - 1];
+    }
+    if (j + 1 < BLOCKS) {
+      result[j] -= dual[BLOCKS + j];
+    }
+  }
+}
+
+bool PredictiveController::solveMultipliers(const float projected[CONSTRAINTS], const float lower[CONSTRAINTS],
+                                            const float upper[CONSTRAINTS], float multipliers[CONSTRAINTS]) const {
+  uint8_t index[CONSTRAINTS];
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+    multipliers[i] = 0.0f;
+    if (activeSet[i] != 0) {
+      index[count++] = i;
+    }
+  }
+  if (count == 0) return true;
+  
+  // 选主元高斯消元（有效约束不超过 BLOCKS 个）
+  float matrix[CONSTRAINTS][CONSTRAINTS + 1];
+  for (uint8_t r = 0; r < count; r++) {
+    uint8_t i = index[r];
+    for (uint8_t c = 0; c < count; c++) {
+      matrix[r][c] = dualMatrix[i][index[c]];
+    }
+    matrix[r][count] = projected[i] - (activeSet[i] > 0 ? upper[i] : lower[i]);
+  }
+  for (uint8_t c = 0; c < count; c++) {
+    uint8_t pivot = c;
+    for (uint8_t r = c + 1; r < count; r++) {
+      if (fabs(matrix[r][c]) > fabs(matrix[pivot][c])) pivot = r;
+    }
+    if (fabs(matrix[pivot][c]) <= 1e-6f * fabs(dualMatrix[index[c]][index[c]])) return false;
+    if (pivot != c) {
+      for (uint8_t k = c; k <= count; k++) {
+        float temp = matrix[c][k];
+        matrix[c][k] = matrix[pivot][k];
+        matrix[pivot][k] = temp;
+      }
+    }
+    for (uint8_t r = c + 1; r < count; r++) {
+      float factor = matrix[r][c] / matrix[c][c];
+      for (uint8_t k = c; k <= count; k++) {
+        matrix[r][k] -= factor * matrix[c][k];
+      }
+    }
+  }
+  for (int8_t r = count - 1; r >= 0; r--) {
+    float value = matrix[r][count];
+    for (uint8_t k = r + 1; k < count; k++) {
+      value -= matrix[r][k] * multipliers[index[k]];
+    }
+    multipliers[index[r]] = value / matrix[r][r];
+  }
+  return true;
+}
+
+void PredictiveController::solve(const float linear[BLOCKS], const float lower[CONSTRAINTS],
+                                 const float upper[CONSTRAINTS], float solution[BLOCKS]) {
+  // 无约束最优解 v = -H⁻¹·f
+  float unconstrained[BLOCKS];
+  for (uint8_t i = 0; i < BLOCKS; i++) {
+    unconstrained[i] = 0.0f;
+    for (uint8_t l = 0; l < BLOCKS; l++) {
+      unconstrained[i] -= hessianInverse[i][l] * linear[l];
+    }
+  }
+  
+  float projected[CONSTRAINTS];
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+    projected[i] = constraintRow(i, unconstrained);
+  }
+  
+  // 初始可行点：上一次的解仍可行时沿用，否则取各段相同的控制量（段间变化为零）
+  bool warm = solutionValid;
+  for (uint8_t i = 0; warm && i < CONSTRAINTS; i++) {
+    float value = constraintRow(i, lastSolution);
+    warm = value >= lower[i] && value <= upper[i];
+  }
+  if (warm) {
+    for (uint8_t j = 0; j < BLOCKS; j++) {
+      solution[j] = lastSolution[j];
+    }
+  } else {
+    float low = lower[0];
+    float high = upper[0];
+    for (uint8_t j = 1; j < BLOCKS; j++) {
+      low = max(low, lower[j]);
+      high = min(high, upper[j]);
+    }
+    float start = constrain(unconstrained[0], low, high);
+    for (uint8_t j = 0; j < BLOCKS; j++) {
+      solution[j] = start;
+    }
+  }
+  
+  // 工作集只保留在初始点上仍然有效的约束
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+    if (activeSet[i] == 0) continue;
+    float bound = activeSet[i] > 0 ? upper[i] : lower[i];
+    if (fabs(constraintRow(i, solution) - bound) > MPC_TOLERANCE * (1.0f + upper[i] - lower[i])) {
+      activeSet[i] = 0;
+    }
+  }
+  
+  // 工作集上的最优解 v* = v_无约束 - H⁻¹·Gᵀ·λ；上界有效时 λ ≥ 0，下界有效时 λ ≤ 0
+  float multipliers[CONSTRAINTS];
+  uint8_t iteration = 0;
+  while (iteration < MPC_MAX_ITERATIONS) {
+    iteration++;
+    if (!solveMultipliers(projected, lower, upper, multipliers)) {
+      for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+        activeSet[i] = 0;
+      }
+      continue;
+    }
+    
+    float correction[BLOCKS];
+    float step[BLOCKS];
+    constraintTranspose(multipliers, correction);
+    for (uint8_t i = 0; i < BLOCKS; i++) {
+      step[i] = unconstrained[i] - solution[i];
+      for (uint8_t l = 0; l < BLOCKS; l++) {
+        step[i] -= hessianInverse[i][l] * correction[l];
+      }
+    }
+    
+    // 沿 step 前进，直到碰到工作集外的约束
+    float ratio = 1.0f;
+    uint8_t blocking = CONSTRAINTS;
+    for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+      if (activeSet[i] != 0) continue;
+      float change = constraintRow(i, step);
+      float value = constraintRow(i, solution);
+      // 与工作集线性相关的约束沿 step 不变，只有舍入误差；当作阻挡约束会使工作集奇异，在退化顶点上循环
+      if (fabs(change) <= MPC_TOLERANCE * (1.0f + upper[i] - lower[i])) continue;
+      float limit;
+      if (change > 0.0f && value + change > upper[i]) {
+        limit = (upper[i] - value) / change;
+      } else if (change < 0.0f && value + change < lower[i]) {
+        limit = (lower[i] - value) / change;
+      } else {
+        continue;
+      }
+      if (limit < ratio) {
+        ratio = max(limit, 0.0f);
+        blocking = i;
+      }
+    }
+    for (uint8_t i = 0; i < BLOCKS; i++) {
+      solution[i] += ratio * step[i];
+    }
+    if (blocking < CONSTRAINTS) {
+      activeSet[blocking] = constraintRow(blocking, step) > 0.0f ? 1 : -1;
+      continue;
+    }
+    
+    // 到达工作集上的最优解：移出乘子符号错误最多的约束，没有则已最优
+    uint8_t wrong = CONSTRAINTS;
+    float wrongValue = 0.0f;
+    for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+      float value = -activeSet[i] * multipliers[i];
+      if (value > wrongValue) {
+        wrongValue = value;
+        wrong = i;
+      }
+    }
+    if (wrong == CONSTRAINTS) break;
+    activeSet[wrong] = 0;
+  }
+  lastIterations = iteration;
+  
+  lastConstrained = false;
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+    lastConstrained |= activeSet[i] != 0;
+  }
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    lastSolution[j] = solution[j];
+  }
+  solutionValid = true;
+}
+
+uint16_t PredictiveController::getHorizon() const {
+  return horizon;
+}
+
+uint16_t PredictiveController::getBlockLength(uint8_t block) const {
+  return block < BLOCKS ? blockLength[block] : 0;
+}
+
+void PredictiveController::getLastSolution(float solution[BLOCKS]) const {
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    solution[j] = lastSolution[j];
+  }
+}
+
+uint8_t PredictiveController::getLastIterations() const {
+  return lastIterations;
+}
+
+bool PredictiveController::wasConstrained() const {
+  return lastConstrained;
+}
+
+unsigned long PredictiveController::getLastSolveTime() const {
+  return lastSolveTime;
+}
+
+unsigned long PredictiveController::getMaxSolveTime() const {
+  return maxSolveTime;
+}
+
+float PredictiveController::getDisturbance() const {
+  return disturbance;
+}
\ No newline at end of file
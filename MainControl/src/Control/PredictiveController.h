@@ -0,0 +1,110 @@
+#ifndef PREDICTIVE_CONTROLLER_H
+#define PREDICTIVE_CONTROLLER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+
+// 多步模型预测控制（凝聚形式的二次规划）
+// 模型：y(k+1) = a·y(k) + b·u(k) + c，c 为在线估计的扰动（入流负荷及模型误差），
+// 使稳态无偏差。预测时域 N 步按移动分块分为 BLOCKS 段，每段内控制量不变，
+// 决策变量只有 BLOCKS 个，每次求解的计算量与 N 无关。
+// 代价：Σ q·(y(k) - r)² + Σ ρ·(段间变化量)² + e·Σ u(k)
+// 约束：输出范围，以及段间变化量上限（第一段相对上次输出的变化量并入其输出范围）。
+// Hessian 只与模型和权重有关，改变时才重新计算其逆和对偶矩阵；
+// 每次求解以原始有效集法进行：从可行点出发，工作集内约束的乘子由对偶矩阵的子块解出，
+// 沿等式约束下的最优方向前进，遇到阻挡约束时加入工作集，到达后移出乘子符号错误的约束。
+// 上一次的解与工作集作为下一次求解的初值，稳态下通常一次迭代即可确认最优。
+class PredictiveController {
+public:
+  static const uint8_t BLOCKS = MPC_BLOCKS;
+  static const uint8_t CONSTRAINTS = 2 * MPC_BLOCKS - 1;  // 每段的输出范围与段间变化量（双边）
+  
+private:
+  // 模型与扰动估计
+  float modelA;
+  float modelB;
+  float disturbance;
+  float lastMeasurement;
+  bool observerReady;
+  
+  // 权重、时域与约束
+  float trackingWeight;
+  float moveWeight;
+  float energyWeight;
+  uint16_t horizon;
+  uint16_t blockLength[BLOCKS];
+  float outputMin;
+  float outputMax;
+  float maxRate;                        // 每步最大变化量
+  
+  // 预计算（模型或权重改变时更新）
+  float hessianInverse[BLOCKS][BLOCKS];
+  float dualMatrix[CONSTRAINTS][CONSTRAINTS];  // G·H⁻¹·Gᵀ
+  float stateGain[BLOCKS];              // 线性项中与初始输出、扰动、设定值成比例的部分
+  float disturbanceGain[BLOCKS];
+  float referenceGain[BLOCKS];
+  bool prepared;
+  
+  // 热启动：上一次的解与工作集（1 上界有效，-1 下界有效，0 无效）
+  float lastSolution[BLOCKS];
+  bool solutionValid;
+  int8_t activeSet[CONSTRAINTS];
+  
+  // 求解统计
+  uint8_t lastIterations;
+  bool lastConstrained;
+  unsigned long lastSolveTime;          // (us)
+  unsigned long maxSolveTime;
+  
+public:
+  PredictiveController();
+  
+  // 线性化模型；与当前模型的相对差别超过 tolerance 时重新预计算（为 0 时只要改变就重新计算）。
+  // 扰动估计不受影响，只在 reset() 时重新开始
+  void setModel(float a, float b, float tolerance = MPC_RELINEARIZE_TOLERANCE);
+  void setWeights(float tracking, float move, float energy);
+  void setHorizon(uint16_t steps);
+  void setLimits(float minOutput, float maxOutput, float rate);
+  
+  // 每个控制周期调用一次，返回本周期的控制量
+  float compute(float measurement, float reference, float previousOutput);
+  
+  // compute 的两个步骤，供显式控制律使用：
+  // 更新扰动估计并返回；给定扰动求解本周期的控制量（不更新扰动估计）
+  float observe(float measurement, float previousOutput);
+  float plan(float measurement, float estimate, float reference, float previousOutput);
+  
+  void reset();
+  
+  uint16_t getHorizon() const;
+  uint16_t getBlockLength(uint8_t block) const;
+  
+  // 上一次求解的各段控制量（plan 只返回第一段）
+  void getLastSolution(float solution[BLOCKS]) const;
+  uint8_t getLastIterations() const;
+  bool wasConstrained() const;
+  unsigned long getLastSolveTime() const;
+  unsigned long getMaxSolveTime() const;
+  float getDisturbance() const;
+  
+private:
+  // 按 N^(j/BLOCKS) 划分分块，前段短、后段长
+  void updateBlocks();
+  
+  // 计算 Hessian、其逆（Cholesky分解）、对偶矩阵与线性项系数
+  void prepare();
+  
+  // 约束矩阵 G 的第 i 行与向量的乘积，及 Gᵀ·μ
+  float constraintRow(uint8_t row, const float values[BLOCKS]) const;
+  void constraintTranspose(const float dual[CONSTRAINTS], float result[BLOCKS]) const;
+  
+  // 由工作集解乘子 P_AA·λ_A = G_A·v_无约束 - 边界，工作集线性相关时返回 false
+  bool solveMultipliers(const float projected[CONSTRAINTS], const float lower[CONSTRAINTS],
+                        const float upper[CONSTRAINTS], float multipliers[CONSTRAINTS]) const;
+  
+  // 求解 min ½vᵀHv + fᵀv，lower ≤ Gv ≤ upper
+  void solve(const float linear[BLOCKS], const float lower[CONSTRAINTS], const float upper[CONSTRAINTS],
+             float solution[BLOCKS]);
+};
+
+#endif // PREDICTIVE_CONTROLLER_H
\ No newline at end of file
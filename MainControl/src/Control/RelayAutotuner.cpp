@@ -0,0 +1,248 @@
+#include "RelayAutotuner.h"
+
+RelayAutotuner::RelayAutotuner()
+  : state(AUTOTUNE_IDLE),
+    fault(AUTOTUNE_FAULT_NONE),
+    setpoint(0.0f),
+    bias(0.0f),
+    outputHigh(0.0f),
+    outputLow(0.0f),
+    relayHigh(false),
+    startTime(0),
+    cycleStart(0),
+    lowStart(0),
+    cycleStarted(false),
+    cycleMax(0.0f),
+    cycleMin(0.0f),
+    peakDelay(0),
+    troughDelay(0),
+    cycleCount(0),
+    lastAmplitude(0.0f),
+    lastPeriod(0.0f),
+    lastDelay(0.0f),
+    amplitude(0.0f),
+    ultimateGain(0.0f),
+    ultimatePeriod(0.0f),
+    processGain(0.0f),
+    timeConstant(0.0f),
+    deadTime(0.0f) {}
+
+bool RelayAutotuner::start(float setpoint, float currentOutput, unsigned long now) {
+  if (state == AUTOTUNE_RUNNING) return false;
+  
+  this->setpoint = setpoint;
+  bias = constrain(currentOutput, AUTOTUNE_RELAY_AMPLITUDE, 100.0f - AUTOTUNE_RELAY_AMPLITUDE);
+  outputHigh = bias + AUTOTUNE_RELAY_AMPLITUDE;
+  outputLow = bias - AUTOTUNE_RELAY_AMPLITUDE;
+  relayHigh = false;
+  
+  startTime = now;
+  cycleStarted = false;
+  cycleCount = 0;
+  lastAmplitude = 0.0f;
+  lastPeriod = 0.0f;
+  lastDelay = 0.0f;
+  amplitude = 0.0f;
+  ultimateGain = 0.0f;
+  ultimatePeriod = 0.0f;
+  processGain = 0.0f;
+  timeConstant = 0.0f;
+  deadTime = 0.0f;
+  
+  fault = AUTOTUNE_FAULT_NONE;
+  state = AUTOTUNE_RUNNING;
+  return true;
+}
+
+float RelayAutotuner::update(float measurement, unsigned long now) {
+  if (state != AUTOTUNE_RUNNING) return bias;
+  
+  // 安全限制
+  if (now - startTime > AUTOTUNE_TIMEOUT) {
+    fail(AUTOTUNE_FAULT_TIMEOUT);
+    return bias;
+  }
+  if (fabs(measurement - setpoint) > AUTOTUNE_MAX_DEVIATION) {
+    fail(AUTOTUNE_FAULT_DEVIATION);
+    return bias;
+  }
+  
+  // 极值滞后于切换的时间：峰值在切换到高输出之后，谷值在切换到低输出之后
+  if (measurement > cycleMax) {
+    cycleMax = measurement;
+    peakDelay = now - cycleStart;
+  }
+  if (measurement < cycleMin) {
+    cycleMin = measurement;
+    troughDelay = relayHigh ? 0 : now - lowStart;
+  }
+  
+  // 带滞回的继电器；每次切换到高输出时结束一个周期
+  if (!relayHigh && measurement > setpoint + AUTOTUNE_HYSTERESIS) {
+    relayHigh = true;
+    if (cycleStarted) {
+      completeCycle(now);
+    }
+    cycleStarted = true;
+    cycleStart = now;
+    cycleMax = measurement;
+    cycleMin = measurement;
+    peakDelay = 0;
+    troughDelay = 0;
+  } else if (relayHigh && measurement < setpoint - AUTOTUNE_HYSTERESIS) {
+    relayHigh = false;
+    lowStart = now;
+  }
+  
+  if (state != AUTOTUNE_RUNNING) return bias;
+  return relayHigh ? outputHigh : outputLow;
+}
+
+void RelayAutotuner::abort() {
+  if (state == AUTOTUNE_RUNNING) {
+    fail(AUTOTUNE_FAULT_ABORTED);
+  }
+}
+
+RelayAutotuner::State RelayAutotuner::getState() const {
+  return state;
+}
+
+RelayAutotuner::Fault RelayAutotuner::getFault() const {
+  return fault;
+}
+
+bool RelayAutotuner::isActive() const {
+  return state == AUTOTUNE_RUNNING;
+}
+
+uint8_t RelayAutotuner::getCycleCount() const {
+  return cycleCount;
+}
+
+float RelayAutotuner::getAmplitude() const {
+  return amplitude;
+}
+
+float RelayAutotuner::getUltimateGain() const {
+  return ultimateGain;
+}
+
+float RelayAutotuner::getUltimatePeriod() const {
+  return ultimatePeriod;
+}
+
+bool RelayAutotuner::hasModel() const {
+  return processGain > 0.0f;
+}
+
+float RelayAutotuner::getProcessGain() const {
+  return processGain;
+}
+
+float RelayAutotuner::getTimeConstant() const {
+  return timeConstant;
+}
+
+float RelayAutotuner::getDeadTime() const {
+  return deadTime;
+}
+
+void RelayAutotuner::getParameters(float& Kp, float& Ki, float& Kd) const {
+  Kp = 0.6f * ultimateGain;
+  Ki = ultimatePeriod > 0.0f ? 1.2f * ultimateGain / ultimatePeriod : 0.0f;
+  Kd = 0.075f * ultimateGain * ultimatePeriod;
+}
+
+void RelayAutotuner::completeCycle(unsigned long now) {
+  float cycleAmplitude = 0.5f * (cycleMax - cycleMin);
+  float cyclePeriod = (now - cycleStart) / 1000.0f;
+  float cycleDelay = (peakDelay + troughDelay) / 2000.0f;
+  cycleCount++;
+  
+  // 第一个周期包含过渡过程；此后与上一个周期比较
+  if (cycleCount >= 3) {
+    bool settled = fabs(cycleAmplitude - lastAmplitude) <= AUTOTUNE_TOLERANCE * cycleAmplitude &&
+                   fabs(cyclePeriod - lastPeriod) <= AUTOTUNE_TOLERANCE * cyclePeriod;
+    
+    if (settled && cycleCount > AUTOTUNE_MIN_CYCLES) {
+      amplitude = 0.5f * (cycleAmplitude + lastAmplitude);
+      if (amplitude <= AUTOTUNE_HYSTERESIS) {
+        fail(AUTOTUNE_FAULT_UNSTABLE);
+        return;
+      }
+      
+      float relayAmplitude = 0.5f * (outputHigh - outputLow);
+      float period = 0.5f * (cyclePeriod + lastPeriod);
+      if (!identifyModel(0.5f * period, 0.5f * (cycleDelay + lastDelay), relayAmplitude)) {
+        ultimateGain = 4.0f * relayAmplitude /
+                       (PI * sqrt(amplitude * amplitude - AUTOTUNE_HYSTERESIS * AUTOTUNE_HYSTERESIS));
+        ultimatePeriod = period;
+      }
+      state = AUTOTUNE_DONE;
+      return;
+    }
+    
+    if (cycleCount > AUTOTUNE_MAX_CYCLES) {
+      fail(AUTOTUNE_FAULT_UNSTABLE);
+      return;
+    }
+  }
+  
+  lastAmplitude = cycleAmplitude;
+  lastPeriod = cyclePeriod;
+  lastDelay = cycleDelay;
+}
+
+// 消去 τ 后关于 D 的方程 f(D) = 0（见头文件），D > a
+static float modelResidual(float D, float a, float halfPeriod, float delay) {
+  float e = AUTOTUNE_HYSTERESIS;
+  return delay * log((D + a) / (D - e)) / log((D - e) / (D - a)) - (halfPeriod - delay);
+}
+
+bool RelayAutotuner::identifyModel(float halfPeriod, float delay, float relayAmplitude) {
+  float a = amplitude;
+  float e = AUTOTUNE_HYSTERESIS;
+  if (delay <= 0.0f || halfPeriod <= delay) return false;
+  
+  // f 随 D 单调增：D→a 时趋于 -(h - L)，D→∞ 时趋于 L(a + ε)/(a - ε) - (h - L)；
+  // 后者不为正说明滞后相对惯性太小（接近积分过程或测量不准），没有解
+  if (delay * (a + e) / (a - e) <= halfPeriod - delay) return false;
+  
+  float low = a;
+  float high = 2.0f * a;
+  for (uint8_t i = 0; i < 40 && modelResidual(high, a, halfPeriod, delay) < 0.0f; i++) {
+    low = high;
+    high *= 2.0f;
+  }
+  for (uint8_t i = 0; i < 40; i++) {
+    float D = 0.5f * (low + high);
+    if (modelResidual(D, a, halfPeriod, delay) < 0.0f) low = D;
+    else high = D;
+  }
+  float D = 0.5f * (low + high);
+  float tau = delay / log((D - e) / (D - a));
+  if (!(tau > 0.0f)) return false;
+  
+  // 临界频率：相位 atan(ωτ) + ωL = π，ω ∈ (0, π/L)
+  float wLow = 0.0f;
+  float wHigh = PI / delay;
+  for (uint8_t i = 0; i < 40; i++) {
+    float w = 0.5f * (wLow + wHigh);
+    if (atan(w * tau) + w * delay < PI) wLow = w;
+    else wHigh = w;
+  }
+  float w = 0.5f * (wLow + wHigh);
+  
+  processGain = D / relayAmplitude;
+  timeConstant = tau;
+  deadTime = delay;
+  ultimateGain = sqrt(1.0f + w * w * tau * tau) / processGain;
+  ultimatePeriod = 2.0f * PI / w;
+  return true;
+}
+
+void RelayAutotuner::fail(Fault reason) {
+  fault = reason;
+  state = AUTOTUNE_FAILED;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef RELAY_AUTOTUNER_H
+#define RELAY_AUTOTUNER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+
+// 继电反馈自整定（Åström–Hägglund）
+// 以带滞回的继电器代替PID：污染物高于设定值+滞回时输出高，低于设定值-滞回时输出低
+// （反向作用，与 ControlSystem 中的PID一致），过程进入等幅振荡。
+// 描述函数近似 Ku = 4d / (π·√(a² - ε²))（d 为继电幅值，ε 为滞回，a 为振荡幅值）忽略高次谐波，
+// 且振荡频率因滞回的相移低于临界频率，对一阶惯性加纯滞后过程 K·e^(-Ls)/(τs+1) 临界增益偏低 25-40%。
+// 因此按该过程在继电反馈下的精确极限环求解：峰值滞后继电切换的时间即 L，
+//   a = D - (D - ε)·e^(-L/τ)，半周期 h = L + τ·ln((D + a)/(D - ε))，D = K·d，
+// 由 a、h、L 解出 D 与 τ，再由 atan(ωτ) + ωL = π 求临界频率，Ku = √(1 + ω²τ²) / K，Pu = 2π/ω；
+// 不符合该过程（没有解）时退回描述函数近似。滞后远小于惯性时只有 K/τ 确定得较准，
+// 辨识的 K 与 τ 可能同比例偏大，但临界点基本不受影响。最后按 Ziegler–Nichols 规则计算PID参数。
+// 每个控制周期调用一次 update()，不阻塞；第一个周期为过渡过程不计入，
+// 相邻两个周期的幅值与周期一致后结束。偏离设定值过大、超时或不收敛时中止。
+class RelayAutotuner {
+public:
+  enum State : uint8_t {
+    AUTOTUNE_IDLE = 0,
+    AUTOTUNE_RUNNING,
+    AUTOTUNE_DONE,
+    AUTOTUNE_FAILED
+  };
+  
+  enum Fault : uint8_t {
+    AUTOTUNE_FAULT_NONE = 0,
+    AUTOTUNE_FAULT_ABORTED,     // 外部中止（模式切换、紧急状态、复位）
+    AUTOTUNE_FAULT_DEVIATION,   // 污染物偏离设定值超过 AUTOTUNE_MAX_DEVIATION
+    AUTOTUNE_FAULT_TIMEOUT,     // 超过 AUTOTUNE_TIMEOUT
+    AUTOTUNE_FAULT_UNSTABLE     // 振荡不稳定或幅值不超过滞回
+  };
+  
+private:
+  State state;
+  Fault fault;
+  
+  // 继电器
+  float setpoint;
+  float bias;                   // 继电输出的中心 (%)
+  float outputHigh;
+  float outputLow;
+  bool relayHigh;
+  
+  // 当前周期（以切换到高输出为起点）
+  unsigned long startTime;      // (ms)
+  unsigned long cycleStart;
+  unsigned long lowStart;       // 本周期切换到低输出的时刻 (ms)
+  bool cycleStarted;
+  float cycleMax;
+  float cycleMin;
+  unsigned long peakDelay;      // 峰值、谷值滞后于切换的时间 (ms)
+  unsigned long troughDelay;
+  uint8_t cycleCount;           // 已完成的周期数（含过渡周期）
+  
+  // 上一个周期的幅值与周期
+  float lastAmplitude;
+  float lastPeriod;             // (s)
+  float lastDelay;              // (s)
+  
+  // 结果
+  float amplitude;
+  float ultimateGain;           // (%/ppm)
+  float ultimatePeriod;         // (s)
+  float processGain;            // 辨识的过程模型 (ppm/%)，未辨识时为 0
+  float timeConstant;           // (s)
+  float deadTime;               // (s)
+  
+public:
+  RelayAutotuner();
+  
+  // 以当前输出为中心开始整定（中心限制在 [幅值, 100-幅值] 内，使继电器对称），
+  // 正在整定时返回 false
+  bool start(float setpoint, float currentOutput, unsigned long now);
+  
+  // 每个控制周期调用，返回本周期的输出 (%)；结束或中止后返回继电中心
+  float update(float measurement, unsigned long now);
+  
+  void abort();
+  
+  State getState() const;
+  Fault getFault() const;
+  bool isActive() const;
+  uint8_t getCycleCount() const;
+  float getAmplitude() const;
+  float getUltimateGain() const;
+  float getUltimatePeriod() const;
+  bool hasModel() const;
+  float getProcessGain() const;
+  float getTimeConstant() const;
+  float getDeadTime() const;
+  
+  // Ziegler–Nichols：Kp = 0.6Ku，Ti = Pu/2，Td = Pu/8；Ki = Kp/Ti，Kd = Kp·Td
+  void getParameters(float& Kp, float& Ki, float& Kd) const;
+  
+private:
+  // 一个完整周期结束：判断是否稳定，稳定后计算结果
+  void completeCycle(unsigned long now);
+  
+  // 由幅值、半周期与峰值滞后辨识过程模型并求临界点，没有解时返回 false
+  bool identifyModel(float halfPeriod, float delay, float relayAmplitude);
+  void fail(Fault reason);
+};
+
+#endif // RELAY_AUTOTUNER_H
\ No newline at end of file
@@ -2,11 +2,25 @@
 #define COMMON_TYPES_H
 
 #include <Arduino.h>
+#include "SystemConfig.h"
+#include "../Utilities/FixedPoint.h"
+
+// ========== 传感器处理链数值类型 ==========
+// 定点模式下从ADC快照到物理量换算全部使用整数运算，
+// 只在填充 SensorData 时转换为 float
+#if SENSOR_FIXED_POINT
+typedef Fix16 SensorValue;        // Q16.16
+typedef Fix16Scale SensorScale;   // Q8.24
+#else
+typedef float SensorValue;
+typedef float SensorScale;
+#endif
 
 // ========== 基本数据类型定义 ==========
 struct SensorData {
   float flowRate;          // 流量 (cm/s)
-  float pollutionLevel;    // 污染物浓度 (ppm)
+  float pollutionLevel;    // 污染物浓度 (ppm)，主循环中替换为融合值
+  float measuredPollution; // 融合前的污染物测量值 (ppm)
   float lightIntensity;    // 光照强度 (lux)
   float pH;                // pH值
   float temperature;       // 温度 (°C)
@@ -14,6 +28,35 @@ struct SensorData {
   float systemEfficiency;  // 系统效率 (%)
   bool sensorFaults[5];    // 传感器故障标志
   float dataQuality[5];    // 数据质量指标 [0-1]
+  uint8_t resolutionBits[5]; // 有效分辨率 (bit)
+  unsigned long sampleAge[5]; // 各通道距上次更新的时间 (ms)
+};
+
+// 采样周期变化事件（由 SensorManager 产生，主循环取出后通知下游模块）
+struct SampleRateEvent {
+  uint8_t sensorIndex;
+  unsigned long previousPeriod; // 原采样周期 (ms)
+  unsigned long newPeriod;      // 新采样周期 (ms)
+  unsigned long timestamp;      // 变化时刻 millis()
+};
+
+// 漂移监测阶段（见 Sensors/DriftMonitor.h）
+enum DriftPhase : uint8_t {
+  DRIFT_WAITING = 0,      // 等待回归模型训练完成
+  DRIFT_BASELINE,         // 记录参考预测与测量值之间的基线关系
+  DRIFT_TRACKING          // 与基线比较
+};
+
+// 单个通道的长期残差统计与漂移估计
+struct DriftStatus {
+  DriftPhase phase;
+  float residualMean;     // 测量值 - 参考预测 的长期平均
+  float residualRms;
+  float offset;           // 相对基线的漂移：测量值 ≈ offset + gain·真值
+  float gain;
+  float error;            // 当前工作点上的漂移量（物理单位）
+  uint16_t samples;       // 当前阶段的样本数
+  bool exceeded;          // 判定为漂移来源且超限，offset/gain 为修正建议
 };
 
 struct ControlDecision {
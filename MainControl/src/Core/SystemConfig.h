@@ -5,6 +5,15 @@
 
 // ========== 系统配置参数 ==========
 #define DEBUG_MODE true            // 调试模式开关
+// 定点运算只到 SensorData 为止：其后的融合、回归与漂移监测数值范围大，仍使用 float
+#ifndef SENSOR_FIXED_POINT
+#define SENSOR_FIXED_POINT false   // 传感器处理链使用Q16.16定点运算（无FPU目标），主机测试可在命令行指定
+#endif
+#define SENSOR_ROBUST_SAMPLING true // 原始采样使用截尾均值代替算术平均，抑制ADC毛刺
+#define SENSOR_ADAPTIVE_SAMPLING true // 按数据离散度与变化率自动调整各通道采样周期
+#define SENSOR_SPECTRUM_ANALYSIS true // 按频谱区分周期性脉动、宽带噪声与漂移，噪声计入数据质量与故障检测
+#define EMERGENCY_FAST_PATH true   // 污染物原始值超限时不等待采样周期，直接进入紧急状态
+#define SENSOR_DRIFT_MONITOR true  // 以其余通道与数字孪生的预测为参考，长期监测各通道漂移
 
 // 引脚定义
 #define FLOW_SENSOR_PIN A0         // 流量传感器引脚
@@ -15,10 +24,15 @@
 #define SERVO_PIN 9                // 舵机控制引脚
 #define BUZZER_PIN 10              // 蜂鸣器报警引脚
 
+// 传感器通道（顺序即 SensorData / sensorFaults[] 的索引顺序）
+#define SENSOR_COUNT 5
+#define SENSOR_PIN_LIST { FLOW_SENSOR_PIN, POLLUTION_SENSOR_PIN, LIGHT_SENSOR_PIN, \
+                          PH_SENSOR_PIN, TEMPERATURE_SENSOR_PIN }
+
 // 系统参数
 #define TARGET_POLLUTION 100.0     // 目标污染物浓度 (ppm)
 #define MAX_ENERGY_USAGE 80.0      // 最大能耗限制 (%)
-#define SAMPLING_INTERVAL 1000     // 采样间隔 (ms)
+#define SAMPLING_INTERVAL 1000     // 默认采样间隔 (ms)
 #define LEARNING_INTERVAL 60000    // 学习间隔 (ms)
 #define CONTROL_INTERVAL 100       // 控制周期 (ms)
 
@@ -27,6 +41,179 @@
 #define POLLUTION_BUFFER_SIZE 10
 #define LIGHT_BUFFER_SIZE 5
 #define PH_BUFFER_SIZE 5
+#define TEMP_BUFFER_SIZE 5
+#define STABILITY_WINDOW_SIZE 5    // 稳定性评估滑动窗口
+
+// ADC后台采样
+#define ADC_RECENT_SAMPLES 10      // 每通道保留的最近原始样本数
+#define ROBUST_SAMPLE_WINDOW 9     // 鲁棒采样窗口（5、7或9，不超过 ADC_RECENT_SAMPLES）
+#define ROBUST_TRIM_COUNT 2        // 排序后两端各剔除的样本数，(窗口-1)/2 时即为中值
+
+// 原始ADC突发采集（诊断用，见 Sensors/CaptureBuffer.h）
+#define CAPTURE_MAX_SAMPLES 1024   // 缓冲区容量（样本），每个样本占用1.25字节SRAM
+#define CAPTURE_MAX_RATE 4000      // 最高采样率 (Hz)，受单次转换时间（约104us）限制
+#define CAPTURE_DEFAULT_RATE 1000
+#define CAPTURE_LINE_SAMPLES 16    // 输出时每行的样本数
+#define CAPTURE_WIFI_BYTES 32      // 每次循环经WiFi发送的最大字节数（软件串口发送时阻塞）
+
+// 紧急快速通道（见 Sensors/EmergencyWatchdog.h）
+// 被监视通道的每次ADC转换都与阈值比较，阈值按当前校准换算为原始值
+#define EMERGENCY_CHANNEL 1        // 被监视的通道（污染物）
+#define EMERGENCY_TRIP_LEVEL 450.0 // 触发浓度 (ppm)
+#define EMERGENCY_CLEAR_LEVEL 400.0 // 解除浓度 (ppm)，持续低于此值 EMERGENCY_CLEAR_TIME 后解除
+#define EMERGENCY_TRIP_SLOPE 50.0  // 浓度高于解除值且上升速率超过此值 (ppm/s) 时也触发
+#define EMERGENCY_SLOPE_WINDOW 500 // 上升速率的计算间隔 (ms)
+#define EMERGENCY_CONFIRM_SAMPLES 3 // 连续超限的转换次数（抑制单个毛刺）
+#define EMERGENCY_CLEAR_TIME 2000  // (ms)
+#define EMERGENCY_WATCH_INTERVAL 20 // 批次之间单独转换被监视通道的间隔 (ms)
+
+// 漂移监测（见 Sensors/DriftMonitor.h）
+#define DRIFT_UPDATE_INTERVAL 10000 // 统计更新间隔 (ms)
+#define DRIFT_TIME_CONSTANT 6.0    // 残差平均的时间常数 (h)，基线记录与每次判断各需一个时间常数
+#define DRIFT_OFFSET_LIMIT 0.03    // 工作点上的漂移超过量程的此比例时给出修正建议
+#define DRIFT_GAIN_LIMIT 0.05      // 增益漂移超过此比例时给出修正建议
+#define DRIFT_MIN_EXCITATION 0.05  // 参考预测的标准差达到量程的此比例时才估计增益
+#define DRIFT_MAX_OFFSET_STEP 0.05 // 每次修正在工作点上的修正量上限（量程的比例）
+#define DRIFT_MAX_GAIN_STEP 0.1    // 每次修正的增益变化上限
+#define DRIFT_TWIN_WEIGHT 0.25     // 污染物通道参考中数字孪生预测的权重
+#define DRIFT_ISOLATION_MARGIN 0.05 // 与最优的漂移来源假设相差不超过此比例的假设视为无法区分
+#define DRIFT_PRONE_CHANNELS 0x0A  // 易漂移通道的位掩码（电化学探头：污染物、pH），无法区分时优先
+#define DRIFT_AUTO_CORRECT false   // 超限时自动修正；否则只给出建议，由 drift apply 命令确认
+#define DRIFT_LOG_INTERVAL 3600000UL // 残差统计记录间隔 (ms)
+
+// 模型预测控制（见 Control/PredictiveController.h），每个控制周期为一步
+#define MPC_HORIZON 100            // 预测时域（步），只影响模型改变时的预计算
+#define MPC_BLOCKS 3               // 移动分块数（决策变量数），求解计算量约与其平方成正比
+#define MPC_TRACKING_WEIGHT 1.0    // 跟踪误差权重 (1/ppm²)
+#define MPC_MOVE_WEIGHT 50.0       // 控制量变化权重 (1/%²)
+#define MPC_ENERGY_WEIGHT 0.05     // 能耗权重（每步，1/%）
+#define MPC_MAX_RATE 5.0           // 每步最大变化量 (%)
+#define MPC_STRESS_GAIN 2.0        // 满输出时催化反应速率提高的倍数
+#define MPC_DISTURBANCE_GAIN 0.2   // 扰动估计的更新系数
+#define MPC_RELINEARIZE_TOLERANCE 0.1 // 线性化模型相对变化超过此值时重新预计算
+#define MPC_MAX_ITERATIONS 30      // 有效集法的最大迭代次数
+#define MPC_TOLERANCE 1e-4         // 判断约束有效的相对容差（按约束范围）
+
+// 显式MPC（见 Control/ExplicitController.h），网格改变后需用 'mpc table' 或主机测试的 make table 重新生成表格
+#ifndef MPC_EXPLICIT
+#define MPC_EXPLICIT true          // 查表求控制量，超出表格范围时在线求解；false 时总是在线求解（主机生成表格时）
+#endif
+#define MPC_TABLE_TARGET_TOLERANCE 2.0 // 设定值与表格的线性化点 TARGET_POLLUTION 相差超过此值时在线求解 (ppm)
+#define MPC_TABLE_RATE_MIN 0.005   // 表格覆盖的基础反应速率 (1/s)，按对数等分
+#define MPC_TABLE_RATE_MAX 0.2
+#define MPC_TABLE_RATE_POINTS 9
+#define MPC_TABLE_OUTPUT_POINTS 11 // 稳态输出与上次输出的网格点数（0-100% 等分）
+#define MPC_TABLE_ERROR_MIN -100.0 // 表格覆盖的跟踪误差 (ppm)
+#define MPC_TABLE_ERROR_MAX 300.0
+#define MPC_TABLE_ERROR_POINTS 13
+
+// 模糊增益调整（见 Control/FuzzyLogic.h），误差与误差变化率映射到论域 0-100 的两端
+#define FUZZY_ERROR_RANGE 100.0    // 跟踪误差满量程 (ppm)
+#define FUZZY_RATE_RANGE 20.0      // 误差变化率满量程 (ppm/s)
+#define FUZZY_SURFACE_POINTS 9     // 控制曲面每维网格点数，占用 4·点数² 字节
+
+// PID（见 Control/PIDController.h），积分与微分按实测的计算间隔
+#ifndef PID_FIXED_POINT
+#define PID_FIXED_POINT false      // PID使用Q16.16定点运算（耗时见 fixed bench），主机测试可在命令行指定
+#endif
+#define PID_MIN_INTERVAL 1000UL    // 最小计算间隔 (us)，更短时保持上次输出
+#define PID_MAX_INTERVAL 1000000UL // 最大计算间隔 (us)，超过时按此值积分并跳过微分
+#define PID_EEPROM_ADDR 160        // 整定后的PID参数（3个float + 校验和），在校准表之后
+
+// 增益调度（见 Control/GainSchedule.h）：按控制模式与污染物浓度档位调整PID参数
+#define GAIN_SCHEDULE_BAND_LOW 150.0  // 低/中浓度档位分界 (ppm)
+#define GAIN_SCHEDULE_BAND_HIGH 300.0 // 中/高浓度档位分界 (ppm)
+#define GAIN_SCHEDULE_HYSTERESIS 10.0 // 档位切换滞回 (ppm)
+
+// 继电反馈自整定（见 Control/RelayAutotuner.h），由 'autotune' 命令启动
+#define AUTOTUNE_RELAY_AMPLITUDE 20.0 // 继电幅值 (%)，围绕启动时的输出切换
+#define AUTOTUNE_HYSTERESIS 1.0    // 继电器滞回 (ppm)，应大于污染物读数噪声的峰值，否则噪声引起多余切换；
+                                   // 滞回的相移在临界点计算中已补偿，噪声使幅值偏大，±0.25 ppm 时 Ku 最多偏低约 6%
+#define AUTOTUNE_MAX_DEVIATION 100.0 // 污染物偏离设定值超过此值时中止 (ppm)
+#define AUTOTUNE_MIN_CYCLES 3      // 至少测量的振荡周期数（不含第一个过渡周期）
+#define AUTOTUNE_MAX_CYCLES 12     // 超过此周期数仍不稳定时中止
+#define AUTOTUNE_TOLERANCE 0.05    // 相邻周期幅值与周期的相对差别小于此值时视为稳定
+#define AUTOTUNE_TIMEOUT 3600000UL // 最长持续时间 (ms)
+
+// 传感器数据源（见 Sensors/SensorSource.h）
+#define SENSOR_SOURCE_ADC 0        // 板载ADC
+#define SENSOR_SOURCE_TRACE 1      // 回放记录数据
+#define SENSOR_SOURCE_SYNTHETIC 2  // 合成数据
+#ifndef SENSOR_SOURCE                       // 主机测试可在编译命令行中选择
+#define SENSOR_SOURCE SENSOR_SOURCE_ADC
+#endif
+#define SENSOR_TRACE_FILE "trace.csv"
+#define SYNTHETIC_SEED 12345UL
+
+// 毛刺剔除（Hampel滤波）
+#define HAMPEL_WINDOW_SIZE 5       // 中值窗口（5、7或9）
+
+// 频谱分析（见 Sensors/SpectrumAnalyzer.h）
+#define SPECTRUM_FFT_SIZE 64       // 每帧样本数（2的幂，64-256），每通道占用2N字节SRAM
+#define SPECTRUM_BUTTERFLIES_PER_PASS 8 // 每次主循环执行的蝶形运算数（64点共192次）
+#define SPECTRUM_MIN_RMS 0.5       // 交流有效值（ADC计数）低于此值视为平稳
+#define SPECTRUM_NOISE_LIMIT 8.0   // 高频段噪声有效值（ADC计数）达到此值时数据质量降为0
+#define SPECTRUM_FAULT_NOISE 20.0  // 高频段噪声有效值超过此值判定为传感器故障
+
+// 多点校准（见 Sensors/Calibration.h）
+#define CALIBRATION_POINTS 5       // 每通道最多校准点数（至少3）
+#define CALIBRATION_MERGE_DISTANCE 8  // 原始值相距不超过此值的校准点视为同一点
+#define CALIBRATION_EEPROM_ADDR 40 // 校准表起始地址（0-39为各通道偏移/增益）
+#define PH_REFERENCE_TEMP 25.0     // pH校准参考温度 (°C)
+
+// 每通道采样调度（顺序同 SENSOR_PIN_LIST）
+// 流量和污染物变化快，按控制周期采样；光照、pH和温度变化较慢
+#define FLOW_SAMPLE_PERIOD CONTROL_INTERVAL      // 采样周期 (ms)
+#define POLLUTION_SAMPLE_PERIOD CONTROL_INTERVAL
+#define LIGHT_SAMPLE_PERIOD SAMPLING_INTERVAL
+#define PH_SAMPLE_PERIOD 5000
+#define TEMP_SAMPLE_PERIOD 10000
+#define FLOW_OVERSAMPLE 10                       // 每次采样的ADC转换次数
+#define POLLUTION_OVERSAMPLE 10
+#define LIGHT_OVERSAMPLE 10
+#define PH_OVERSAMPLE 16
+#define TEMP_OVERSAMPLE 16
+#define SENSOR_PERIOD_LIST { FLOW_SAMPLE_PERIOD, POLLUTION_SAMPLE_PERIOD, LIGHT_SAMPLE_PERIOD, \
+                             PH_SAMPLE_PERIOD, TEMP_SAMPLE_PERIOD }
+#define SENSOR_OVERSAMPLE_LIST { FLOW_OVERSAMPLE, POLLUTION_OVERSAMPLE, LIGHT_OVERSAMPLE, \
+                                 PH_OVERSAMPLE, TEMP_OVERSAMPLE }
+
+// 过采样抽取：每通道额外分辨率位数 n (0-4)，非0时每批转换 4^n 次（代替上面的次数），
+// 样本和右移 n 位得到 10+n 位读数。信号上需有约1 LSB以上的噪声，否则多出的位数无效。
+// 每次转换约104us（ADC时钟125kHz），n=1/2/3/4 每批约 0.4/1.7/6.7/26.6 ms
+#define FLOW_DECIMATION_BITS 0
+#define POLLUTION_DECIMATION_BITS 2
+#define LIGHT_DECIMATION_BITS 0
+#define PH_DECIMATION_BITS 2
+#define TEMP_DECIMATION_BITS 2
+#define SENSOR_DECIMATION_LIST { FLOW_DECIMATION_BITS, POLLUTION_DECIMATION_BITS, LIGHT_DECIMATION_BITS, \
+                                 PH_DECIMATION_BITS, TEMP_DECIMATION_BITS }
+
+// 自适应采样周期范围：剧烈变化时周期立即减半，持续平稳时逐步加倍
+#define FLOW_MIN_PERIOD 50                       // 采样周期下限 (ms)
+#define POLLUTION_MIN_PERIOD 50
+#define LIGHT_MIN_PERIOD 250
+#define PH_MIN_PERIOD 1000
+#define TEMP_MIN_PERIOD 2000
+#define FLOW_MAX_PERIOD 1000                     // 采样周期上限 (ms)
+#define POLLUTION_MAX_PERIOD 1000
+#define LIGHT_MAX_PERIOD 10000
+#define PH_MAX_PERIOD 30000
+#define TEMP_MAX_PERIOD 60000
+#define SENSOR_MIN_PERIOD_LIST { FLOW_MIN_PERIOD, POLLUTION_MIN_PERIOD, LIGHT_MIN_PERIOD, \
+                                 PH_MIN_PERIOD, TEMP_MIN_PERIOD }
+#define SENSOR_MAX_PERIOD_LIST { FLOW_MAX_PERIOD, POLLUTION_MAX_PERIOD, LIGHT_MAX_PERIOD, \
+                                 PH_MAX_PERIOD, TEMP_MAX_PERIOD }
+#define SAMPLE_RATE_EVENT_QUEUE 8                // 待处理的采样周期变化事件数
+#define SAMPLE_RATE_LOG_INTERVAL 5000            // 调试输出采样周期变化的最小间隔 (ms)
+
+// 离散度（方差/均值）与偏离比例的分母下限，为量程的比例：
+// 读数接近量程下限时窗口均值接近0，以均值为分母的比值会失控
+#define FLOW_DISPERSION_FLOOR 0.05
+#define POLLUTION_DISPERSION_FLOOR 0.02
+#define LIGHT_DISPERSION_FLOOR 0.05
+#define PH_DISPERSION_FLOOR 0.02
+#define TEMP_DISPERSION_FLOOR 0.02
 
 // 传感器范围
 #define FLOW_MIN 0.0
@@ -102,6 +102,19 @@ bool DataStorage::logSystemStatus(const DigitalTwinData& twin, uint32_t timestam
   return appendData(logEntry);
 }
 
+bool DataStorage::logDriftStatus(uint8_t channel, const DriftStatus& drift, uint32_t timestamp) {
+  // 通道,阶段,残差均值,残差均方根,漂移偏移,漂移增益,样本数
+  String logEntry = String(timestamp) + ",Drift," +
+                   String(channel) + "," +
+                   String(drift.phase) + "," +
+                   String(drift.residualMean, 3) + "," +
+                   String(drift.residualRms, 3) + "," +
+                   String(drift.offset, 3) + "," +
+                   String(drift.gain, 4) + "," +
+                   String(drift.samples);
+  return appendData(logEntry);
+}
+
 bool DataStorage::readHistoricalData(uint32_t startTime, uint32_t endTime, 
                                     void (*callback)(const String& data)) {
   // 简化实现
@@ -54,6 +54,7 @@ public:
   bool logSensorData(const SensorData& data, uint32_t timestamp);
   bool logControlData(const ControlDecision& decision, uint32_t timestamp);
   bool logSystemStatus(const DigitalTwinData& twin, uint32_t timestamp);
+  bool logDriftStatus(uint8_t channel, const DriftStatus& drift, uint32_t timestamp);
   
   // 数据检索
   bool readHistoricalData(uint32_t startTime, uint32_t endTime, 
@@ -1,6 +1,8 @@
 #include "DigitalTwin.h"
 #include "../Core/SystemConfig.h"
 
+static const size_t TREND_WINDOW = 10;  // 趋势分析窗口（仿真周期数）
+
 DigitalTwin::DigitalTwin() {
   initialize();
 }
@@ -159,20 +161,11 @@ float DigitalTwin::calculateSystemHealth(const SensorData& sensors) {
 float DigitalTwin::calculatePerformanceTrend() {
   if (pollutionHistory.size() < 3) return 0.0f;
   
-  // 简化趋势计算：最近3个点的平均变化率
-  float recentValues[3];
-  for (int i = 0; i < 3 && i < pollutionHistory.size(); i++) {
-    pollutionHistory.get(i, recentValues[i]);
-  }
-  
-  float trend = 0.0f;
-  for (int i = 1; i < 3; i++) {
-    if (recentValues[i-1] > 0.0f) {
-      trend += (recentValues[i] - recentValues[i-1]) / recentValues[i-1];
-    }
-  }
+  // 最近窗口的最小二乘斜率，按窗口均值归一化为每周期相对变化率
+  float average = pollutionHistory.getAverage(TREND_WINDOW);
+  if (average <= 0.0f) return 0.0f;
   
-  return trend / 2.0f; // 平均趋势
+  return pollutionHistory.getTrend(TREND_WINDOW) / average;
 }
 
 const DigitalTwinData& DigitalTwin::getCurrentState() const {
@@ -201,8 +194,8 @@ float DigitalTwin::arimaPrediction() {
   if (pollutionHistory.size() < 2) return 250.0f; // 默认值
   
   float lastValue, secondLastValue;
-  pollutionHistory.get(0, lastValue);
-  pollutionHistory.get(1, secondLastValue);
+  pollutionHistory.getRecent(0, lastValue);
+  pollutionHistory.getRecent(1, secondLastValue);
   
   // 简化的AR(1)模型：y(t) = 0.8*y(t-1) + 0.2*y(t-2)
   return 0.8f * lastValue + 0.2f * secondLastValue;
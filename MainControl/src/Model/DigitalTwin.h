@@ -11,9 +11,9 @@ private:
   SystemModel systemModel;
   
   // 历史数据
-  CircularBuffer<float, 20> pollutionHistory;
-  CircularBuffer<float, 20> efficiencyHistory;
-  CircularBuffer<float, 20> energyHistory;
+  HistoryBuffer<20> pollutionHistory;
+  StatisticalBuffer<float, 20, true> efficiencyHistory;
+  StatisticalBuffer<float, 20, true> energyHistory;
   
   // 预测模型参数
   float predictionWeights[3]; // ARIMA, 物理模型, 机器学习权重
@@ -0,0 +1,318 @@
+#include "AdcSampler.h"
+
+AdcSampler* AdcSampler::activeInstance = nullptr;
+
+AdcSampler::AdcSampler()
+  : captureConversion(false), watchPending(false), watchConversion(false),
+    currentChannel(0), converting(false), running(false) {
+  const uint8_t pins[SENSOR_COUNT] = SENSOR_PIN_LIST;
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    channelPins[i] = pins[i];
+  }
+  clear();
+}
+
+bool AdcSampler::begin() {
+  activeInstance = this;
+  currentChannel = 0;
+  converting = false;
+  captureConversion = false;
+  watchPending = false;
+  watchConversion = false;
+  running = true;
+
+#if defined(__AVR__)
+  // 使能ADC及转换完成中断，128分频（16MHz下125kHz，约9.6k次转换/秒）
+  ADCSRA = (1 << ADEN) | (1 << ADIE) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+#endif
+
+  return true;
+}
+
+void AdcSampler::stop() {
+  running = false;
+  converting = false;
+#if defined(__AVR__)
+  ADCSRA &= ~(1 << ADIE);
+#endif
+}
+
+bool AdcSampler::isRunning() const {
+  return running;
+}
+
+void AdcSampler::request(uint8_t channel, uint16_t sampleCount) {
+  if (channel >= SENSOR_COUNT || sampleCount == 0) return;
+  
+  noInterrupts();
+  batchSum[channel] = 0;
+  batchCount[channel] = 0;
+  pendingSamples[channel] = sampleCount;
+  batchStart[channel] = micros();
+  
+  // ADC空闲时立即启动
+  bool start = running && !converting;
+  if (start) {
+    currentChannel = channel;
+    converting = true;
+  }
+  interrupts();
+  
+  if (start) {
+    selectChannel(channel);
+    startConversion();
+  }
+}
+
+bool AdcSampler::isBusy() const {
+  return converting;
+}
+
+bool AdcSampler::onConversionComplete(uint16_t value) {
+  uint8_t ch = currentChannel;
+  unsigned long now = micros();
+  
+  // 紧急监视检查每一次转换，不等待批次完成
+  watchdog.check(ch, value, now);
+  
+  // 突发采集的转换只在到期时记录
+  if (captureConversion) {
+    captureConversion = false;
+    if (capture.isDue(now)) {
+      capture.store(value, now);
+    }
+    return selectNext(ch + 1);
+  }
+  
+  // 监视转换只用于阈值检查
+  if (watchConversion) {
+    watchConversion = false;
+    return selectNext(ch);
+  }
+  
+  // 最近原始样本
+  uint8_t idx = sampleIndex[ch];
+  samples[ch][idx] = value;
+  idx++;
+  if (idx >= ADC_RECENT_SAMPLES) idx = 0;
+  sampleIndex[ch] = idx;
+  conversionCount[ch]++;
+  
+  // 累加到当前批次，批次完成时锁存结果
+  if (pendingSamples[ch] > 0) {
+    batchSum[ch] += value;
+    batchCount[ch]++;
+    pendingSamples[ch]--;
+    
+    if (pendingSamples[ch] == 0) {
+      resultSum[ch] = batchSum[ch];
+      resultCount[ch] = batchCount[ch];
+      resultMicros[ch] = now - batchStart[ch];
+      batchSequence[ch]++;
+    }
+  }
+  
+  // 轮询下一个通道，使各通道的批次交错进行
+  return selectNext(ch + 1);
+}
+
+bool AdcSampler::snapshot(uint8_t channel, AdcSnapshot& out) const {
+  if (channel >= SENSOR_COUNT) return false;
+  
+  noInterrupts();
+  out.sum = resultSum[channel];
+  out.count = resultCount[channel];
+  out.sequence = batchSequence[channel];
+  out.conversions = conversionCount[channel];
+  out.batchMicros = resultMicros[channel];
+  interrupts();
+  
+  return out.count > 0;
+}
+
+float AdcSampler::getAverage(uint8_t channel) const {
+  AdcSnapshot snap;
+  if (!snapshot(channel, snap)) return 0.0f;
+  return static_cast<float>(snap.sum) / snap.count;
+}
+
+uint8_t AdcSampler::getRecentSamples(uint8_t channel, uint16_t* out, uint8_t maxCount) const {
+  if (channel >= SENSOR_COUNT || out == nullptr) return 0;
+  
+  uint8_t n = maxCount < ADC_RECENT_SAMPLES ? maxCount : ADC_RECENT_SAMPLES;
+  
+  // 从最新样本向前复制；32位计数在AVR上分多次读取，与复制一起在关中断状态下进行
+  noInterrupts();
+  if (conversionCount[channel] < n) {
+    n = static_cast<uint8_t>(conversionCount[channel]);
+  }
+  uint8_t idx = sampleIndex[channel];
+  for (uint8_t i = 0; i < n; i++) {
+    idx = (idx == 0) ? ADC_RECENT_SAMPLES - 1 : idx - 1;
+    out[i] = samples[channel][idx];
+  }
+  interrupts();
+  
+  return n;
+}
+
+uint8_t AdcSampler::getCurrentChannel() const {
+  return currentChannel;
+}
+
+bool AdcSampler::startCapture(uint8_t channel, uint16_t rateHz, uint16_t samples) {
+  if (!capture.start(channel, rateHz, samples)) return false;
+  
+  // ADC空闲时立即启动
+  noInterrupts();
+  bool start = running && !converting;
+  if (start) {
+    currentChannel = channel;
+    captureConversion = true;
+    converting = true;
+  }
+  interrupts();
+  
+  if (start) {
+    selectChannel(channel);
+    startConversion();
+  }
+  return true;
+}
+
+void AdcSampler::stopCapture() {
+  capture.cancel();
+}
+
+const CaptureBuffer& AdcSampler::getCapture() const {
+  return capture;
+}
+
+EmergencyWatchdog& AdcSampler::getWatchdog() {
+  return watchdog;
+}
+
+void AdcSampler::requestWatch() {
+  if (!watchdog.isEnabled()) return;
+  
+  uint8_t channel = watchdog.getChannel();
+  
+  // ADC空闲时立即启动，否则在当前转换完成后插入
+  noInterrupts();
+  bool start = running && !converting;
+  if (start) {
+    currentChannel = channel;
+    watchConversion = true;
+    converting = true;
+  } else {
+    watchPending = true;
+  }
+  interrupts();
+  
+  if (start) {
+    selectChannel(channel);
+    startConversion();
+  }
+}
+
+void AdcSampler::clear() {
+  noInterrupts();
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    for (uint8_t j = 0; j < ADC_RECENT_SAMPLES; j++) {
+      samples[i][j] = 0;
+    }
+    sampleIndex[i] = 0;
+    batchSum[i] = 0;
+    batchCount[i] = 0;
+    pendingSamples[i] = 0;
+    batchStart[i] = 0;
+    resultSum[i] = 0;
+    resultCount[i] = 0;
+    batchSequence[i] = 0;
+    conversionCount[i] = 0;
+    resultMicros[i] = 0;
+  }
+  interrupts();
+}
+
+void AdcSampler::handleInterrupt() {
+  AdcSampler* sampler = activeInstance;
+  if (sampler == nullptr || !sampler->running) return;
+
+#if defined(__AVR__)
+  if (sampler->onConversionComplete(ADC)) {
+    sampler->selectChannel(sampler->currentChannel);
+    sampler->startConversion();
+  }
+#endif
+}
+
+bool AdcSampler::selectNext(uint8_t start) {
+  if (start >= SENSOR_COUNT) start = 0;
+  
+  // 监视转换在采集之外优先于批次
+  if (watchPending && !capture.isDue(micros())) {
+    watchPending = false;
+    currentChannel = watchdog.getChannel();
+    watchConversion = true;
+    converting = true;
+    return true;
+  }
+  
+  // 采集样本到期时优先转换采集通道
+  if (!capture.isDue(micros())) {
+    if (selectNextPending(start)) {
+      converting = true;
+      return true;
+    }
+    if (!capture.isRunning()) {
+      converting = false;
+      return false;
+    }
+  }
+  
+  // 采集到期，或没有其他任务时持续转换采集通道，保持ADC运行
+  currentChannel = capture.getChannel();
+  captureConversion = true;
+  converting = true;
+  return true;
+}
+
+bool AdcSampler::selectNextPending(uint8_t start) {
+  uint8_t ch = start;
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    if (pendingSamples[ch] > 0) {
+      currentChannel = ch;
+      return true;
+    }
+    ch++;
+    if (ch >= SENSOR_COUNT) ch = 0;
+  }
+  return false;
+}
+
+void AdcSampler::selectChannel(uint8_t channel) {
+#if defined(__AVR__)
+  uint8_t pin = channelPins[channel];
+  uint8_t adcChannel = pin >= A0 ? pin - A0 : pin;
+
+#if defined(MUX5)
+  // ATmega2560: 通道8-15需要设置MUX5
+  ADCSRB = (ADCSRB & ~(1 << MUX5)) | (((adcChannel >> 3) & 0x01) << MUX5);
+#endif
+  // AVcc作为参考电压
+  ADMUX = (1 << REFS0) | (adcChannel & 0x07);
+#endif
+}
+
+void AdcSampler::startConversion() {
+#if defined(__AVR__)
+  ADCSRA |= (1 << ADSC);
+#endif
+}
+
+#if defined(__AVR__)
+ISR(ADC_vect) {
+  AdcSampler::handleInterrupt();
+}
+#endif
\ No newline at end of file
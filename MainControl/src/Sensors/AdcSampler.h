@@ -0,0 +1,117 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+#include "CaptureBuffer.h"
+#include "EmergencyWatchdog.h"
+
+// 通道快照（在关中断状态下一次性复制）
+struct AdcSnapshot {
+  uint32_t sum;            // 最近一批样本之和
+  uint16_t count;          // 最近一批样本数
+  uint32_t sequence;       // 已完成的批次数
+  uint32_t conversions;    // 该通道累计转换次数
+  uint32_t batchMicros;    // 最近一批从申请到完成的耗时 (us)
+};
+
+// 中断驱动的后台ADC采样引擎
+// 主循环通过 request() 为某个通道申请一批转换，ADC转换完成中断
+// 在所有有待转换任务的通道之间轮流切换，批次完成后锁存结果。
+// 没有待转换任务时ADC停止，慢速通道不占用转换时间。
+// 每个通道另外保留最近 ADC_RECENT_SAMPLES 个原始样本。
+// 突发采集期间，采集通道的样本到期时优先转换；没有其他任务时持续转换采集通道，
+// 只记录到期的结果，采样时刻的抖动不超过一次转换时间。采集样本不计入批次。
+// 每次转换的结果（含突发采集）都先经过紧急监视的阈值检查；
+// requestWatch() 在批次之间为被监视通道插入一次单独的转换，同样不计入批次。
+class AdcSampler {
+private:
+  uint8_t channelPins[SENSOR_COUNT];
+  
+  // 最近原始样本环形缓冲区（由中断写入）
+  volatile uint16_t samples[SENSOR_COUNT][ADC_RECENT_SAMPLES];
+  volatile uint8_t sampleIndex[SENSOR_COUNT];
+  
+  // 进行中的批次
+  volatile uint32_t batchSum[SENSOR_COUNT];
+  volatile uint16_t batchCount[SENSOR_COUNT];
+  volatile uint16_t pendingSamples[SENSOR_COUNT];
+  volatile unsigned long batchStart[SENSOR_COUNT];
+  
+  // 最近完成的批次
+  volatile uint32_t resultSum[SENSOR_COUNT];
+  volatile uint16_t resultCount[SENSOR_COUNT];
+  volatile uint32_t batchSequence[SENSOR_COUNT];
+  volatile uint32_t conversionCount[SENSOR_COUNT];
+  volatile uint32_t resultMicros[SENSOR_COUNT];
+  
+  // 突发采集
+  CaptureBuffer capture;
+  volatile bool captureConversion;   // 当前转换属于突发采集
+  
+  // 原始值紧急监视
+  EmergencyWatchdog watchdog;
+  volatile bool watchPending;        // 有待执行的监视转换
+  volatile bool watchConversion;     // 当前转换属于监视转换
+  
+  // 当前正在转换的通道
+  volatile uint8_t currentChannel;
+  volatile bool converting;
+  bool running;
+  
+  // 中断服务程序使用的实例
+  static AdcSampler* activeInstance;
+  
+public:
+  AdcSampler();
+  
+  // 启动/停止后台采样
+  bool begin();
+  void stop();
+  bool isRunning() const;
+  
+  // 为通道申请一批转换（覆盖尚未完成的批次）
+  void request(uint8_t channel, uint16_t sampleCount);
+  bool isBusy() const;
+  
+  // 写入一次转换结果并选择下一个待转换通道
+  // 返回 false 表示已无待转换任务
+  // 由中断调用；主机端也可直接调用以注入合成数据
+  bool onConversionComplete(uint16_t value);
+  
+  // 读取通道快照
+  bool snapshot(uint8_t channel, AdcSnapshot& out) const;
+  float getAverage(uint8_t channel) const;
+  uint8_t getRecentSamples(uint8_t channel, uint16_t* out, uint8_t maxCount) const;
+  uint8_t getCurrentChannel() const;
+  
+  // 突发采集：后台记录一个通道的原始转换结果，不影响批次采样
+  bool startCapture(uint8_t channel, uint16_t rateHz, uint16_t samples);
+  void stopCapture();
+  const CaptureBuffer& getCapture() const;
+  
+  // 紧急监视（阈值由 SensorManager 配置）
+  EmergencyWatchdog& getWatchdog();
+  
+  // 为被监视通道申请一次单独的转换（优先于批次）
+  void requestWatch();
+  
+  // 清空所有通道
+  void clear();
+  
+  // ADC中断入口
+  static void handleInterrupt();
+  
+private:
+  // 选择下一次转换（到期的采集样本、监视转换优先），返回 false 表示已无任务
+  bool selectNext(uint8_t start);
+  
+  // 查找下一个有待转换任务的通道（从 start 开始轮询）
+  bool selectNextPending(uint8_t start);
+  
+  // 硬件操作
+  void selectChannel(uint8_t channel);
+  void startConversion();
+};
+
+#endif // ADC_SAMPLER_H
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "Calibration.h"
+#include <EEPROM.h>
+
+static const uint16_t RAW_MAX = 1023;
+static const float RAW_FULL_SCALE = 1023.0f;
+static const float VALUE_FULL_SCALE = 65535.0f;
+static const float MAX_SLOPE = 127.0f;                       // Q8.24 斜率的表示范围
+static const SensorValue NO_BREAKPOINT(32767.0f);            // 未使用的断点，任何原始值都小于它
+
+static_assert(CALIBRATION_POINTS >= 3, "CALIBRATION_POINTS must be at least 3");
+
+CalibrationTable::CalibrationTable() : pointCount(0), rangeMin(0.0f), rangeSpan(RAW_FULL_SCALE) {
+  rebuild();
+}
+
+void CalibrationTable::setRange(float minValue, float maxValue) {
+  // 编码依赖量程，修改量程时原有校准点失效
+  rangeMin = minValue;
+  rangeSpan = (maxValue > minValue) ? (maxValue - minValue) : 1.0f;
+  clear();
+}
+
+void CalibrationTable::clear() {
+  pointCount = 0;
+  rebuild();
+}
+
+void CalibrationTable::addPoint(uint16_t raw, float value) {
+  if (raw > RAW_MAX) raw = RAW_MAX;
+  CalibrationPoint point = { raw, encodeValue(value) };
+  
+  // 查找最近的已有点
+  uint8_t nearest = 0;
+  uint16_t nearestDistance = 0xFFFF;
+  for (uint8_t i = 0; i < pointCount; i++) {
+    uint16_t distance = (points[i].raw > raw) ? points[i].raw - raw : raw - points[i].raw;
+    if (distance < nearestDistance) {
+      nearestDistance = distance;
+      nearest = i;
+    }
+  }
+  
+  if (nearestDistance <= CALIBRATION_MERGE_DISTANCE || pointCount >= CALIBRATION_POINTS) {
+    // 替换后移动到正确位置，保持原始值递增
+    uint8_t i = nearest;
+    while (i > 0 && points[i - 1].raw > raw) {
+      points[i] = points[i - 1];
+      i--;
+    }
+    while (i + 1 < pointCount && points[i + 1].raw < raw) {
+      points[i] = points[i + 1];
+      i++;
+    }
+    points[i] = point;
+  } else {
+    // 有序插入
+    uint8_t i = pointCount;
+    while (i > 0 && points[i - 1].raw > raw) {
+      points[i] = points[i - 1];
+      i--;
+    }
+    points[i] = point;
+    pointCount++;
+  }
+  
+  rebuild();
+}
+
+uint8_t CalibrationTable::getPointCount() const {
+  return pointCount;
+}
+
+bool CalibrationTable::getPoint(uint8_t index, uint16_t& raw, float& value) const {
+  if (index >= pointCount) return false;
+  raw = points[index].raw;
+  value = decodeValue(points[index].value);
+  return true;
+}
+
+void CalibrationTable::save(int address) const {
+  EEPROM.update(address, pointCount);
+  for (uint8_t i = 0; i < CALIBRATION_POINTS; i++) {
+    CalibrationPoint point = (i < pointCount) ? points[i] : CalibrationPoint{ 0, 0 };
+    EEPROM.put(address + 1 + i * sizeof(CalibrationPoint), point);
+  }
+  EEPROM.update(address + STORAGE_SIZE - 1, checksum());
+}
+
+bool CalibrationTable::load(int address) {
+  // 未写入过的EEPROM读出为0xFF，点数超出范围
+  pointCount = EEPROM.read(address);
+  bool valid = pointCount <= CALIBRATION_POINTS;
+  
+  for (uint8_t i = 0; i < CALIBRATION_POINTS && valid; i++) {
+    EEPROM.get(address + 1 + i * sizeof(CalibrationPoint), points[i]);
+    if (i < pointCount) {
+      valid = points[i].raw <= RAW_MAX && (i == 0 || points[i].raw > points[i - 1].raw);
+    }
+  }
+  valid = valid && EEPROM.read(address + STORAGE_SIZE - 1) == checksum();
+  
+  if (!valid) {
+    pointCount = 0;
+  }
+  rebuild();
+  return valid;
+}
+
+uint16_t CalibrationTable::encodeValue(float value) const {
+  float fraction = constrain((value - rangeMin) / rangeSpan, 0.0f, 1.0f);
+  return static_cast<uint16_t>(fraction * VALUE_FULL_SCALE + 0.5f);
+}
+
+float CalibrationTable::decodeValue(uint16_t encoded) const {
+  return rangeMin + rangeSpan * (encoded / VALUE_FULL_SCALE);
+}
+
+uint8_t CalibrationTable::checksum() const {
+  // 逐字节异或并循环移位，空表的校验和不为0xFF
+  uint8_t sum = 0xA5 ^ pointCount;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(points);
+  for (uint8_t i = 0; i < pointCount * sizeof(CalibrationPoint); i++) {
+    sum = ((sum << 1) | (sum >> 7)) ^ bytes[i];
+  }
+  return sum;
+}
+
+void CalibrationTable::rebuild() {
+  // 插值节点
+  float x[CALIBRATION_POINTS];
+  float y[CALIBRATION_POINTS];
+  uint8_t n = pointCount;
+  
+  if (n >= 2) {
+    for (uint8_t i = 0; i < n; i++) {
+      x[i] = points[i].raw;
+      y[i] = decodeValue(points[i].value);
+    }
+  } else {
+    // 量程线性映射，有1个校准点时平移经过该点
+    float shift = 0.0f;
+    if (n == 1) {
+      shift = decodeValue(points[0].value) - (rangeMin + rangeSpan * (points[0].raw / RAW_FULL_SCALE));
+    }
+    x[0] = 0.0f;
+    y[0] = rangeMin + shift;
+    x[1] = RAW_FULL_SCALE;
+    y[1] = rangeMin + rangeSpan + shift;
+    n = 2;
+  }
+  
+  // 两端的段向外延伸；多余的段沿用最后一段，其断点不可达
+  for (uint8_t k = 0; k < CALIBRATION_POINTS - 1; k++) {
+    uint8_t s = (k + 1 < n) ? k : n - 2;
+    float slope = constrain((y[s + 1] - y[s]) / (x[s + 1] - x[s]), -MAX_SLOPE, MAX_SLOPE);
+    slopes[k] = SensorScale(slope);
+    intercepts[k] = SensorValue(y[s] - slope * x[s]);
+  }
+  for (uint8_t k = 0; k < CALIBRATION_POINTS - 2; k++) {
+    breakpoints[k] = (k + 2 < n) ? SensorValue(x[k + 1]) : NO_BREAKPOINT;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <Arduino.h>
+#include "../Core/CommonTypes.h"
+#include "../Core/SystemConfig.h"
+
+// 校准点（EEPROM存储格式：物理量按通道量程编码为 0-65535）
+struct CalibrationPoint {
+  uint16_t raw;
+  uint16_t value;
+};
+
+// 分段线性校准表
+// 校准点按原始值递增保存，修改时预先计算各段的斜率和截距；
+// 换算时只做固定次数的比较（累加比较结果选段，无分支）和一次乘加。
+// 少于2个校准点时以通道量程的线性映射为基础：
+// 没有校准点时直接使用，1个校准点时整体平移使其经过该点。
+class CalibrationTable {
+public:
+  // EEPROM占用：点数 + 校准点 + 校验和
+  static const uint8_t STORAGE_SIZE = 1 + CALIBRATION_POINTS * sizeof(CalibrationPoint) + 1;
+  
+private:
+  CalibrationPoint points[CALIBRATION_POINTS];
+  uint8_t pointCount;
+  float rangeMin;
+  float rangeSpan;
+  
+  // 第 k 段：y = intercepts[k] + x * slopes[k]，x >= breakpoints[k-1]
+  SensorValue breakpoints[CALIBRATION_POINTS - 2];
+  SensorScale slopes[CALIBRATION_POINTS - 1];
+  SensorValue intercepts[CALIBRATION_POINTS - 1];
+  
+public:
+  CalibrationTable();
+  
+  // 通道量程（决定默认映射与物理量编码）
+  void setRange(float minValue, float maxValue);
+  
+  // 清除所有校准点，恢复量程线性映射
+  void clear();
+  
+  // 添加校准点：与已有点相距不超过 CALIBRATION_MERGE_DISTANCE 时替换该点，
+  // 表满时替换最近的点
+  void addPoint(uint16_t raw, float value);
+  
+  uint8_t getPointCount() const;
+  bool getPoint(uint8_t index, uint16_t& raw, float& value) const;
+  
+  // 原始值到物理量的换算
+  SensorValue evaluate(SensorValue raw) const {
+    uint8_t segment = 0;
+    for (uint8_t k = 0; k < CALIBRATION_POINTS - 2; k++) {
+      segment += (raw >= breakpoints[k]);
+    }
+    return intercepts[segment] + raw * slopes[segment];
+  }
+  
+  // EEPROM读写（校验失败时清空校准点）
+  void save(int address) const;
+  bool load(int address);
+  
+private:
+  uint16_t encodeValue(float value) const;
+  float decodeValue(uint16_t encoded) const;
+  uint8_t checksum() const;
+  
+  // 由校准点重新计算分段系数
+  void rebuild();
+};
+
+#endif // CALIBRATION_H
\ No newline at end of file
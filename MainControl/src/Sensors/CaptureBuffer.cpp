@@ -0,0 +1,91 @@
+#include "CaptureBuffer.h"
+
+CaptureBuffer::CaptureBuffer()
+  : state(CAPTURE_IDLE),
+    length(0),
+    targetLength(0),
+    channel(0),
+    intervalMicros(0),
+    nextDue(0),
+    startMicros(0),
+    endMicros(0) {
+}
+
+CaptureBuffer::ArgumentError CaptureBuffer::checkArguments(unsigned long captureChannel, unsigned long rateHz,
+                                                          unsigned long samples) {
+  if (captureChannel >= SENSOR_COUNT) return ARGUMENT_CHANNEL;
+  if (rateHz == 0 || rateHz > CAPTURE_MAX_RATE) return ARGUMENT_RATE;
+  if (samples == 0 || samples > CAPTURE_MAX_SAMPLES) return ARGUMENT_SAMPLES;
+  return ARGUMENT_OK;
+}
+
+bool CaptureBuffer::start(uint8_t captureChannel, uint16_t rateHz, uint16_t samples) {
+  if (captureChannel >= SENSOR_COUNT || rateHz == 0 || rateHz > CAPTURE_MAX_RATE || samples == 0) {
+    return false;
+  }
+  
+  noInterrupts();
+  bool busy = (state == CAPTURE_RUNNING);
+  if (!busy) {
+    channel = captureChannel;
+    intervalMicros = 1000000UL / rateHz;
+    targetLength = samples < CAPTURE_MAX_SAMPLES ? samples : CAPTURE_MAX_SAMPLES;
+    length = 0;
+    nextDue = micros();
+    startMicros = nextDue;
+    endMicros = nextDue;
+    state = CAPTURE_RUNNING;
+  }
+  interrupts();
+  
+  return !busy;
+}
+
+void CaptureBuffer::cancel() {
+  noInterrupts();
+  if (state == CAPTURE_RUNNING) {
+    state = length > 0 ? CAPTURE_COMPLETE : CAPTURE_IDLE;
+  }
+  interrupts();
+}
+
+void CaptureBuffer::store(uint16_t value, unsigned long nowMicros) {
+  uint16_t index = length;
+  if (index == 0) {
+    startMicros = nowMicros;
+  }
+  
+  lowBytes[index] = static_cast<uint8_t>(value);
+  uint8_t shift = (index & 0x03) * 2;
+  uint8_t& high = highBits[index >> 2];
+  high = (high & ~(0x03 << shift)) | (((value >> 8) & 0x03) << shift);
+  length = index + 1;
+  endMicros = nowMicros;
+  
+  // ADC被其他通道占用而落后超过一个间隔时从当前时刻重新计时，不连续补采
+  nextDue += intervalMicros;
+  if ((long)(nowMicros - nextDue) >= 0) {
+    nextDue = nowMicros + intervalMicros;
+  }
+  
+  if (length >= targetLength) {
+    state = CAPTURE_COMPLETE;
+  }
+}
+
+uint16_t CaptureBuffer::get(uint16_t index) const {
+  if (index >= length) return 0;
+  uint8_t shift = (index & 0x03) * 2;
+  return lowBytes[index] | (static_cast<uint16_t>((highBits[index >> 2] >> shift) & 0x03) << 8);
+}
+
+uint16_t CaptureBuffer::getRate() const {
+  return intervalMicros > 0 ? static_cast<uint16_t>(1000000UL / intervalMicros) : 0;
+}
+
+unsigned long CaptureBuffer::getDuration() const {
+  noInterrupts();
+  unsigned long duration = endMicros - startMicros;
+  interrupts();
+  return duration;
+}
\ No newline at end of file
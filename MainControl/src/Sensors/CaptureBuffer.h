@@ -0,0 +1,69 @@
+#ifndef CAPTURE_BUFFER_H
+#define CAPTURE_BUFFER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+
+// 原始ADC突发采集缓冲区（诊断用）
+// 以固定速率记录单个通道的原始转换结果，空间在编译时分配。
+// 10位样本按1.25字节打包：低8位各占一个字节，高2位每4个样本合用一个字节。
+// store() 由采样中断调用；采集完成后由主循环读取，下次 start() 之前内容保持不变。
+class CaptureBuffer {
+public:
+  enum State : uint8_t {
+    CAPTURE_IDLE = 0,
+    CAPTURE_RUNNING,
+    CAPTURE_COMPLETE
+  };
+  
+  // 命令参数检查结果
+  enum ArgumentError : uint8_t {
+    ARGUMENT_OK = 0,
+    ARGUMENT_CHANNEL,     // 通道应为 0 到 SENSOR_COUNT-1
+    ARGUMENT_RATE,        // 采样率应为 1 到 CAPTURE_MAX_RATE
+    ARGUMENT_SAMPLES      // 样本数应为 1 到 CAPTURE_MAX_SAMPLES
+  };
+  
+private:
+  uint8_t lowBytes[CAPTURE_MAX_SAMPLES];
+  uint8_t highBits[(CAPTURE_MAX_SAMPLES + 3) / 4];
+  
+  volatile State state;
+  volatile uint16_t length;
+  uint16_t targetLength;
+  uint8_t channel;
+  unsigned long intervalMicros;
+  volatile unsigned long nextDue;      // 下一个样本的计划时刻 (us)
+  volatile unsigned long startMicros;  // 第一个样本的时刻
+  volatile unsigned long endMicros;    // 最后一个样本的时刻
+  
+public:
+  CaptureBuffer();
+  
+  // 命令参数按 unsigned long 检查，通过后才能换算为 start() 的参数类型，避免截断后落入有效范围
+  static ArgumentError checkArguments(unsigned long captureChannel, unsigned long rateHz, unsigned long samples);
+  
+  // 开始采集：rateHz 为采样率，samples 为样本数（超出容量时截断）
+  // 正在采集时返回 false
+  bool start(uint8_t captureChannel, uint16_t rateHz, uint16_t samples);
+  void cancel();
+  
+  // 中断侧：到达计划时刻时记录一个样本
+  bool isDue(unsigned long nowMicros) const {
+    return state == CAPTURE_RUNNING && (long)(nowMicros - nextDue) >= 0;
+  }
+  void store(uint16_t value, unsigned long nowMicros);
+  
+  // 读取
+  State getState() const { return state; }
+  bool isRunning() const { return state == CAPTURE_RUNNING; }
+  uint8_t getChannel() const { return channel; }
+  uint16_t size() const { return length; }
+  uint16_t get(uint16_t index) const;
+  
+  // 计划采样率 (Hz) 与实际采集时长 (us)
+  uint16_t getRate() const;
+  unsigned long getDuration() const;
+};
+
+#endif // CAPTURE_BUFFER_H
\ No newline at end of file
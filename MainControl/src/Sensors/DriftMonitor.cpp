@@ -0,0 +1,275 @@
+#include "DriftMonitor.h"
+
+// 各通道量程，阈值与修正上限按量程的比例给出
+static const float CHANNEL_SPAN[5] = {
+  FLOW_MAX - FLOW_MIN, POLLUTION_MAX - POLLUTION_MIN, LIGHT_MAX - LIGHT_MIN,
+  PH_MAX - PH_MIN, TEMP_MAX - TEMP_MIN
+};
+
+static float channelValue(const SensorData& sensorData, uint8_t index) {
+  switch (index) {
+    case 0: return sensorData.flowRate;
+    case 1: return sensorData.pollutionLevel;
+    case 2: return sensorData.lightIntensity;
+    case 3: return sensorData.pH;
+    case 4: return sensorData.temperature;
+    default: return 0.0f;
+  }
+}
+
+DriftMonitor::DriftMonitor() {
+  initialize();
+}
+
+void DriftMonitor::initialize() {
+  alpha = DRIFT_UPDATE_INTERVAL / (DRIFT_TIME_CONSTANT * 3600000.0f);
+  phaseSamples = static_cast<uint16_t>(constrain(1.0f / alpha, 1.0f, 65535.0f));
+  suspect = SENSOR_COUNT;
+  lastUpdate = 0;
+  
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    rebaseline(i);
+  }
+}
+
+void DriftMonitor::rebaseline(uint8_t channel) {
+  if (channel >= SENSOR_COUNT) return;
+  
+  channels[channel].baselineOffset = 0.0f;
+  channels[channel].baselineGain = 1.0f;
+  status[channel].phase = DRIFT_WAITING;
+  resetStatistics(channel);
+  if (suspect == channel) {
+    suspect = SENSOR_COUNT;
+  }
+}
+
+void DriftMonitor::resetStatistics(uint8_t channel) {
+  ChannelState& state = channels[channel];
+  state.meanPredicted = 0.0f;
+  state.meanMeasured = 0.0f;
+  state.varPredicted = 0.0f;
+  state.covariance = 0.0f;
+  state.meanSquare = 0.0f;
+  
+  DriftStatus& result = status[channel];
+  result.residualMean = 0.0f;
+  result.residualRms = 0.0f;
+  result.offset = 0.0f;
+  result.gain = 1.0f;
+  result.error = 0.0f;
+  result.samples = 0;
+  result.exceeded = false;
+}
+
+bool DriftMonitor::update(const SensorData& sensors, const SensorFusion& fusion, const DigitalTwinData& twin,
+                          unsigned long now) {
+  if (now - lastUpdate < DRIFT_UPDATE_INTERVAL) return false;
+  lastUpdate = now;
+  
+  // 任一通道故障时参考预测不可信（故障通道已被回归估计替代）
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    if (sensors.sensorFaults[i]) return false;
+  }
+  
+  // 快照中的污染物读数已替换为融合值，融合值向参考预测收缩，会使残差与修正量偏小；
+  // 以融合前的测量值比较，回归预测量也与训练时一样使用测量值
+  SensorData measuredData = sensors;
+  measuredData.pollutionLevel = sensors.measuredPollution;
+  
+  uint8_t previousSuspect = suspect;
+  bool anyExceeded = false;
+  
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    ChannelState& state = channels[i];
+    DriftStatus& result = status[i];
+    
+    if (result.phase == DRIFT_WAITING) {
+      if (!fusion.getRegressionWeights(i, state.reference)) continue;
+      result.phase = DRIFT_BASELINE;
+    }
+    
+    float predicted = referencePrediction(i, measuredData, fusion, twin);
+    float measured = channelValue(measuredData, i);
+    float residual = measured - predicted;
+    
+    // 指数加权的均值、方差与协方差（第一个样本直接作为初值）
+    if (result.samples == 0) {
+      state.meanPredicted = predicted;
+      state.meanMeasured = measured;
+      state.meanSquare = residual * residual;
+    } else {
+      float deltaPredicted = predicted - state.meanPredicted;
+      float deltaMeasured = measured - state.meanMeasured;
+      state.meanPredicted += alpha * deltaPredicted;
+      state.meanMeasured += alpha * deltaMeasured;
+      state.varPredicted = (1.0f - alpha) * (state.varPredicted + alpha * deltaPredicted * deltaPredicted);
+      state.covariance = (1.0f - alpha) * (state.covariance + alpha * deltaPredicted * deltaMeasured);
+      state.meanSquare += alpha * (residual * residual - state.meanSquare);
+    }
+    if (result.samples < 65535) {
+      result.samples++;
+    }
+    
+    result.residualMean = state.meanMeasured - state.meanPredicted;
+    result.residualRms = sqrt(state.meanSquare);
+    
+    if (result.samples < phaseSamples) continue;
+    
+    if (result.phase == DRIFT_BASELINE) {
+      // 基线记录完成，重新开始统计
+      fitLine(i, state.baselineOffset, state.baselineGain);
+      result.phase = DRIFT_TRACKING;
+      resetStatistics(i);
+      continue;
+    }
+    
+    evaluate(i);
+    anyExceeded |= fabs(result.error) > DRIFT_OFFSET_LIMIT * CHANNEL_SPAN[i] ||
+                   fabs(result.gain - 1.0f) > DRIFT_GAIN_LIMIT;
+  }
+  
+  suspect = anyExceeded ? isolate() : SENSOR_COUNT;
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    status[i].exceeded = (i == suspect);
+  }
+  return suspect < SENSOR_COUNT && suspect != previousSuspect;
+}
+
+uint8_t DriftMonitor::isolate() const {
+  // 归一化的工作点漂移量 e（只计入已在监测阶段的通道）
+  float error[SENSOR_COUNT];
+  bool tracking[SENSOR_COUNT];
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    tracking[i] = status[i].phase == DRIFT_TRACKING && status[i].samples >= phaseSamples;
+    error[i] = tracking[i] ? status[i].error / CHANNEL_SPAN[i] : 0.0f;
+  }
+  
+  float energy = 0.0f;
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    energy += error[i] * error[i];
+  }
+  
+  // 假设只有通道 j 漂移 δ：e_j = δ，其余通道的参考预测随之变化，e_i = -w_i(j)·δ
+  // （w_i(j) 为通道 i 的冻结系数中 j 的一项，均为归一化单位），
+  // 按最小二乘拟合 δ，残差越小的假设越可信
+  float mismatch[SENSOR_COUNT];
+  float drift[SENSOR_COUNT];
+  float bestMismatch = energy;
+  for (uint8_t j = 0; j < SENSOR_COUNT; j++) {
+    mismatch[j] = energy;
+    drift[j] = 0.0f;
+    if (!tracking[j]) continue;
+    
+    float dot = 0.0f;
+    float norm = 0.0f;
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      if (!tracking[i]) continue;
+      float signature = (i == j) ? selfSensitivity(i) : -channels[i].reference[j < i ? j : j - 1];
+      dot += signature * error[i];
+      norm += signature * signature;
+    }
+    drift[j] = dot / norm;
+    mismatch[j] = energy - dot * drift[j];
+    if (mismatch[j] < bestMismatch) {
+      bestMismatch = mismatch[j];
+    }
+  }
+  
+  // 两个通道互为主要预测量时两种假设几乎无法区分：
+  // 与最优假设相差不大的都作为候选，多于一个时只保留易漂移的通道，仍不唯一则不作判定
+  uint8_t best = SENSOR_COUNT;
+  uint8_t candidates = 0;
+  uint8_t proneCandidate = SENSOR_COUNT;
+  uint8_t proneCandidates = 0;
+  for (uint8_t j = 0; j < SENSOR_COUNT; j++) {
+    if (!tracking[j] || mismatch[j] > bestMismatch + DRIFT_ISOLATION_MARGIN * energy) continue;
+    best = j;
+    candidates++;
+    if (DRIFT_PRONE_CHANNELS & (1 << j)) {
+      proneCandidate = j;
+      proneCandidates++;
+    }
+  }
+  if (candidates > 1) {
+    best = (proneCandidates == 1) ? proneCandidate : SENSOR_COUNT;
+  }
+  if (best == SENSOR_COUNT) return SENSOR_COUNT;
+  
+  bool offsetExceeded = fabs(drift[best]) > DRIFT_OFFSET_LIMIT;
+  bool gainExceeded = fabs(status[best].gain - 1.0f) > DRIFT_GAIN_LIMIT;
+  return (offsetExceeded || gainExceeded) ? best : SENSOR_COUNT;
+}
+
+float DriftMonitor::selfSensitivity(uint8_t channel) const {
+  // 数字孪生的预测跟随污染物测量，漂移在该通道残差中按其权重减小
+  return channel == 1 ? 1.0f - DRIFT_TWIN_WEIGHT : 1.0f;
+}
+
+float DriftMonitor::referencePrediction(uint8_t channel, const SensorData& sensors, const SensorFusion& fusion,
+                                        const DigitalTwinData& twin) const {
+  float predicted = fusion.estimateWithWeights(sensors, channel, channels[channel].reference);
+  
+  // 数字孪生的预测部分来自污染物测量本身，只以较小的权重参与
+  if (channel == 1 && twin.predictedPollution > 0.0f) {
+    predicted += DRIFT_TWIN_WEIGHT * (twin.predictedPollution - predicted);
+  }
+  return predicted;
+}
+
+void DriftMonitor::fitLine(uint8_t channel, float& offset, float& gain) const {
+  const ChannelState& state = channels[channel];
+  
+  // 参考预测变化不足时增益不可辨识，只估计偏移
+  float minStd = DRIFT_MIN_EXCITATION * CHANNEL_SPAN[channel];
+  gain = (state.varPredicted >= minStd * minStd) ? state.covariance / state.varPredicted : 1.0f;
+  offset = state.meanMeasured - gain * state.meanPredicted;
+}
+
+void DriftMonitor::evaluate(uint8_t channel) {
+  const ChannelState& state = channels[channel];
+  DriftStatus& result = status[channel];
+  
+  // 当前：测量值 ≈ a + b·预测；基线：无漂移的测量值 ≈ a0 + b0·预测
+  // 消去预测得 测量值 ≈ (a - b/b0·a0) + b/b0·无漂移的测量值
+  float offset, gain;
+  fitLine(channel, offset, gain);
+  result.gain = gain / state.baselineGain;
+  result.offset = offset - result.gain * state.baselineOffset;
+  
+  // 工作点（测量均值）上的漂移量
+  float corrected = (state.meanMeasured - result.offset) / result.gain;
+  result.error = state.meanMeasured - corrected;
+}
+
+bool DriftMonitor::applyCorrection(uint8_t channel, SensorManager& sensorManager) {
+  if (channel >= SENSOR_COUNT || !status[channel].exceeded) return false;
+  
+  // 增益变化与工作点上的修正量分别限幅，再由两者确定偏移：
+  // 偏移与增益各自截断时，两者的修正在工作点上可能相互抵消甚至反向
+  DriftStatus& result = status[channel];
+  float maxError = DRIFT_MAX_OFFSET_STEP * CHANNEL_SPAN[channel];
+  float error = constrain(result.error, -maxError, maxError);
+  float gain = constrain(result.gain, 1.0f - DRIFT_MAX_GAIN_STEP, 1.0f + DRIFT_MAX_GAIN_STEP);
+  float operatingPoint = channels[channel].meanMeasured;
+  float offset = operatingPoint - gain * (operatingPoint - error);
+  
+  if (!sensorManager.correctDrift(channel, offset, gain, operatingPoint)) {
+    return false;
+  }
+  
+  // 基线保留，修正后的读数重新统计
+  resetStatistics(channel);
+  if (suspect == channel) {
+    suspect = SENSOR_COUNT;
+  }
+  return true;
+}
+
+const DriftStatus& DriftMonitor::getStatus(uint8_t channel) const {
+  return status[channel < SENSOR_COUNT ? channel : 0];
+}
+
+uint8_t DriftMonitor::getSuspect() const {
+  return suspect;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef DRIFT_MONITOR_H
+#define DRIFT_MONITOR_H
+
+#include <Arduino.h>
+#include "../Core/CommonTypes.h"
+#include "../Core/SystemConfig.h"
+#include "SensorFusion.h"
+#include "SensorManager.h"
+
+// 传感器漂移监测
+// 每个通道以其余通道的回归估计为参考（污染物通道另加数字孪生的预测），
+// 回归系数在监测开始时冻结，避免自适应的回归模型随漂移一起变化。
+// 测量值与参考预测的均值、方差、协方差按指数加权递推，时间常数为数小时，
+// 每 DRIFT_UPDATE_INTERVAL 每通道只做一次 O(1) 更新。
+// 第一个时间常数内记录基线关系，之后拟合的线性关系偏离基线即为漂移；
+// 参考预测变化足够大时同时估计增益，否则只估计偏移。
+// 一个通道漂移时，以它为预测量的其余通道残差也会偏移：按冻结系数比较
+// “只有某一通道漂移”的各个假设，只对最符合的通道给出修正。
+class DriftMonitor {
+private:
+  struct ChannelState {
+    float reference[5];         // 冻结的回归系数
+    float meanPredicted;
+    float meanMeasured;
+    float varPredicted;
+    float covariance;
+    float meanSquare;           // 残差平方的平均
+    float baselineOffset;       // 基线：测量值 ≈ baselineOffset + baselineGain·预测
+    float baselineGain;
+  };
+  
+  ChannelState channels[SENSOR_COUNT];
+  DriftStatus status[SENSOR_COUNT];
+  float alpha;                  // 指数加权系数 = 更新间隔 / 时间常数
+  uint16_t phaseSamples;        // 每个阶段所需的样本数（一个时间常数）
+  uint8_t suspect;              // 给出修正建议的通道，SENSOR_COUNT 表示没有
+  unsigned long lastUpdate;
+  
+public:
+  DriftMonitor();
+  
+  void initialize();
+  
+  // 主循环调用，按 DRIFT_UPDATE_INTERVAL 节流；污染物通道使用 sensors.measuredPollution（融合前的测量值）
+  // 有通道新给出修正建议时返回 true
+  bool update(const SensorData& sensors, const SensorFusion& fusion, const DigitalTwinData& twin,
+              unsigned long now);
+  
+  // 人工校准后重新冻结参考并记录基线
+  void rebaseline(uint8_t channel);
+  
+  // 按修正建议调整校准（工作点上的修正量与增益变化每次有上限），成功后重新开始统计
+  bool applyCorrection(uint8_t channel, SensorManager& sensorManager);
+  
+  const DriftStatus& getStatus(uint8_t channel) const;
+  uint8_t getSuspect() const;
+  
+private:
+  void resetStatistics(uint8_t channel);
+  float referencePrediction(uint8_t channel, const SensorData& sensors, const SensorFusion& fusion,
+                            const DigitalTwinData& twin) const;
+  
+  // 由递推统计拟合 测量值 ≈ offset + gain·预测
+  void fitLine(uint8_t channel, float& offset, float& gain) const;
+  void evaluate(uint8_t channel);
+  
+  // 判定漂移来源：超限时比较各通道单独漂移的假设，返回最符合的通道
+  uint8_t isolate() const;
+  float selfSensitivity(uint8_t channel) const;
+};
+
+#endif // DRIFT_MONITOR_H
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "EmergencyWatchdog.h"
+
+EmergencyWatchdog::EmergencyWatchdog()
+  : enabled(false),
+    channel(0),
+    tripLevel(0),
+    clearLevel(0),
+    tripSlope(0),
+    slopeWindow(0),
+    clearTime(0),
+    confirmSamples(1),
+    tripped(false),
+    tripPending(false),
+    tripValue(0),
+    tripMicros(0),
+    tripBySlope(false),
+    tripCount(0),
+    overCount(0),
+    rising(false),
+    referenceValid(false),
+    referenceValue(0),
+    referenceMicros(0),
+    clearing(false),
+    clearStart(0) {
+}
+
+void EmergencyWatchdog::configure(uint8_t watchChannel, uint16_t tripRaw, uint16_t clearRaw, uint16_t slope,
+                                  unsigned long slopeWindowMs, unsigned long clearTimeMs, uint8_t confirm) {
+  noInterrupts();
+  channel = watchChannel;
+  tripLevel = tripRaw;
+  clearLevel = clearRaw < tripRaw ? clearRaw : tripRaw;
+  tripSlope = slope;
+  slopeWindow = (slopeWindowMs > 0 ? slopeWindowMs : 1) * 1000UL;
+  clearTime = clearTimeMs * 1000UL;
+  confirmSamples = confirm > 0 ? confirm : 1;
+  overCount = 0;
+  referenceValid = false;
+  rising = false;
+  enabled = watchChannel < SENSOR_COUNT;
+  interrupts();
+}
+
+void EmergencyWatchdog::disable() {
+  noInterrupts();
+  enabled = false;
+  interrupts();
+}
+
+void EmergencyWatchdog::reset() {
+  noInterrupts();
+  tripped = false;
+  tripPending = false;
+  overCount = 0;
+  referenceValid = false;
+  rising = false;
+  clearing = false;
+  interrupts();
+}
+
+void EmergencyWatchdog::check(uint8_t convertedChannel, uint16_t value, unsigned long nowMicros) {
+  if (!enabled || convertedChannel != channel) return;
+  
+  // 上升速率：每隔一个速率窗口与参考样本比较，以乘法代替除法
+  // 通道长时间没有转换时重新取参考样本
+  unsigned long elapsed = nowMicros - referenceMicros;
+  if (!referenceValid || elapsed >= 4 * slopeWindow) {
+    referenceValue = value;
+    referenceMicros = nowMicros;
+    referenceValid = true;
+    rising = false;
+  } else if (elapsed >= slopeWindow) {
+    uint32_t elapsedMs = elapsed / 1000UL;
+    rising = value > referenceValue &&
+             static_cast<uint32_t>(value - referenceValue) * 1000UL >= static_cast<uint32_t>(tripSlope) * elapsedMs;
+    referenceValue = value;
+    referenceMicros = nowMicros;
+  }
+  
+  if (!tripped) {
+    bool over = value >= tripLevel || (rising && value >= clearLevel);
+    if (!over) {
+      overCount = 0;
+      return;
+    }
+    if (++overCount < confirmSamples) return;
+    
+    overCount = 0;
+    tripped = true;
+    tripPending = true;
+    tripValue = value;
+    tripMicros = nowMicros;
+    tripBySlope = value < tripLevel;
+    tripCount++;
+    clearing = false;
+    return;
+  }
+  
+  // 滞回：持续不高于解除值一段时间后才解除
+  if (value > clearLevel) {
+    clearing = false;
+  } else if (!clearing) {
+    clearing = true;
+    clearStart = nowMicros;
+  } else if (nowMicros - clearStart >= clearTime) {
+    tripped = false;
+    clearing = false;
+  }
+}
+
+bool EmergencyWatchdog::isTripped() const {
+  return tripped;
+}
+
+bool EmergencyWatchdog::isEnabled() const {
+  return enabled;
+}
+
+uint8_t EmergencyWatchdog::getChannel() const {
+  return channel;
+}
+
+bool EmergencyWatchdog::takeTrip(EmergencyTrip& trip) {
+  noInterrupts();
+  bool pending = tripPending;
+  if (pending) {
+    trip.rawValue = tripValue;
+    trip.micros = tripMicros;
+    trip.bySlope = tripBySlope;
+    tripPending = false;
+  }
+  interrupts();
+  return pending;
+}
+
+uint16_t EmergencyWatchdog::getTripCount() const {
+  noInterrupts();
+  uint16_t count = tripCount;
+  interrupts();
+  return count;
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef EMERGENCY_WATCHDOG_H
+#define EMERGENCY_WATCHDOG_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+
+// 一次触发的记录
+struct EmergencyTrip {
+  uint16_t rawValue;         // 触发时的原始值
+  unsigned long micros;      // 触发转换完成的时刻 (us)
+  bool bySlope;              // 由上升速率触发（原始值未达到触发值）
+};
+
+// 原始值阈值监视（紧急快速通道）
+// 采样器在每次转换完成时调用 check()（ADC数据源下在中断中执行），
+// 不经过批次平均、滤波和采样周期，超限后主循环在下一次检查时即可响应。
+// 触发条件：连续 confirmSamples 次转换满足
+//   原始值 >= 触发值，或 原始值 >= 解除值 且 上升速率 >= 触发速率；
+// 解除条件（滞回）：原始值持续不高于解除值达到 clearTime。
+// 阈值均为原始ADC计数，由 SensorManager 按当前校准换算。
+class EmergencyWatchdog {
+private:
+  // 配置（主循环写入，关中断）
+  bool enabled;
+  uint8_t channel;
+  uint16_t tripLevel;
+  uint16_t clearLevel;
+  uint16_t tripSlope;              // 原始计数/秒
+  unsigned long slopeWindow;       // 速率计算间隔 (us)
+  unsigned long clearTime;         // (us)
+  uint8_t confirmSamples;
+  
+  // 中断侧状态
+  volatile bool tripped;
+  volatile bool tripPending;       // 主循环尚未取走的触发
+  volatile uint16_t tripValue;
+  volatile unsigned long tripMicros;
+  volatile bool tripBySlope;
+  volatile uint16_t tripCount;
+  uint8_t overCount;
+  bool rising;
+  bool referenceValid;
+  uint16_t referenceValue;
+  unsigned long referenceMicros;
+  bool clearing;
+  unsigned long clearStart;
+  
+public:
+  EmergencyWatchdog();
+  
+  // 设置阈值并启用；slope 为原始计数/秒，时间单位为毫秒
+  void configure(uint8_t watchChannel, uint16_t tripRaw, uint16_t clearRaw, uint16_t slope,
+                 unsigned long slopeWindowMs, unsigned long clearTimeMs, uint8_t confirm);
+  void disable();
+  
+  // 清除触发状态
+  void reset();
+  
+  // 每次转换完成时调用
+  void check(uint8_t convertedChannel, uint16_t value, unsigned long nowMicros);
+  
+  // 当前是否处于触发状态（解除前保持）
+  bool isTripped() const;
+  bool isEnabled() const;
+  uint8_t getChannel() const;
+  
+  // 取出尚未处理的触发，没有时返回 false
+  bool takeTrip(EmergencyTrip& trip);
+  
+  // 累计触发次数
+  uint16_t getTripCount() const;
+};
+
+#endif // EMERGENCY_WATCHDOG_H
\ No newline at end of file
@@ -1,85 +1,285 @@
 #include "SensorFusion.h"
 
+// ========== 融合滤波器常量 ==========
+static const uint8_t FUSION_QUALITY_LEVELS = 8;            // 数据质量量化等级
+static const float FUSION_PROCESS_NOISE = 0.1f;             // 默认过程噪声与直接测量噪声 (ppm²)
+static const float FUSION_MEASUREMENT_NOISE = 0.5f;
+static const float FUSION_REGRESSION_INITIAL_VAR = 2500.0f; // 回归观测初始方差（50 ppm）
+static const float FUSION_REGRESSION_MIN_VAR = 1.0f;
+static const float FUSION_RESIDUAL_ALPHA = 0.05f;           // 残差方差平滑系数
+static const float FUSION_CONVERGENCE = 0.001f;             // 增益相对变化小于此值视为收敛
+static const uint8_t FUSION_COVARIATES[4] = {0, 2, 3, 4};  // 流量、光照、pH、温度
+
+// ========== 回归模型常量 ==========
+static const float REGRESSION_FORGETTING = 0.998f;          // 遗忘因子
+static const float REGRESSION_INITIAL_COVARIANCE = 100.0f;
+static const float REGRESSION_MAX_TRACE = 1000.0f;          // 激励不足时停止遗忘，防止协方差发散
+static const uint16_t REGRESSION_MIN_SAMPLES = 50;          // 投入使用前的最少训练次数
+
+// 各通道量程，回归在归一化的 [0, 1] 区间内进行
+static const float CHANNEL_MIN[5] = {FLOW_MIN, POLLUTION_MIN, LIGHT_MIN, PH_MIN, TEMP_MIN};
+static const float CHANNEL_SPAN[5] = {
+  FLOW_MAX - FLOW_MIN, POLLUTION_MAX - POLLUTION_MIN, LIGHT_MAX - LIGHT_MIN,
+  PH_MAX - PH_MIN, TEMP_MAX - TEMP_MIN
+};
+static const float CHANNEL_SCALE[5] = {
+  1.0f / (FLOW_MAX - FLOW_MIN), 1.0f / (POLLUTION_MAX - POLLUTION_MIN), 1.0f / (LIGHT_MAX - LIGHT_MIN),
+  1.0f / (PH_MAX - PH_MIN), 1.0f / (TEMP_MAX - TEMP_MIN)
+};
+
+static float channelValue(const SensorData& sensorData, uint8_t index) {
+  switch (index) {
+    case 0: return sensorData.flowRate;
+    case 1: return sensorData.pollutionLevel;
+    case 2: return sensorData.lightIntensity;
+    case 3: return sensorData.pH;
+    case 4: return sensorData.temperature;
+    default: return 0.0f;
+  }
+}
+
+static void setChannelValue(SensorData& sensorData, uint8_t index, float value) {
+  switch (index) {
+    case 0: sensorData.flowRate = value; break;
+    case 1: sensorData.pollutionLevel = value; break;
+    case 2: sensorData.lightIntensity = value; break;
+    case 3: sensorData.pH = value; break;
+    case 4: sensorData.temperature = value; break;
+  }
+}
+
 SensorFusion::SensorFusion() {
   initialize();
 }
 
-void SensorFusion::initialize() {
+void SensorFusion::initialize(unsigned long pollutionPeriod) {
   // 初始化传感器权重
   for (int i = 0; i < 5; i++) {
     sensorWeights[i] = 0.2f; // 平均权重
   }
   
-  // 初始化卡尔曼滤波器
+  // 初始化回归模型
   for (int i = 0; i < 5; i++) {
-    kalmanStates[i].estimate = 250.0f; // 初始估计值
-    kalmanStates[i].estimateError = 1.0f;
-    kalmanStates[i].processNoise = 0.1f;
-    kalmanStates[i].measurementNoise = 0.5f;
+    resetRegressionModel(i);
+    lastHealthyValues[i] = CHANNEL_MIN[i] + 0.5f * CHANNEL_SPAN[i];
   }
+  nextRegressionTarget = 0;
   
-  // 初始化回归权重
-  for (int i = 0; i < 4; i++) {
-    regressionWeights[i] = 0.25f;
+  // 初始化融合滤波器
+  for (int i = 0; i < 2; i++) {
+    fusionState[i] = 0.0f;
+    for (int j = 0; j < 2; j++) {
+      fusionCovariance[i][j] = 0.0f;
+      fusionGain[i][j] = 0.0f;
+    }
   }
+  processNoise = FUSION_PROCESS_NOISE;
+  measurementNoise = FUSION_MEASUREMENT_NOISE;
+  regressionResidualVar = FUSION_REGRESSION_INITIAL_VAR;
+  noiseKey = 0;
+  steadyState = false;
+  fusionInitialized = false;
+  lastPollutionStamp = 0;
+  // 采样周期由 SensorManager 调整，重新初始化时沿用该通道当前的周期
+  samplePeriod = pollutionPeriod > 0 ? pollutionPeriod : POLLUTION_SAMPLE_PERIOD;
+  processNoiseScale = noiseScaleFor(samplePeriod);
   
   fusionConfidence = 1.0f;
   fusedHistory.clear();
 }
 
 float SensorFusion::fuseSensorData(const SensorData& sensorData) {
-  // 简化实现：返回污染物浓度
-  return sensorData.pollutionLevel;
-}
-
-float SensorFusion::applyKalmanFilter(uint8_t sensorIndex, float measurement) {
-  if (sensorIndex >= 5) return measurement;
+  // 滤波器按污染物通道的采样推进，其他通道更新时返回当前估计
+  unsigned long stamp = millis() - sensorData.sampleAge[1];
+  if (fusionInitialized && (long)(stamp - lastPollutionStamp) < (long)(samplePeriod / 2)) {
+    return clampValue(fusionState[0], (float)POLLUTION_MIN, (float)POLLUTION_MAX);
+  }
+  lastPollutionStamp = stamp;
+  
+  // 观测：直接测量与协变量回归估计
+  float measurement[2];
+  measurement[0] = sensorData.pollutionLevel;
+  measurement[1] = estimateByRegression(sensorData, 1);
   
-  KalmanState& state = kalmanStates[sensorIndex];
+  // 观测噪声按数据质量放大，故障时不使用；回归观测取最差协变量的质量
+  uint8_t directLevel = qualityLevel(sensorData.dataQuality[1], sensorData.sensorFaults[1]);
+  uint8_t regressionLevel = isRegressionReady(1) ? FUSION_QUALITY_LEVELS : 0;
+  for (int i = 0; i < 4; i++) {
+    uint8_t sensor = FUSION_COVARIATES[i];
+    uint8_t level = qualityLevel(sensorData.dataQuality[sensor], sensorData.sensorFaults[sensor]);
+    if (level < regressionLevel) regressionLevel = level;
+  }
+  
+  // 残差方差按2的幂量化，稳定工况下噪声配置保持不变
+  int exponent;
+  frexp(regressionResidualVar, &exponent);
+  
+  float directNoise = measurementNoise;
+  float noise[2] = {0.0f, 0.0f};
+  uint8_t activeMask = 0;
+  if (directLevel > 0) {
+    noise[0] = directNoise * FUSION_QUALITY_LEVELS / directLevel;
+    activeMask |= 0x01;
+  }
+  if (regressionLevel > 0) {
+    noise[1] = ldexp(1.0f, exponent) * FUSION_QUALITY_LEVELS / regressionLevel;
+    activeMask |= 0x02;
+  }
   
-  // 预测步骤
-  float predictedEstimate = state.estimate;
-  float predictedError = state.estimateError + state.processNoise;
+  if (!fusionInitialized) {
+    if (activeMask == 0) return sensorData.pollutionLevel;
+    
+    // 以首个可用观测初始化
+    uint8_t m = (activeMask & 0x01) ? 0 : 1;
+    fusionState[0] = measurement[m];
+    fusionState[1] = 0.0f;
+    fusionCovariance[0][0] = noise[m];
+    fusionCovariance[0][1] = 0.0f;
+    fusionCovariance[1][0] = 0.0f;
+    fusionCovariance[1][1] = noise[m];
+    fusionInitialized = true;
+    noiseKey = 0;
+  }
   
-  // 更新步骤
-  float kalmanGain = predictedError / (predictedError + state.measurementNoise);
-  state.estimate = predictedEstimate + kalmanGain * (measurement - predictedEstimate);
-  state.estimateError = (1 - kalmanGain) * predictedError;
+  // 噪声配置变化时退出稳态，重新传播协方差
+  uint16_t key = directLevel | (regressionLevel << 4) | ((uint16_t)(exponent & 0xFF) << 8);
+  if (key != noiseKey) {
+    noiseKey = key;
+    steadyState = false;
+  }
+  
+  predictFusion();
+  
+  if (!steadyState) {
+    float previousGain[2] = { fusionGain[0][0] + fusionGain[0][1], fusionGain[1][0] + fusionGain[1][1] };
+    computeFusionGain(noise, activeMask);
+    updateFusionCovariance();
+    
+    // 增益收敛后冻结，之后每个样本只需固定的矩阵-向量乘法；
+    // 变化量的增益比浓度的增益收敛得慢，两者都要检查
+    bool converged = activeMask != 0;
+    for (int i = 0; i < 2; i++) {
+      float gain = fusionGain[i][0] + fusionGain[i][1];
+      if (fabs(gain - previousGain[i]) > FUSION_CONVERGENCE * fabs(gain)) converged = false;
+    }
+    if (converged) {
+      steadyState = true;
+    }
+  }
+  
+  // 状态更新：x += K * (z - Hx)
+  float innovation[2];
+  for (int m = 0; m < 2; m++) {
+    innovation[m] = (activeMask & (1 << m)) ? measurement[m] - fusionState[0] : 0.0f;
+  }
+  fusionState[0] += fusionGain[0][0] * innovation[0] + fusionGain[0][1] * innovation[1];
+  fusionState[1] += fusionGain[1][0] * innovation[0] + fusionGain[1][1] * innovation[1];
   
-  return state.estimate;
+  // 以融合估计为参考更新回归残差方差
+  if (activeMask & 0x02) {
+    float residual = measurement[1] - fusionState[0];
+    regressionResidualVar += FUSION_RESIDUAL_ALPHA * (residual * residual - regressionResidualVar);
+    if (regressionResidualVar < FUSION_REGRESSION_MIN_VAR) {
+      regressionResidualVar = FUSION_REGRESSION_MIN_VAR;
+    }
+  }
+  
+  fusionConfidence = directNoise / (directNoise + fusionCovariance[0][0]);
+  
+  float fused = clampValue(fusionState[0], (float)POLLUTION_MIN, (float)POLLUTION_MAX);
+  fusedHistory.push(fused);
+  
+  return fused;
 }
 
-void SensorFusion::updateKalmanParameters(uint8_t sensorIndex, float processNoise, float measurementNoise) {
-  if (sensorIndex < 5) {
-    kalmanStates[sensorIndex].processNoise = processNoise;
-    kalmanStates[sensorIndex].measurementNoise = measurementNoise;
-  }
+void SensorFusion::setFusionNoise(float processNoise, float measurementNoise) {
+  this->processNoise = processNoise;
+  this->measurementNoise = measurementNoise;
+  
+  // 稳态增益与噪声参数有关，需重新收敛
+  steadyState = false;
 }
 
 float SensorFusion::compensateFaultySensor(uint8_t faultySensor, const SensorData& sensorData) {
-  // 简化实现：使用其他传感器的平均值
-  float sum = 0.0f;
-  int count = 0;
+  if (faultySensor >= 5) return 0.0f;
   
+  // 模型训练完成前保持最近一次正常读数
+  if (!isRegressionReady(faultySensor)) {
+    return lastHealthyValues[faultySensor];
+  }
+  return estimateByRegression(sensorData, faultySensor);
+}
+
+void SensorFusion::compensateFaults(SensorData& sensorData) {
+  bool anyFault = false;
   for (int i = 0; i < 5; i++) {
-    if (i != faultySensor) {
-      switch (i) {
-        case 0: sum += sensorData.flowRate; break;
-        case 1: sum += sensorData.pollutionLevel; break;
-        case 2: sum += sensorData.lightIntensity; break;
-        case 3: sum += sensorData.pH; break;
-        case 4: sum += sensorData.temperature; break;
-      }
-      count++;
+    if (sensorData.sensorFaults[i]) {
+      anyFault = true;
+    } else {
+      lastHealthyValues[i] = channelValue(sensorData, i);
     }
   }
   
-  return count > 0 ? sum / count : 0.0f;
+  // 全部正常：轮流训练一个目标通道，每次调用的计算量固定
+  if (!anyFault) {
+    updateRegressionModel(sensorData, nextRegressionTarget);
+    nextRegressionTarget = (nextRegressionTarget + 1 < 5) ? nextRegressionTarget + 1 : 0;
+    return;
+  }
+  
+  // 替代故障通道读数（故障标志保留，下游仍可识别）
+  // 预测量中的故障通道使用其最近正常读数，替代值之间互不影响
+  for (int i = 0; i < 5; i++) {
+    if (sensorData.sensorFaults[i]) {
+      setChannelValue(sensorData, i, compensateFaultySensor(i, sensorData));
+    }
+  }
+}
+
+bool SensorFusion::isRegressionReady(uint8_t targetSensor) const {
+  if (targetSensor >= 5) return false;
+  return regressionSamples[targetSensor] >= REGRESSION_MIN_SAMPLES;
 }
 
 float SensorFusion::estimateByRegression(const SensorData& sensorData, uint8_t targetSensor) {
-  // 简化实现：返回平均值
-  return (sensorData.flowRate + sensorData.lightIntensity + sensorData.pH + sensorData.temperature) / 4.0f;
+  if (targetSensor >= 5) return 0.0f;
+  
+  return estimateWithWeights(sensorData, targetSensor, regressionWeights[targetSensor]);
+}
+
+float SensorFusion::estimateWithWeights(const SensorData& sensorData, uint8_t targetSensor,
+                                        const float weights[5]) const {
+  if (targetSensor >= 5) return 0.0f;
+  
+  float regressors[5];
+  buildRegressors(sensorData, targetSensor, regressors);
+  
+  float normalized = 0.0f;
+  for (int i = 0; i < 5; i++) {
+    normalized += weights[i] * regressors[i];
+  }
+  normalized = clampValue(normalized, 0.0f, 1.0f);
+  
+  return CHANNEL_MIN[targetSensor] + normalized * CHANNEL_SPAN[targetSensor];
+}
+
+bool SensorFusion::getRegressionWeights(uint8_t targetSensor, float weights[5]) const {
+  if (!isRegressionReady(targetSensor)) return false;
+  
+  for (int i = 0; i < 5; i++) {
+    weights[i] = regressionWeights[targetSensor][i];
+  }
+  return true;
+}
+
+float SensorFusion::getRegressionTrace(uint8_t targetSensor) const {
+  if (targetSensor >= 5) return 0.0f;
+  
+  float trace = 0.0f;
+  for (int i = 0; i < 5; i++) {
+    trace += regressionCovariance[targetSensor][i][i];
+  }
+  return trace;
 }
 
 float SensorFusion::estimateByPhysicalModel(const SensorData& sensorData, float reactionRate, float degradation) {
@@ -106,8 +306,16 @@ float SensorFusion::getFusionConfidence() const {
   return fusionConfidence;
 }
 
+float SensorFusion::getFusionVariance() const {
+  return fusionCovariance[0][0];
+}
+
+bool SensorFusion::isSteadyState() const {
+  return steadyState;
+}
+
 void SensorFusion::reset() {
-  initialize();
+  initialize(samplePeriod);
 }
 
 float SensorFusion::calculateCovariance(uint8_t sensor1, uint8_t sensor2, const SensorData& sensorData) {
@@ -115,10 +323,159 @@ float SensorFusion::calculateCovariance(uint8_t sensor1, uint8_t sensor2, const
   return 0.0f;
 }
 
-void SensorFusion::updateRegressionModel(const SensorData& sensorData, float actualValue) {
-  // 简化实现
+void SensorFusion::updateRegressionModel(const SensorData& sensorData, uint8_t targetSensor) {
+  if (targetSensor >= 5) return;
+  
+  float (*covariance)[5] = regressionCovariance[targetSensor];
+  float* weights = regressionWeights[targetSensor];
+  
+  float regressors[5];
+  buildRegressors(sensorData, targetSensor, regressors);
+  float target = (channelValue(sensorData, targetSensor) - CHANNEL_MIN[targetSensor]) * CHANNEL_SCALE[targetSensor];
+  
+  // 协方差的迹过大说明激励不足，此时暂停遗忘
+  float lambda = (getRegressionTrace(targetSensor) < REGRESSION_MAX_TRACE) ? REGRESSION_FORGETTING : 1.0f;
+  
+  // 增益 K = Pφ / (λ + φ'Pφ)
+  float pPhi[5];
+  float denominator = lambda;
+  float error = target;
+  for (int i = 0; i < 5; i++) {
+    pPhi[i] = 0.0f;
+    for (int j = 0; j < 5; j++) {
+      pPhi[i] += covariance[i][j] * regressors[j];
+    }
+    denominator += regressors[i] * pPhi[i];
+    error -= weights[i] * regressors[i];
+  }
+  float invDenominator = 1.0f / denominator;
+  
+  // 权重更新 θ += K e
+  for (int i = 0; i < 5; i++) {
+    weights[i] += pPhi[i] * invDenominator * error;
+  }
+  
+  // 协方差更新 P = (P - K φ'P) / λ，只计算上三角并镜像，保持对称
+  float invLambda = 1.0f / lambda;
+  for (int i = 0; i < 5; i++) {
+    for (int j = i; j < 5; j++) {
+      covariance[i][j] = (covariance[i][j] - pPhi[i] * pPhi[j] * invDenominator) * invLambda;
+      covariance[j][i] = covariance[i][j];
+    }
+  }
+  
+  if (regressionSamples[targetSensor] < 0xFFFF) {
+    regressionSamples[targetSensor]++;
+  }
+}
+
+void SensorFusion::buildRegressors(const SensorData& sensorData, uint8_t targetSensor, float regressors[5]) const {
+  // 其余4个通道的归一化值，故障通道使用最近正常读数；最后一项为常数项
+  uint8_t k = 0;
+  for (uint8_t i = 0; i < 5; i++) {
+    if (i == targetSensor) continue;
+    float value = sensorData.sensorFaults[i] ? lastHealthyValues[i] : channelValue(sensorData, i);
+    regressors[k++] = (value - CHANNEL_MIN[i]) * CHANNEL_SCALE[i];
+  }
+  regressors[4] = 1.0f;
+}
+
+void SensorFusion::resetRegressionModel(uint8_t targetSensor) {
+  if (targetSensor >= 5) return;
+  
+  for (int i = 0; i < 5; i++) {
+    regressionWeights[targetSensor][i] = 0.0f;
+    for (int j = 0; j < 5; j++) {
+      regressionCovariance[targetSensor][i][j] = (i == j) ? REGRESSION_INITIAL_COVARIANCE : 0.0f;
+    }
+  }
+  regressionSamples[targetSensor] = 0;
 }
 
 float SensorFusion::calculateResidual(float estimated, float actual) {
   return fabs(estimated - actual);
+}
+
+void SensorFusion::setSamplePeriod(unsigned long periodMs) {
+  if (periodMs == 0 || periodMs == samplePeriod) return;
+  
+  // 变化量状态以"每个采样周期"为单位，按新旧周期之比换算
+  float ratio = (float)periodMs / samplePeriod;
+  fusionState[1] *= ratio;
+  fusionCovariance[0][1] *= ratio;
+  fusionCovariance[1][0] *= ratio;
+  fusionCovariance[1][1] *= ratio * ratio;
+  
+  processNoiseScale = noiseScaleFor(periodMs);
+  samplePeriod = periodMs;
+  
+  // 稳态增益与采样周期有关，需重新收敛
+  steadyState = false;
+}
+
+float SensorFusion::noiseScaleFor(unsigned long periodMs) {
+  // 离散白噪声加速度模型 Q = σ²[T⁴/4 T³/2; T³/2 T²]，状态以采样周期为时间单位
+  // （变化量为每周期的变化）时为 σ²T⁴[1/4 1/2; 1/2 1]，随周期的四次方缩放
+  float relative = (float)periodMs / POLLUTION_SAMPLE_PERIOD;
+  float squared = relative * relative;
+  return squared * squared;
+}
+
+void SensorFusion::predictFusion() {
+  // 匀速模型 F = [1 1; 0 1]
+  fusionState[0] += fusionState[1];
+  if (steadyState) return;
+  
+  // P = F P F' + Q，Q 见 noiseScaleFor()
+  float q = processNoise * processNoiseScale;
+  float p00 = fusionCovariance[0][0];
+  float p01 = fusionCovariance[0][1];
+  float p11 = fusionCovariance[1][1];
+  fusionCovariance[0][0] = p00 + 2.0f * p01 + p11 + q / 4.0f;
+  fusionCovariance[0][1] = p01 + p11 + q / 2.0f;
+  fusionCovariance[1][0] = fusionCovariance[0][1];
+  fusionCovariance[1][1] = p11 + q;
+}
+
+void SensorFusion::computeFusionGain(const float noise[2], uint8_t activeMask) {
+  // 两个观测都只测量浓度（H 的两行均为 [1 0]），S 为2x2矩阵，可直接求逆
+  float p00 = fusionCovariance[0][0];
+  float p10 = fusionCovariance[1][0];
+  
+  for (int i = 0; i < 2; i++) {
+    fusionGain[i][0] = 0.0f;
+    fusionGain[i][1] = 0.0f;
+  }
+  
+  if (activeMask == 0x03) {
+    float det = p00 * (noise[0] + noise[1]) + noise[0] * noise[1];
+    fusionGain[0][0] = p00 * noise[1] / det;
+    fusionGain[1][0] = p10 * noise[1] / det;
+    fusionGain[0][1] = p00 * noise[0] / det;
+    fusionGain[1][1] = p10 * noise[0] / det;
+  } else if (activeMask != 0) {
+    uint8_t m = (activeMask & 0x01) ? 0 : 1;
+    float innovationVar = p00 + noise[m];
+    fusionGain[0][m] = p00 / innovationVar;
+    fusionGain[1][m] = p10 / innovationVar;
+  }
+}
+
+void SensorFusion::updateFusionCovariance() {
+  // P = (I - K H) P，K H 只有第一列非零
+  float g0 = fusionGain[0][0] + fusionGain[0][1];
+  float g1 = fusionGain[1][0] + fusionGain[1][1];
+  float p00 = fusionCovariance[0][0];
+  float p01 = fusionCovariance[0][1];
+  
+  fusionCovariance[0][0] = p00 - g0 * p00;
+  fusionCovariance[0][1] = p01 - g0 * p01;
+  fusionCovariance[1][0] = fusionCovariance[0][1];
+  fusionCovariance[1][1] -= g1 * p01;
+}
+
+uint8_t SensorFusion::qualityLevel(float quality, bool faulty) const {
+  if (faulty || quality <= 0.0f) return 0;
+  if (quality >= 1.0f) return FUSION_QUALITY_LEVELS;
+  return (uint8_t)(quality * FUSION_QUALITY_LEVELS + 0.5f);
 }
\ No newline at end of file
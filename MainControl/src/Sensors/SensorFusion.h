@@ -8,67 +8,107 @@
 
 class SensorFusion {
 private:
-  // 卡尔曼滤波器状态
-  struct KalmanState {
-    float estimate;
-    float estimateError;
-    float processNoise;
-    float measurementNoise;
-  };
-  
   // 传感器权重
   float sensorWeights[5];
   float fusionConfidence;
   
-  // 历史数据
-  CircularBuffer<float, 20> fusedHistory;
-  
-  // 卡尔曼滤波器
-  KalmanState kalmanStates[5];
-  
-  // 回归模型参数
-  float regressionWeights[4]; // 多元回归权重
+  // 历史数据（满后覆盖最旧数据）
+  StatisticalBuffer<float, 20, true> fusedHistory;
+  
+  // 回归模型参数（递推最小二乘，每个目标通道一组）
+  // 预测量为其余4个通道的归一化值及常数项
+  float regressionWeights[5][5];
+  float regressionCovariance[5][5][5];
+  uint16_t regressionSamples[5];
+  uint8_t nextRegressionTarget;       // 轮流更新，每次只更新一个目标通道
+  float lastHealthyValues[5];         // 各通道最近一次正常读数
+  
+  // 多变量融合滤波器
+  // 状态：[污染物浓度, 每个采样周期的变化量]
+  // 观测：污染物传感器直接测量，及由流量/光照/pH/温度回归得到的间接测量
+  float fusionState[2];
+  float fusionCovariance[2][2];
+  float fusionGain[2][2];           // 行：状态，列：观测（直接、回归）
+  float processNoise;               // 默认采样周期下的过程噪声 (ppm²)
+  float measurementNoise;           // 满质量直接测量的噪声方差 (ppm²)
+  float regressionResidualVar;      // 回归观测的残差方差估计
+  uint16_t noiseKey;                // 当前观测噪声配置（量化后）
+  bool steadyState;                 // 协方差已收敛，使用稳态增益
+  bool fusionInitialized;
+  unsigned long lastPollutionStamp; // 上次融合的污染物样本时间
+  unsigned long samplePeriod;       // 污染物通道当前采样周期 (ms)
+  float processNoiseScale;          // 过程噪声相对默认采样周期的比例
   
 public:
   SensorFusion();
   
-  // 初始化融合算法
-  void initialize();
+  // 初始化融合算法，pollutionPeriod 为污染物通道当前的采样周期 (ms)
+  void initialize(unsigned long pollutionPeriod = POLLUTION_SAMPLE_PERIOD);
   
   // 多传感器融合
   float fuseSensorData(const SensorData& sensorData);
   
-  // 卡尔曼滤波
-  float applyKalmanFilter(uint8_t sensorIndex, float measurement);
-  void updateKalmanParameters(uint8_t sensorIndex, float processNoise, float measurementNoise);
+  // 融合滤波器的噪声参数（修改后重新收敛）
+  void setFusionNoise(float processNoise, float measurementNoise);
   
   // 传感器故障补偿
   float compensateFaultySensor(uint8_t faultySensor, const SensorData& sensorData);
   
+  // 全部通道正常时训练回归模型，否则以回归估计替代故障通道读数
+  void compensateFaults(SensorData& sensorData);
+  bool isRegressionReady(uint8_t targetSensor) const;
+  
   // 回归模型估计
   float estimateByRegression(const SensorData& sensorData, uint8_t targetSensor);
   
+  // 以给定的回归系数估计（漂移监测使用冻结的系数作为参考）
+  float estimateWithWeights(const SensorData& sensorData, uint8_t targetSensor, const float weights[5]) const;
+  bool getRegressionWeights(uint8_t targetSensor, float weights[5]) const;
+  
+  // 回归协方差矩阵的迹（激励不足时停止遗忘，迹不再增长）
+  float getRegressionTrace(uint8_t targetSensor) const;
+  
   // 物理模型估计
   float estimateByPhysicalModel(const SensorData& sensorData, float reactionRate, float degradation);
   
   // 自适应权重调整
   void adjustWeightsBasedOnQuality(const SensorData& sensorData);
   
-  // 获取融合置信度
+  // 获取融合置信度（由估计方差换算，单次满质量测量的方差对应0.5）
   float getFusionConfidence() const;
   
-  // 重置融合算法
+  // 获取融合估计的方差 (ppm²)
+  float getFusionVariance() const;
+  bool isSteadyState() const;
+  
+  // 污染物通道采样周期变化：按新周期换算变化量状态与过程噪声
+  void setSamplePeriod(unsigned long periodMs);
+  
+  // 重置融合算法（保持当前的采样周期）
   void reset();
   
 private:
   // 计算协方差
   float calculateCovariance(uint8_t sensor1, uint8_t sensor2, const SensorData& sensorData);
   
-  // 更新回归模型
-  void updateRegressionModel(const SensorData& sensorData, float actualValue);
+  // 更新回归模型（一个目标通道的RLS更新，O(k²)）
+  void updateRegressionModel(const SensorData& sensorData, uint8_t targetSensor);
+  
+  // 构造目标通道的预测量向量
+  void buildRegressors(const SensorData& sensorData, uint8_t targetSensor, float regressors[5]) const;
+  void resetRegressionModel(uint8_t targetSensor);
   
   // 计算残差
   float calculateResidual(float estimated, float actual);
+  
+  // 融合滤波器：预测、增益计算与协方差更新
+  static float noiseScaleFor(unsigned long periodMs);
+  void predictFusion();
+  void computeFusionGain(const float noise[2], uint8_t activeMask);
+  void updateFusionCovariance();
+  
+  // 将数据质量量化为观测噪声等级（0表示不使用该观测）
+  uint8_t qualityLevel(float quality, bool faulty) const;
 };
 
 #endif // SENSOR_FUSION_H
\ No newline at end of file
@@ -1,38 +1,129 @@
 #include "SensorManager.h"
 #include <EEPROM.h>
 
-// 简化数学函数，避免依赖 MathUtils.h
-namespace LocalMath {
-  float constrainFloat(float value, float minVal, float maxVal) {
-    if (value < minVal) return minVal;
-    if (value > maxVal) return maxVal;
-    return value;
-  }
-  
-  float mapFloat(float value, float inMin, float inMax, float outMin, float outMax) {
-    return (value - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
-  }
+// ========== 处理链常量 ==========
+// 均为编译期常量：定点模式下在编译时换算为Q16.16/Q8.24，运行时不做浮点运算
+
+// 各通道量程，未校准时校准表按量程线性映射
+static const float PHYSICAL_MIN[5] = { FLOW_MIN, POLLUTION_MIN, LIGHT_MIN, PH_MIN, TEMP_MIN };
+static const float PHYSICAL_MAX[5] = { FLOW_MAX, POLLUTION_MAX, LIGHT_MAX, PH_MAX, TEMP_MAX };
+
+// 离散度与偏离比例的分母下限（ADC计数），各通道量程均对应ADC满量程
+static const SensorValue DISPERSION_FLOOR[5] = {
+  SensorValue(FLOW_DISPERSION_FLOOR * 1023.0f), SensorValue(POLLUTION_DISPERSION_FLOOR * 1023.0f),
+  SensorValue(LIGHT_DISPERSION_FLOOR * 1023.0f), SensorValue(PH_DISPERSION_FLOOR * 1023.0f),
+  SensorValue(TEMP_DISPERSION_FLOOR * 1023.0f)
+};
+
+// 离散度与偏离比例的分母：窗口均值，不小于该通道的下限
+static SensorValue dispersionScale(uint8_t sensorIndex, SensorValue mean) {
+  SensorValue magnitude = absValue(mean);
+  return magnitude > DISPERSION_FLOOR[sensorIndex] ? magnitude : DISPERSION_FLOOR[sensorIndex];
+}
+
+// 通道处理顺序：温度先于pH，同一轮更新中pH使用本轮的温度补偿
+static const uint8_t PROCESS_ORDER[5] = { 4, 0, 1, 2, 3 };
+
+static const uint8_t ADC_RESOLUTION_BITS = 10;
+static const uint8_t MAX_DECIMATION_BITS = 4;
+#if !SENSOR_FIXED_POINT
+static const float DECIMATION_STEP[MAX_DECIMATION_BITS + 1] = { 1.0f, 0.5f, 0.25f, 0.125f, 0.0625f };
+#endif
+
+static const SensorValue VALUE_ZERO(0.0f);
+static const SensorValue VALUE_ONE(1.0f);
+
+static const SensorValue FILTER_ALPHA(0.3f);           // 低通滤波系数
+static const SensorValue FAULT_RAW_MIN(50.0f);         // 原始值有效范围
+static const SensorValue FAULT_RAW_MAX(1000.0f);
+static const SensorValue FAULT_JUMP_RATIO(0.3f);       // 突变阈值（30%）
+static const SensorValue STABILITY_VARIANCE_CAP(0.5f);
+static const SensorValue QUALITY_STABILITY_WEIGHT(0.7f);
+static const SensorValue QUALITY_VARIANCE_WEIGHT(0.3f);
+static const SensorValue HAMPEL_THRESHOLD(3.0f * 1.4826f);   // 3倍MAD换算的标准差
+static const SensorValue HAMPEL_MIN_DEVIATION(4.0f);         // 最小判定偏差（ADC计数），窗口恒定时MAD为0
+static const SensorValue ADAPT_VARIANCE_HIGH(0.05f);        // 离散度（方差/均值）高于此值时加快采样
+static const SensorValue ADAPT_VARIANCE_LOW(0.005f);        // 离散度低于此值视为平稳
+static const SensorValue ADAPT_DEVIATION_HIGH(0.02f);       // 最新样本偏离窗口均值的比例
+static const SensorValue ADAPT_DEVIATION_LOW(0.005f);
+static const uint8_t ADAPT_QUIET_SAMPLES = 2 * STABILITY_WINDOW_SIZE; // 连续平稳样本数达到后放慢采样
+static const SensorValue PH_NEUTRAL(7.0f);
+static const float KELVIN_OFFSET = 273.15f;
+static const float PH_COMPENSATION_TEMP_MIN = 0.0f;          // 温度补偿的有效范围 (°C)
+static const float PH_COMPENSATION_TEMP_MAX = 60.0f;
+
+static_assert(ROBUST_SAMPLE_WINDOW <= ADC_RECENT_SAMPLES, "ROBUST_SAMPLE_WINDOW exceeds ADC_RECENT_SAMPLES");
+#if EMERGENCY_FAST_PATH
+static_assert(EMERGENCY_TRIP_LEVEL > EMERGENCY_CLEAR_LEVEL, "EMERGENCY_TRIP_LEVEL must exceed EMERGENCY_CLEAR_LEVEL");
+#endif
+static const uint16_t RAW_UNREACHABLE = 1024;                // 超出10位原始值范围，永不触发
+static const uint16_t DRIFT_SLOPE_SPAN = 16;                 // 估计换算斜率的原始值间距
+
+// 校准表在EEPROM中的地址
+static int calibrationAddress(uint8_t sensorIndex) {
+  return CALIBRATION_EEPROM_ADDR + sensorIndex * CalibrationTable::STORAGE_SIZE;
 }
 
 SensorManager::SensorManager() {
+  const unsigned long periods[5] = SENSOR_PERIOD_LIST;
+  const uint16_t oversamples[5] = SENSOR_OVERSAMPLE_LIST;
+  const uint8_t decimations[5] = SENSOR_DECIMATION_LIST;
+  const unsigned long minimums[5] = SENSOR_MIN_PERIOD_LIST;
+  const unsigned long maximums[5] = SENSOR_MAX_PERIOD_LIST;
+  
   // 初始化校准参数（默认值）
   for (int i = 0; i < 5; i++) {
-    calibrationOffsets[i] = 0.0f;
-    calibrationGains[i] = 1.0f;
-    previousReadings[i] = 0.0f;
-    faultStartTime[i] = 0;
-    persistentFaults[i] = false;
-    dataStability[i] = 1.0f;
-    dataVariance[i] = 0.0f;
+    calibrationOffsets[i] = VALUE_ZERO;
+    calibrationGains[i] = VALUE_ONE;
+    calibrationTables[i].setRange(PHYSICAL_MIN[i], PHYSICAL_MAX[i]);
+    samplePeriods[i] = constrain(periods[i], minimums[i], maximums[i]);
+    minPeriods[i] = minimums[i];
+    maxPeriods[i] = maximums[i];
+    oversampleCounts[i] = oversamples[i];
+    decimationBits[i] = 0;
+    setDecimation(i, decimations[i]);
+    resetChannelState(i);
   }
+  phTemperatureFactor = SensorScale(1.0f);
+  lastWatchTime = 0;
+#if EMERGENCY_FAST_PATH
+  emergencyTripRaw = RAW_UNREACHABLE;
+  emergencyClearRaw = RAW_UNREACHABLE;
+#endif
+  
+  memset(&latestData, 0, sizeof(latestData));
 }
 
 bool SensorManager::initialize() {
   // 从EEPROM加载校准数据
   for (int i = 0; i < 5; i++) {
     int addr = i * sizeof(float) * 2;
-    EEPROM.get(addr, calibrationOffsets[i]);
-    EEPROM.get(addr + sizeof(float), calibrationGains[i]);
+    float offset, gain;
+    EEPROM.get(addr, offset);
+    EEPROM.get(addr + sizeof(float), gain);
+    
+    // 未写入过的EEPROM读出为NaN，使用默认值
+    if (isnan(offset) || isnan(gain)) {
+      offset = 0.0f;
+      gain = 1.0f;
+    }
+    setCalibration(i, offset, gain);
+    calibrationTables[i].load(calibrationAddress(i));
+    resetChannelState(i);
+  }
+
+#if EMERGENCY_FAST_PATH
+  updateEmergencyThresholds();
+  sensorSource.getWatchdog().reset();
+#endif
+  
+  // 启动数据源；清除后批次序号从0重新计数
+  sensorSource.clear();
+  for (int i = 0; i < 5; i++) {
+    lastBatchSequence[i] = 0;
+  }
+  if (!sensorSource.begin()) {
+    return false;
   }
   
   // 清除缓冲区
@@ -40,58 +131,67 @@ bool SensorManager::initialize() {
   pollutionBuffer.clear();
   lightBuffer.clear();
   pHBuffer.clear();
+  temperatureBuffer.clear();
   
-  // 初始读数，建立基准
+  // 初始读数，建立基准：所有通道立即到期
+  unsigned long now = millis();
+  for (int i = 0; i < 5; i++) {
+    lastRequestTime[i] = now - samplePeriods[i];
+  }
   for (int i = 0; i < 10; i++) {
-    readAllSensors();
+    update();
     delay(100);
   }
   
   return true;
 }
 
-SensorData SensorManager::readAllSensors() {
-  SensorData data;
-  
-  // 读取所有传感器原始值
-  float rawReadings[5];
-  rawReadings[0] = readSensorRaw(FLOW_SENSOR_PIN);
-  rawReadings[1] = readSensorRaw(POLLUTION_SENSOR_PIN);
-  rawReadings[2] = readSensorRaw(LIGHT_SENSOR_PIN);
-  rawReadings[3] = readSensorRaw(PH_SENSOR_PIN);
-  rawReadings[4] = readSensorRaw(TEMPERATURE_SENSOR_PIN);
-  
-  // 应用滤波
-  for (int i = 0; i < 5; i++) {
-    rawReadings[i] = applyFilter(i, rawReadings[i]);
-  }
-  
-  // 转换到物理量
-  data.flowRate = convertToPhysical(0, rawReadings[0]);
-  data.pollutionLevel = convertToPhysical(1, rawReadings[1]);
-  data.lightIntensity = convertToPhysical(2, rawReadings[2]);
-  data.pH = convertToPhysical(3, rawReadings[3]);
-  data.temperature = convertToPhysical(4, rawReadings[4]);
-  
-  // 检测故障
-  for (int i = 0; i < 5; i++) {
-    data.sensorFaults[i] = detectFault(i, rawReadings[i]);
+bool SensorManager::update() {
+  unsigned long now = millis();
+  bool updated = false;
+  
+  for (uint8_t n = 0; n < 5; n++) {
+    uint8_t i = PROCESS_ORDER[n];
+    
+    // 处理已完成的批次
+    AdcSnapshot snap;
+    if (sensorSource.snapshot(i, snap) && snap.sequence != lastBatchSequence[i]) {
+      lastBatchSequence[i] = snap.sequence;
+      lastUpdateTime[i] = now;
+      processChannel(i, readSensorRaw(i));
+      updated = true;
+    }
+    
+    // 到期通道申请新一批转换
+    if (now - lastRequestTime[i] >= samplePeriods[i]) {
+      lastRequestTime[i] = now;
+      sensorSource.request(i, oversampleCounts[i]);
+    }
   }
-  
-  // 计算数据质量
-  for (int i = 0; i < 5; i++) {
-    data.dataQuality[i] = calculateDataQuality(i, rawReadings[i], data.sensorFaults[i]);
+
+#if EMERGENCY_FAST_PATH
+  // 被监视通道在批次之间按固定间隔单独转换，不受其采样周期限制
+  if (now - lastWatchTime >= EMERGENCY_WATCH_INTERVAL) {
+    lastWatchTime = now;
+    sensorSource.requestWatch();
   }
+#endif
   
-  // 更新历史缓冲区
-  flowBuffer.push(data.flowRate);
-  pollutionBuffer.push(data.pollutionLevel);
-  lightBuffer.push(data.lightIntensity);
-  pHBuffer.push(data.pH);
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 频谱变换分摊到每次循环
+  spectrum.update();
+#endif
+
+  return updated;
+}
+
+SensorData SensorManager::readAllSensors() {
+  // 仅返回最新快照，不等待ADC
+  SensorData data = latestData;
   
-  // 更新稳定性数据
+  unsigned long now = millis();
   for (int i = 0; i < 5; i++) {
-    updateStability(i, rawReadings[i]);
+    data.sampleAge[i] = now - lastUpdateTime[i];
   }
   
   // 这些值需要外部计算
@@ -101,43 +201,185 @@ SensorData SensorManager::readAllSensors() {
   return data;
 }
 
-float SensorManager::readSensorRaw(uint8_t sensorPin) {
-  // 多次采样取平均，减少噪声
-  const int samples = 10;
-  long sum = 0;
+SensorSource& SensorManager::getSource() {
+  return sensorSource;
+}
+
+void SensorManager::setSampleSchedule(uint8_t sensorIndex, unsigned long periodMs, uint16_t oversample) {
+  if (sensorIndex >= 5 || periodMs == 0 || oversample == 0) return;
+  
+  changeSamplePeriod(sensorIndex, periodMs);
+  oversampleCounts[sensorIndex] = oversample;
   
-  for (int i = 0; i < samples; i++) {
-    sum += analogRead(sensorPin);
-    delayMicroseconds(100);
+  // 转换次数不再是 4^n 时退出抽取模式
+  if (oversample != (1U << (2 * decimationBits[sensorIndex]))) {
+    decimationBits[sensorIndex] = 0;
   }
+}
+
+unsigned long SensorManager::getSamplePeriod(uint8_t sensorIndex) const {
+  if (sensorIndex >= 5) return 0;
+  return samplePeriods[sensorIndex];
+}
+
+void SensorManager::setSamplePeriodRange(uint8_t sensorIndex, unsigned long minPeriod, unsigned long maxPeriod) {
+  if (sensorIndex >= 5 || minPeriod == 0 || maxPeriod < minPeriod) return;
   
-  return static_cast<float>(sum) / samples;
+  minPeriods[sensorIndex] = minPeriod;
+  maxPeriods[sensorIndex] = maxPeriod;
+  changeSamplePeriod(sensorIndex, constrain(samplePeriods[sensorIndex], minPeriod, maxPeriod));
 }
 
-float SensorManager::convertToPhysical(uint8_t sensorIndex, float rawValue) {
-  // 应用校准参数
-  float calibrated = (rawValue * calibrationGains[sensorIndex]) + calibrationOffsets[sensorIndex];
+bool SensorManager::pollSampleRateEvent(SampleRateEvent& event) {
+  return rateEvents.pop(event);
+}
+
+void SensorManager::setDecimation(uint8_t sensorIndex, uint8_t bits) {
+  if (sensorIndex >= 5) return;
+  if (bits > MAX_DECIMATION_BITS) bits = MAX_DECIMATION_BITS;
+  
+  decimationBits[sensorIndex] = bits;
+  if (bits > 0) {
+    oversampleCounts[sensorIndex] = 1U << (2 * bits);
+  }
+}
+
+uint8_t SensorManager::getResolutionBits(uint8_t sensorIndex) const {
+  if (sensorIndex >= 5) return 0;
+  return ADC_RESOLUTION_BITS + decimationBits[sensorIndex];
+}
+
+uint32_t SensorManager::getConversionTime(uint8_t sensorIndex) const {
+  AdcSnapshot snap;
+  if (!sensorSource.snapshot(sensorIndex, snap)) return 0;
+  return snap.batchMicros;
+}
+
+void SensorManager::processChannel(uint8_t sensorIndex, SensorValue rawValue) {
+  // 剔除孤立毛刺后再滤波
+  SensorValue despiked = rejectSpike(sensorIndex, rawValue);
+  SensorValue filtered = applyFilter(sensorIndex, despiked);
+
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 低通滤波会衰减高频噪声，频谱分析使用滤波前的读数
+  spectrum.addSample(sensorIndex, despiked, samplePeriods[sensorIndex]);
+#endif
+  
+  // 转换到物理量（处理链到此为止，之后才转换为float）
+  storeChannelValue(sensorIndex, toFloat(convertToPhysical(sensorIndex, filtered)));
+  
+  // 检测故障并计算数据质量
+  bool faulty = detectFault(sensorIndex, filtered);
+  latestData.sensorFaults[sensorIndex] = faulty;
+  latestData.dataQuality[sensorIndex] = calculateDataQuality(sensorIndex, filtered, faulty);
+  latestData.resolutionBits[sensorIndex] = getResolutionBits(sensorIndex);
+  
+  // 温度读数有效时更新pH补偿
+  if (sensorIndex == 4 && !faulty) {
+    updateTemperatureCompensation(latestData.temperature);
+  }
   
-  // 映射到物理范围
+  // 更新稳定性数据
+  updateStability(sensorIndex, filtered);
+
+#if SENSOR_ADAPTIVE_SAMPLING
+  // 故障通道的读数不反映过程变化，不参与调整
+  if (!faulty) {
+    adaptSamplePeriod(sensorIndex, filtered);
+  }
+#endif
+}
+
+void SensorManager::storeChannelValue(uint8_t sensorIndex, float value) {
   switch (sensorIndex) {
-    case 0: // 流量
-      return LocalMath::mapFloat(calibrated, 0.0f, 1023.0f, FLOW_MIN, FLOW_MAX);
-    case 1: // 污染物
-      return LocalMath::mapFloat(calibrated, 0.0f, 1023.0f, POLLUTION_MIN, POLLUTION_MAX);
-    case 2: // 光照
-      return LocalMath::mapFloat(calibrated, 0.0f, 1023.0f, LIGHT_MIN, LIGHT_MAX);
-    case 3: // pH
-      return LocalMath::mapFloat(calibrated, 0.0f, 1023.0f, PH_MIN, PH_MAX);
-    case 4: // 温度
-      return LocalMath::mapFloat(calibrated, 0.0f, 1023.0f, TEMP_MIN, TEMP_MAX);
-    default:
-      return calibrated;
-  }
-}
-
-bool SensorManager::detectFault(uint8_t sensorIndex, float rawValue) {
+    case 0:
+      latestData.flowRate = value;
+      flowBuffer.push(value);
+      break;
+    case 1:
+      latestData.pollutionLevel = value;
+      latestData.measuredPollution = value;
+      pollutionBuffer.push(value);
+      break;
+    case 2:
+      latestData.lightIntensity = value;
+      lightBuffer.push(value);
+      break;
+    case 3:
+      latestData.pH = value;
+      pHBuffer.push(value);
+      break;
+    case 4:
+      latestData.temperature = value;
+      temperatureBuffer.push(value);
+      break;
+  }
+}
+
+SensorValue SensorManager::readSensorRaw(uint8_t sensorIndex) {
+  // 后台中断已完成多次采样，这里直接取批次平均值
+  AdcSnapshot snap;
+  if (!sensorSource.snapshot(sensorIndex, snap)) {
+    return VALUE_ZERO;
+  }
+
+  // 过采样抽取：4^n 个样本之和右移 n 位得到 10+n 位读数。
+  // 处理链仍以10位ADC计数为单位，多出的位数作为小数部分保留到物理量换算
+  uint8_t bits = decimationBits[sensorIndex];
+  if (bits > 0 && snap.count == (1U << (2 * bits))) {
+    uint32_t decimated = snap.sum >> bits;
+#if SENSOR_FIXED_POINT
+    return Fix16::fromRaw(static_cast<int32_t>(decimated << (Fix16::FRACTION_BITS - bits)));
+#else
+    return decimated * DECIMATION_STEP[bits];
+#endif
+  }
+
+#if SENSOR_ROBUST_SAMPLING
+  // 最近样本经排序网络排序后取截尾均值，单个ADC毛刺不影响结果
+  // （截尾均值只用到少量样本，抽取模式的通道不使用）
+  // 样本不足一个窗口时退回批次平均值
+  uint16_t window[ROBUST_SAMPLE_WINDOW];
+  if (sensorSource.getRecentSamples(sensorIndex, window, ROBUST_SAMPLE_WINDOW) == ROBUST_SAMPLE_WINDOW) {
+    snap.sum = trimmedSum<ROBUST_SAMPLE_WINDOW, ROBUST_TRIM_COUNT>(window);
+    snap.count = ROBUST_SAMPLE_WINDOW - 2 * ROBUST_TRIM_COUNT;
+  }
+#endif
+  
+#if SENSOR_FIXED_POINT
+  return Fix16::fromRatio(snap.sum, snap.count);
+#else
+  return static_cast<float>(snap.sum) / snap.count;
+#endif
+}
+
+SensorValue SensorManager::convertToPhysical(uint8_t sensorIndex, SensorValue rawValue) {
+  // 应用校准参数
+  SensorValue calibrated = (rawValue * calibrationGains[sensorIndex]) + calibrationOffsets[sensorIndex];
+  
+  if (sensorIndex >= 5) {
+    return calibrated;
+  }
+  
+  // 分段线性查表（各段系数在校准时预先计算，无运行时除法）
+  SensorValue value = calibrationTables[sensorIndex].evaluate(calibrated);
+  
+  // pH电极的能斯特斜率与绝对温度成正比：校准表对应参考温度，
+  // 按当前温度缩放相对中性点的偏差
+  if (sensorIndex == 3) {
+    value = PH_NEUTRAL + (value - PH_NEUTRAL) * phTemperatureFactor;
+  }
+  return value;
+}
+
+void SensorManager::updateTemperatureCompensation(float temperature) {
+  temperature = constrain(temperature, PH_COMPENSATION_TEMP_MIN, PH_COMPENSATION_TEMP_MAX);
+  phTemperatureFactor = SensorScale((PH_REFERENCE_TEMP + KELVIN_OFFSET) / (temperature + KELVIN_OFFSET));
+}
+
+bool SensorManager::detectFault(uint8_t sensorIndex, SensorValue rawValue) {
   // 范围检查
-  if (rawValue < 50.0f || rawValue > 1000.0f) {
+  if (rawValue < FAULT_RAW_MIN || rawValue > FAULT_RAW_MAX) {
     if (faultStartTime[sensorIndex] == 0) {
       faultStartTime[sensorIndex] = millis();
     } else if (millis() - faultStartTime[sensorIndex] > 5000) {
@@ -146,10 +388,10 @@ bool SensorManager::detectFault(uint8_t sensorIndex, float rawValue) {
     return true;
   }
   
-  // 突变检测（超过30%变化）
-  if (previousReadings[sensorIndex] > 0.0f) {
-    float change = fabs(rawValue - previousReadings[sensorIndex]) / previousReadings[sensorIndex];
-    if (change > 0.3f) {
+  // 突变检测（超过30%变化），以乘法代替除法
+  SensorValue previous = previousReadings[sensorIndex];
+  if (previous > VALUE_ZERO) {
+    if (absValue(rawValue - previous) > previous * FAULT_JUMP_RATIO) {
       if (faultStartTime[sensorIndex] == 0) {
         faultStartTime[sensorIndex] = millis();
       } else if (millis() - faultStartTime[sensorIndex] > 1000) {
@@ -162,85 +404,193 @@ bool SensorManager::detectFault(uint8_t sensorIndex, float rawValue) {
   
   previousReadings[sensorIndex] = rawValue;
   persistentFaults[sensorIndex] = false;
+
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 读数在范围内但高频段噪声过大（干扰、接线松动）
+  if (spectrum.isNoisy(sensorIndex)) {
+    return true;
+  }
+#endif
   return false;
 }
 
-float SensorManager::calculateDataQuality(uint8_t sensorIndex, float rawValue, bool isFaulty) {
+float SensorManager::calculateDataQuality(uint8_t sensorIndex, SensorValue rawValue, bool isFaulty) {
   if (isFaulty) return 0.0f;
   
-  float quality = dataStability[sensorIndex] * 0.7f + (1.0f - dataVariance[sensorIndex]) * 0.3f;
-  return LocalMath::constrainFloat(quality, 0.0f, 1.0f);
+  SensorValue quality = dataStability[sensorIndex] * QUALITY_STABILITY_WEIGHT +
+                        (VALUE_ONE - dataVariance[sensorIndex]) * QUALITY_VARIANCE_WEIGHT;
+
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 高频段噪声按有效值扣减；周期性脉动和缓慢漂移属于过程本身的变化，不扣减
+  quality = quality * spectrum.getFeatures(sensorIndex).qualityFactor;
+#endif
+  return toFloat(clampValue(quality, VALUE_ZERO, VALUE_ONE));
 }
 
-void SensorManager::updateStability(uint8_t sensorIndex, float currentValue) {
-  // 简化稳定性计算
-  static float history[5][5] = {{0}};
-  static uint8_t historyIndex[5] = {0};
+void SensorManager::updateStability(uint8_t sensorIndex, SensorValue currentValue) {
+  // 滑动窗口增量统计，每个样本常数时间
+  StatisticalBuffer<SensorValue, STABILITY_WINDOW_SIZE, true>& window = stabilityWindow[sensorIndex];
+  window.push(currentValue);
+  
+  // 定点模式下平方和按64位累加；方差本身超出 Q16.16 范围时饱和，结果仍被限制到上限
+  SensorValue mean = window.getAverage();
+  SensorValue variance = window.getPopulationVariance();
+  dataVariance[sensorIndex] = variance / dispersionScale(sensorIndex, mean);
+  dataStability[sensorIndex] = VALUE_ONE - clampValue(dataVariance[sensorIndex], VALUE_ZERO, STABILITY_VARIANCE_CAP);
+}
+
+void SensorManager::adaptSamplePeriod(uint8_t sensorIndex, SensorValue currentValue) {
+  if (!stabilityWindow[sensorIndex].isFull()) return;
+  
+  // 离散度与变化率均取自稳定性窗口，不需要额外计算
+  SensorValue mean = stabilityWindow[sensorIndex].getAverage();
+  SensorValue variance = dataVariance[sensorIndex];
+  SensorValue deviation = absValue(currentValue - mean);
+  SensorValue scale = dispersionScale(sensorIndex, mean);
+  
+  unsigned long period = samplePeriods[sensorIndex];
+  if (variance > ADAPT_VARIANCE_HIGH || deviation > scale * ADAPT_DEVIATION_HIGH) {
+    // 剧烈变化：立即加快
+    quietSamples[sensorIndex] = 0;
+    period /= 2;
+  } else if (variance < ADAPT_VARIANCE_LOW && deviation < scale * ADAPT_DEVIATION_LOW) {
+    // 持续平稳：逐步放慢
+    if (++quietSamples[sensorIndex] < ADAPT_QUIET_SAMPLES) return;
+    quietSamples[sensorIndex] = 0;
+    period *= 2;
+  } else {
+    // 介于两个阈值之间时保持（滞回）
+    quietSamples[sensorIndex] = 0;
+    return;
+  }
   
-  history[sensorIndex][historyIndex[sensorIndex]] = currentValue;
-  historyIndex[sensorIndex] = (historyIndex[sensorIndex] + 1) % 5;
+  changeSamplePeriod(sensorIndex, constrain(period, minPeriods[sensorIndex], maxPeriods[sensorIndex]));
+}
+
+void SensorManager::changeSamplePeriod(uint8_t sensorIndex, unsigned long periodMs) {
+  unsigned long previous = samplePeriods[sensorIndex];
+  if (periodMs == previous) return;
+  samplePeriods[sensorIndex] = periodMs;
+  
+  SampleRateEvent event;
+  event.sensorIndex = sensorIndex;
+  event.previousPeriod = previous;
+  event.newPeriod = periodMs;
+  event.timestamp = millis();
+  if (rateEvents.isFull()) {
+    SampleRateEvent dropped;
+    rateEvents.pop(dropped);
+  }
+  rateEvents.push(event);
+}
+
+SensorValue SensorManager::rejectSpike(uint8_t sensorIndex, SensorValue rawValue) {
+  // 窗口保存未修正的原始读数，真实的阶跃变化在窗口过半后被接受
+  SensorValue* history = hampelWindow[sensorIndex];
+  history[hampelIndex[sensorIndex]] = rawValue;
+  hampelIndex[sensorIndex] = (hampelIndex[sensorIndex] + 1 < HAMPEL_WINDOW_SIZE) ? hampelIndex[sensorIndex] + 1 : 0;
+  if (hampelCount[sensorIndex] < HAMPEL_WINDOW_SIZE) {
+    hampelCount[sensorIndex]++;
+    return rawValue;
+  }
   
-  // 计算平均值和方差
-  float sum = 0.0f;
-  for (int i = 0; i < 5; i++) {
-    sum += history[sensorIndex][i];
+  // 中值与中值绝对偏差（MAD）
+  SensorValue sorted[HAMPEL_WINDOW_SIZE];
+  for (uint8_t i = 0; i < HAMPEL_WINDOW_SIZE; i++) {
+    sorted[i] = history[i];
+  }
+  SensorValue median = sortedMedian<HAMPEL_WINDOW_SIZE>(sorted);
+  for (uint8_t i = 0; i < HAMPEL_WINDOW_SIZE; i++) {
+    sorted[i] = absValue(sorted[i] - median);
   }
-  float mean = sum / 5.0f;
+  SensorValue mad = sortedMedian<HAMPEL_WINDOW_SIZE>(sorted);
   
-  float variance = 0.0f;
-  for (int i = 0; i < 5; i++) {
-    float diff = history[sensorIndex][i] - mean;
-    variance += diff * diff;
+  SensorValue threshold = mad * HAMPEL_THRESHOLD;
+  if (threshold < HAMPEL_MIN_DEVIATION) {
+    threshold = HAMPEL_MIN_DEVIATION;
   }
-  variance /= 5.0f;
   
-  dataVariance[sensorIndex] = variance / (mean + 0.001f);
-  dataStability[sensorIndex] = 1.0f - LocalMath::constrainFloat(dataVariance[sensorIndex], 0.0f, 0.5f);
+  if (absValue(rawValue - median) > threshold) {
+    spikeCount[sensorIndex]++;
+    return median;
+  }
+  return rawValue;
 }
 
-float SensorManager::applyFilter(uint8_t sensorIndex, float rawValue) {
-  // 一阶低通滤波器
-  static float filtered[5] = {0};
-  
-  if (filtered[sensorIndex] == 0.0f) {
-    filtered[sensorIndex] = rawValue;
+SensorValue SensorManager::applyFilter(uint8_t sensorIndex, SensorValue rawValue) {
+  // 一阶低通滤波器：y += alpha * (x - y)
+  if (!filterInitialized[sensorIndex]) {
+    filteredValues[sensorIndex] = rawValue;
+    filterInitialized[sensorIndex] = true;
   } else {
-    float alpha = 0.3f; // 滤波系数
-    filtered[sensorIndex] = alpha * rawValue + (1.0f - alpha) * filtered[sensorIndex];
+    filteredValues[sensorIndex] += FILTER_ALPHA * (rawValue - filteredValues[sensorIndex]);
   }
   
-  return filtered[sensorIndex];
+  return filteredValues[sensorIndex];
 }
 
-bool SensorManager::calibrateSensor(uint8_t sensorIndex, float knownValue) {
-  if (sensorIndex >= 5) return false;
+void SensorManager::resetChannelState(uint8_t sensorIndex) {
+  previousReadings[sensorIndex] = VALUE_ZERO;
+  faultStartTime[sensorIndex] = 0;
+  persistentFaults[sensorIndex] = false;
+  dataStability[sensorIndex] = VALUE_ONE;
+  dataVariance[sensorIndex] = VALUE_ZERO;
   
-  // 获取传感器引脚
-  uint8_t sensorPin;
-  switch (sensorIndex) {
-    case 0: sensorPin = FLOW_SENSOR_PIN; break;
-    case 1: sensorPin = POLLUTION_SENSOR_PIN; break;
-    case 2: sensorPin = LIGHT_SENSOR_PIN; break;
-    case 3: sensorPin = PH_SENSOR_PIN; break;
-    case 4: sensorPin = TEMPERATURE_SENSOR_PIN; break;
-    default: sensorPin = A0; break;
+  filteredValues[sensorIndex] = VALUE_ZERO;
+  filterInitialized[sensorIndex] = false;
+  
+  for (int i = 0; i < HAMPEL_WINDOW_SIZE; i++) {
+    hampelWindow[sensorIndex][i] = VALUE_ZERO;
   }
+  hampelIndex[sensorIndex] = 0;
+  hampelCount[sensorIndex] = 0;
+  spikeCount[sensorIndex] = 0;
   
-  // 读取当前原始值
-  float rawValue = readSensorRaw(sensorPin);
+#if SENSOR_SPECTRUM_ANALYSIS
+  spectrum.reset(sensorIndex);
+#endif
+
+  stabilityWindow[sensorIndex].clear();
+  quietSamples[sensorIndex] = 0;
+  
+  lastRequestTime[sensorIndex] = 0;
+  lastUpdateTime[sensorIndex] = 0;
+  // 已处理过的批次不再重复处理，从下一批开始
+  AdcSnapshot snap;
+  lastBatchSequence[sensorIndex] = sensorSource.snapshot(sensorIndex, snap) ? snap.sequence : 0;
+}
+
+bool SensorManager::calibrateSensor(uint8_t sensorIndex, float knownValue) {
+  if (sensorIndex >= 5) return false;
   
-  // 计算新的校准参数
-  calibrationGains[sensorIndex] = knownValue / (rawValue + 0.001f);
-  calibrationOffsets[sensorIndex] = 0.0f;
+  // 读取当前原始值，校准点取偏移/增益修正后的值，与换算时查表的输入一致
+  SensorValue raw = readSensorRaw(sensorIndex);
+  float rawValue = toFloat(raw * calibrationGains[sensorIndex] + calibrationOffsets[sensorIndex]);
+  if (rawValue < 0.0f || rawValue > 1023.0f) return false;
   
-  // 保存到EEPROM
-  int addr = sensorIndex * sizeof(float) * 2;
-  EEPROM.put(addr, calibrationOffsets[sensorIndex]);
-  EEPROM.put(addr + sizeof(float), calibrationGains[sensorIndex]);
+  // pH标准液的标称值对应当前温度，换算到参考温度后存入
+  if (sensorIndex == 3) {
+    knownValue = toFloat(PH_NEUTRAL) + (knownValue - toFloat(PH_NEUTRAL)) / toFloat(phTemperatureFactor);
+  }
   
+  calibrationTables[sensorIndex].addPoint(static_cast<uint16_t>(rawValue + 0.5f), knownValue);
+  calibrationTables[sensorIndex].save(calibrationAddress(sensorIndex));
+#if EMERGENCY_FAST_PATH
+  if (sensorIndex == EMERGENCY_CHANNEL) updateEmergencyThresholds();
+#endif
   return true;
 }
 
+void SensorManager::clearCalibration(uint8_t sensorIndex) {
+  if (sensorIndex >= 5) return;
+  
+  calibrationTables[sensorIndex].clear();
+  calibrationTables[sensorIndex].save(calibrationAddress(sensorIndex));
+#if EMERGENCY_FAST_PATH
+  if (sensorIndex == EMERGENCY_CHANNEL) updateEmergencyThresholds();
+#endif
+}
+
 bool SensorManager::isSensorFaulty(uint8_t sensorIndex) const {
   if (sensorIndex >= 5) return false;
   return persistentFaults[sensorIndex];
@@ -248,34 +598,140 @@ bool SensorManager::isSensorFaulty(uint8_t sensorIndex) const {
 
 float SensorManager::getSensorHealth(uint8_t sensorIndex) const {
   if (sensorIndex >= 5) return 0.0f;
-  return dataStability[sensorIndex];
+  return toFloat(dataStability[sensorIndex]);
 }
 
+uint16_t SensorManager::getSpikeCount(uint8_t sensorIndex) const {
+  if (sensorIndex >= 5) return 0;
+  return spikeCount[sensorIndex];
+}
+
+#if SENSOR_SPECTRUM_ANALYSIS
+const SpectrumFeatures& SensorManager::getSpectrum(uint8_t sensorIndex) const {
+  return spectrum.getFeatures(sensorIndex);
+}
+#endif
+
 float SensorManager::getHistoricalAverage(uint8_t sensorType, size_t samples) const {
-  // 简化实现
-  return 0.0f;
+  switch (sensorType) {
+    case 0: return flowBuffer.getAverage(samples);
+    case 1: return pollutionBuffer.getAverage(samples);
+    case 2: return lightBuffer.getAverage(samples);
+    case 3: return pHBuffer.getAverage(samples);
+    case 4: return temperatureBuffer.getAverage(samples);
+    default: return 0.0f;
+  }
 }
 
 float SensorManager::getHistoricalTrend(uint8_t sensorType, size_t samples) const {
-  // 简化实现
-  return 0.0f;
+  switch (sensorType) {
+    case 0: return flowBuffer.getTrend(samples);
+    case 1: return pollutionBuffer.getTrend(samples);
+    case 2: return lightBuffer.getTrend(samples);
+    case 3: return pHBuffer.getTrend(samples);
+    case 4: return temperatureBuffer.getTrend(samples);
+    default: return 0.0f;
+  }
 }
 
 void SensorManager::resetSensor(uint8_t sensorIndex) {
   if (sensorIndex >= 5) return;
   
-  calibrationOffsets[sensorIndex] = 0.0f;
-  calibrationGains[sensorIndex] = 1.0f;
-  previousReadings[sensorIndex] = 0.0f;
-  faultStartTime[sensorIndex] = 0;
-  persistentFaults[sensorIndex] = false;
-  dataStability[sensorIndex] = 1.0f;
-  dataVariance[sensorIndex] = 0.0f;
+  calibrationOffsets[sensorIndex] = VALUE_ZERO;
+  calibrationGains[sensorIndex] = VALUE_ONE;
+  resetChannelState(sensorIndex);
+#if EMERGENCY_FAST_PATH
+  if (sensorIndex == EMERGENCY_CHANNEL) updateEmergencyThresholds();
+#endif
 }
 
 void SensorManager::setCalibration(uint8_t sensorIndex, float offset, float gain) {
   if (sensorIndex >= 5) return;
   
-  calibrationOffsets[sensorIndex] = offset;
-  calibrationGains[sensorIndex] = gain;
-}
\ No newline at end of file
+  calibrationOffsets[sensorIndex] = SensorValue(offset);
+  calibrationGains[sensorIndex] = SensorValue(gain);
+#if EMERGENCY_FAST_PATH
+  if (sensorIndex == EMERGENCY_CHANNEL) updateEmergencyThresholds();
+#endif
+}
+
+bool SensorManager::correctDrift(uint8_t sensorIndex, float offset, float gain, float operatingPoint) {
+  if (sensorIndex >= 5 || gain <= 0.0f) return false;
+  
+  // 工作点附近的换算斜率 s（物理单位/原始计数）
+  uint16_t center = physicalToRaw(sensorIndex, operatingPoint);
+  uint16_t low = center > DRIFT_SLOPE_SPAN ? center - DRIFT_SLOPE_SPAN : 0;
+  uint16_t high = center + DRIFT_SLOPE_SPAN < 1023 ? center + DRIFT_SLOPE_SPAN : 1023;
+  if (high <= low) return false;
+  float physicalLow = toFloat(convertToPhysical(sensorIndex, SensorValue(static_cast<float>(low))));
+  float physicalHigh = toFloat(convertToPhysical(sensorIndex, SensorValue(static_cast<float>(high))));
+  float currentGain = toFloat(calibrationGains[sensorIndex]);
+  float currentOffset = toFloat(calibrationOffsets[sensorIndex]);
+  float slope = (physicalHigh - physicalLow) / ((high - low) * currentGain);  // 对查表输入的斜率
+  if (slope <= 0.0f) return false;
+  
+  // 查表输入 u = g·x + o，在工作点 u0 附近表近似为 P0 + s·(u - u0)
+  // 要求修正后 表(u') = (表(u) - offset) / gain，解得
+  //   g' = g / gain，o' = u0 + (o - u0) / gain + (P0·(1 - gain) - offset) / (gain·s)
+  float center0 = currentGain * center + currentOffset;
+  float physical0 = toFloat(convertToPhysical(sensorIndex, SensorValue(static_cast<float>(center))));
+  float newGain = currentGain / gain;
+  float newOffset = center0 + (currentOffset - center0) / gain +
+                    (physical0 * (1.0f - gain) - offset) / (gain * slope);
+  if (fabs(newOffset) > 1023.0f) return false;
+  
+  setCalibration(sensorIndex, newOffset, newGain);
+  saveCalibration(sensorIndex);
+  return true;
+}
+
+void SensorManager::saveCalibration(uint8_t sensorIndex) {
+  int addr = sensorIndex * sizeof(float) * 2;
+  EEPROM.put(addr, toFloat(calibrationOffsets[sensorIndex]));
+  EEPROM.put(addr + sizeof(float), toFloat(calibrationGains[sensorIndex]));
+}
+
+uint16_t SensorManager::physicalToRaw(uint8_t sensorIndex, float value) {
+  // 在 [0, 1024) 中查找换算结果不小于 value 的最小原始值，找不到时返回1024
+  uint16_t low = 0;
+  uint16_t high = RAW_UNREACHABLE;
+  while (low < high) {
+    uint16_t mid = (low + high) / 2;
+    float physical = toFloat(convertToPhysical(sensorIndex, SensorValue(static_cast<float>(mid))));
+    if (physical >= value) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return low;
+}
+
+#if EMERGENCY_FAST_PATH
+EmergencyWatchdog& SensorManager::getEmergencyWatchdog() {
+  return sensorSource.getWatchdog();
+}
+
+uint16_t SensorManager::getEmergencyTripRaw() const {
+  return emergencyTripRaw;
+}
+
+uint16_t SensorManager::getEmergencyClearRaw() const {
+  return emergencyClearRaw;
+}
+
+void SensorManager::updateEmergencyThresholds() {
+  emergencyTripRaw = physicalToRaw(EMERGENCY_CHANNEL, EMERGENCY_TRIP_LEVEL);
+  emergencyClearRaw = physicalToRaw(EMERGENCY_CHANNEL, EMERGENCY_CLEAR_LEVEL);
+  
+  // 两个阈值之间的平均斜率把速率换算为原始计数/秒
+  float countsPerUnit = (emergencyTripRaw > emergencyClearRaw && emergencyTripRaw < RAW_UNREACHABLE) ?
+                        (emergencyTripRaw - emergencyClearRaw) / (EMERGENCY_TRIP_LEVEL - EMERGENCY_CLEAR_LEVEL) :
+                        1023.0f / (PHYSICAL_MAX[EMERGENCY_CHANNEL] - PHYSICAL_MIN[EMERGENCY_CHANNEL]);
+  float slope = EMERGENCY_TRIP_SLOPE * countsPerUnit;
+  uint16_t slopeRaw = static_cast<uint16_t>(constrain(slope + 0.5f, 1.0f, 1023.0f));
+  
+  sensorSource.getWatchdog().configure(EMERGENCY_CHANNEL, emergencyTripRaw, emergencyClearRaw, slopeRaw,
+                                       EMERGENCY_SLOPE_WINDOW, EMERGENCY_CLEAR_TIME, EMERGENCY_CONFIRM_SAMPLES);
+}
+#endif
\ No newline at end of file
@@ -5,27 +5,74 @@
 #include "../Core/CommonTypes.h"
 #include "../Core/SystemConfig.h"
 #include "../Utilities/CircularBuffer.h"
+#include "../Utilities/SortingNetwork.h"
+#include "SensorSource.h"
+#include "Calibration.h"
+#include "SpectrumAnalyzer.h"
 
 class SensorManager {
 private:
-  // 传感器数据缓冲区
-  CircularBuffer<float, FLOW_BUFFER_SIZE> flowBuffer;
-  CircularBuffer<float, POLLUTION_BUFFER_SIZE> pollutionBuffer;
-  CircularBuffer<float, LIGHT_BUFFER_SIZE> lightBuffer;
-  CircularBuffer<float, PH_BUFFER_SIZE> pHBuffer;
+  // 传感器数据源（默认为后台ADC采样引擎）
+  SensorSource sensorSource;
+  
+  // 传感器历史数据（滑动窗口，平均值与趋势查询为O(1)）
+  HistoryBuffer<FLOW_BUFFER_SIZE> flowBuffer;
+  HistoryBuffer<POLLUTION_BUFFER_SIZE> pollutionBuffer;
+  HistoryBuffer<LIGHT_BUFFER_SIZE> lightBuffer;
+  HistoryBuffer<PH_BUFFER_SIZE> pHBuffer;
+  HistoryBuffer<TEMP_BUFFER_SIZE> temperatureBuffer;
   
   // 传感器校准参数
-  float calibrationOffsets[5];
-  float calibrationGains[5];
+  // 偏移/增益为原始值上的线性修正，修正后的原始值经校准表换算为物理量
+  SensorValue calibrationOffsets[5];
+  SensorValue calibrationGains[5];
+  CalibrationTable calibrationTables[5];
+  
+  // pH温度补偿系数（随温度通道更新）
+  SensorScale phTemperatureFactor;
   
   // 传感器故障检测
-  float previousReadings[5];
+  SensorValue previousReadings[5];
   unsigned long faultStartTime[5];
   bool persistentFaults[5];
   
   // 数据质量
-  float dataStability[5];
-  float dataVariance[5];
+  SensorValue dataStability[5];
+  SensorValue dataVariance[5];
+  
+  // Hampel毛刺剔除窗口（原始读数）
+  SensorValue hampelWindow[5][HAMPEL_WINDOW_SIZE];
+  uint8_t hampelIndex[5];
+  uint8_t hampelCount[5];
+  uint16_t spikeCount[5];
+
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 噪声与脉动的频谱分析（原始读数，低通滤波之前）
+  SpectrumAnalyzer spectrum;
+#endif
+  
+  // 低通滤波器状态（每通道）
+  SensorValue filteredValues[5];
+  bool filterInitialized[5];
+  
+  // 稳定性滑动窗口（均值与方差为O(1)增量统计）
+  StatisticalBuffer<SensorValue, STABILITY_WINDOW_SIZE, true> stabilityWindow[5];
+  
+  // 每通道采样调度
+  unsigned long samplePeriods[5];
+  uint16_t oversampleCounts[5];
+  uint8_t decimationBits[5];
+  unsigned long minPeriods[5];
+  unsigned long maxPeriods[5];
+  uint8_t quietSamples[5];              // 连续平稳样本数
+  CircularBuffer<SampleRateEvent, SAMPLE_RATE_EVENT_QUEUE> rateEvents;
+  unsigned long lastRequestTime[5];
+  unsigned long lastUpdateTime[5];
+  uint32_t lastBatchSequence[5];
+  unsigned long lastWatchTime;
+  
+  // 最新数据（各通道按各自周期更新）
+  SensorData latestData;
   
 public:
   SensorManager();
@@ -33,22 +80,67 @@ public:
   // 初始化传感器
   bool initialize();
   
-  // 读取传感器数据
+  // 采样调度：主循环每次调用，为到期通道申请ADC转换并处理已完成的通道
+  // 返回本次是否有通道更新
+  bool update();
+  
+  // 读取传感器数据（最新快照，附带各通道数据时龄）
   SensorData readAllSensors();
   
-  // 校准传感器
+  // 数据源（回放文件、合成参数等在 initialize() 之前配置）
+  SensorSource& getSource();
+  
+  // 通道采样周期与过采样次数（周期变化时产生采样周期事件）
+  void setSampleSchedule(uint8_t sensorIndex, unsigned long periodMs, uint16_t oversample);
+  unsigned long getSamplePeriod(uint8_t sensorIndex) const;
+  
+  // 自适应采样周期的范围
+  void setSamplePeriodRange(uint8_t sensorIndex, unsigned long minPeriod, unsigned long maxPeriod);
+  
+  // 取出一个采样周期变化事件，没有待处理事件时返回 false
+  // 队列满时丢弃最早的事件
+  bool pollSampleRateEvent(SampleRateEvent& event);
+  
+  // 过采样抽取：额外分辨率位数 (0-4)，非0时每批转换 4^bits 次
+  void setDecimation(uint8_t sensorIndex, uint8_t bits);
+  uint8_t getResolutionBits(uint8_t sensorIndex) const;
+  
+  // 最近一批转换从申请到完成的耗时 (us)
+  uint32_t getConversionTime(uint8_t sensorIndex) const;
+  
+  // 校准传感器：以当前读数和已知值添加一个校准点并保存到EEPROM
+  // pH的已知值为当前温度下的标称值
   bool calibrateSensor(uint8_t sensorIndex, float knownValue);
+  void clearCalibration(uint8_t sensorIndex);
   void setCalibration(uint8_t sensorIndex, float offset, float gain);
+
+  // 漂移修正：测量值 ≈ offset + gain·真值（物理单位），在工作点附近换算为
+  // 原始值的偏移/增益并保存，换算表须随原始值单调递增
+  bool correctDrift(uint8_t sensorIndex, float offset, float gain, float operatingPoint);
+
+#if EMERGENCY_FAST_PATH
+  // 紧急监视：阈值换算后的原始值（校准改变时自动更新）
+  EmergencyWatchdog& getEmergencyWatchdog();
+  uint16_t getEmergencyTripRaw() const;
+  uint16_t getEmergencyClearRaw() const;
+#endif
   
   // 传感器故障检测
-  bool detectFault(uint8_t sensorIndex, float rawValue);
+  bool detectFault(uint8_t sensorIndex, SensorValue rawValue);
   bool isSensorFaulty(uint8_t sensorIndex) const;
   float getSensorHealth(uint8_t sensorIndex) const;
+  uint16_t getSpikeCount(uint8_t sensorIndex) const;
   
+#if SENSOR_SPECTRUM_ANALYSIS
+  // 最近一帧的频谱特征（主频、噪声能量等）
+  const SpectrumFeatures& getSpectrum(uint8_t sensorIndex) const;
+#endif
+
   // 数据质量评估
-  float calculateDataQuality(uint8_t sensorIndex, float rawValue, bool isFaulty);
+  float calculateDataQuality(uint8_t sensorIndex, SensorValue rawValue, bool isFaulty);
   
-  // 获取历史数据
+  // 获取历史数据：最近 samples 个采样的平均值与每个采样周期的变化趋势
+  // samples 为0或超过已有数据时使用全部历史
   float getHistoricalAverage(uint8_t sensorType, size_t samples) const;
   float getHistoricalTrend(uint8_t sensorType, size_t samples) const;
   
@@ -56,17 +148,49 @@ public:
   void resetSensor(uint8_t sensorIndex);
   
 private:
-  // 读取单个传感器
-  float readSensorRaw(uint8_t sensorPin);
+  // 读取单个传感器（后台采样快照的平均值）
+  SensorValue readSensorRaw(uint8_t sensorIndex);
+  
+  // 处理单个通道的新数据（滤波、换算、故障与质量评估）
+  void processChannel(uint8_t sensorIndex, SensorValue rawValue);
+  
+  // 写入通道物理量及历史缓冲区
+  void storeChannelValue(uint8_t sensorIndex, float value);
   
   // 转换原始数据到物理量
-  float convertToPhysical(uint8_t sensorIndex, float rawValue);
+  SensorValue convertToPhysical(uint8_t sensorIndex, SensorValue rawValue);
+  
+  // 由温度更新pH补偿系数
+  void updateTemperatureCompensation(float temperature);
   
   // 更新数据稳定性
-  void updateStability(uint8_t sensorIndex, float currentValue);
+  void updateStability(uint8_t sensorIndex, SensorValue currentValue);
+  
+  // 按窗口离散度与最新样本的偏离程度调整采样周期
+  void adaptSamplePeriod(uint8_t sensorIndex, SensorValue currentValue);
+  void changeSamplePeriod(uint8_t sensorIndex, unsigned long periodMs);
+  
+  // Hampel滤波：孤立毛刺以窗口中值替代，不进入故障检测
+  SensorValue rejectSpike(uint8_t sensorIndex, SensorValue rawValue);
   
   // 应用数字滤波
-  float applyFilter(uint8_t sensorIndex, float rawValue);
+  SensorValue applyFilter(uint8_t sensorIndex, SensorValue rawValue);
+  
+  // 清除单个通道的运行时状态（滤波、稳定性、故障）
+  void resetChannelState(uint8_t sensorIndex);
+
+  // 物理量对应的最小原始值（二分查找，换算须随原始值单调递增）
+  uint16_t physicalToRaw(uint8_t sensorIndex, float value);
+  
+  // 偏移/增益写入EEPROM（与 initialize() 读取的位置相同）
+  void saveCalibration(uint8_t sensorIndex);
+
+#if EMERGENCY_FAST_PATH
+  // 按当前校准配置紧急监视的阈值
+  void updateEmergencyThresholds();
+  uint16_t emergencyTripRaw;
+  uint16_t emergencyClearRaw;
+#endif
 };
 
 #endif // SENSOR_MANAGER_H
\ No newline at end of file
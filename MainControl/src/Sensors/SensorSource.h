@@ -0,0 +1,26 @@
+#ifndef SENSOR_SOURCE_H
+#define SENSOR_SOURCE_H
+
+#include "../Core/SystemConfig.h"
+
+// 传感器数据源（由 SENSOR_SOURCE 在编译期选择，不使用虚函数）
+// 各数据源提供相同的接口：begin/stop/request/isBusy/snapshot/getRecentSamples/clear
+//   SENSOR_SOURCE_ADC       - 中断驱动的板载ADC采样
+//   SENSOR_SOURCE_TRACE     - 回放记录的原始数据（CSV或二进制）
+//   SENSOR_SOURCE_SYNTHETIC - 带漂移、噪声和毛刺的可复现合成数据
+// 后两者不依赖ADC硬件，主机测试（test/SensorPipelineTest.cpp）以仿真时钟
+// 快于实时地运行 SensorManager → SensorFusion 整条处理链。
+#if SENSOR_SOURCE == SENSOR_SOURCE_TRACE
+#include "SoftwareSampler.h"
+#include "TraceSignal.h"
+typedef SoftwareSampler<TraceSignal> SensorSource;
+#elif SENSOR_SOURCE == SENSOR_SOURCE_SYNTHETIC
+#include "SoftwareSampler.h"
+#include "SyntheticSignal.h"
+typedef SoftwareSampler<SyntheticSignal> SensorSource;
+#else
+#include "AdcSampler.h"
+typedef AdcSampler SensorSource;
+#endif
+
+#endif // SENSOR_SOURCE_H
\ No newline at end of file
@@ -0,0 +1,149 @@
+#ifndef SOFTWARE_SAMPLER_H
+#define SOFTWARE_SAMPLER_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+#include "AdcSampler.h"
+#include "CaptureBuffer.h"
+#include "EmergencyWatchdog.h"
+
+// 软件数据源采样器
+// 接口与 AdcSampler 相同，样本由 Signal 产生而不是ADC：
+// request() 时同步生成整批样本并立即锁存结果，不使用中断；突发采集同样一次生成。
+// 批次中的每个样本及 requestWatch() 的单次样本都经过紧急监视检查。
+// Signal 需提供 bool begin() 与 uint16_t sample(uint8_t channel, unsigned long timeMs)，
+// 返回 0-1023 的原始值。时间取自 millis()，主机测试（test/）中为仿真时钟，可快于实时运行。
+template<typename Signal>
+class SoftwareSampler {
+private:
+  Signal signal;
+  
+  // 最近原始样本环形缓冲区
+  uint16_t samples[SENSOR_COUNT][ADC_RECENT_SAMPLES];
+  uint8_t sampleIndex[SENSOR_COUNT];
+  
+  // 最近完成的批次
+  AdcSnapshot results[SENSOR_COUNT];
+  
+  CaptureBuffer capture;
+  EmergencyWatchdog watchdog;
+  
+  uint8_t currentChannel;
+  bool running;
+  
+public:
+  SoftwareSampler() : currentChannel(0), running(false) {
+    clear();
+  }
+  
+  // 数据源配置（种子、回放文件等）
+  Signal& getSignal() { return signal; }
+  
+  bool begin() {
+    running = signal.begin();
+    return running;
+  }
+  
+  void stop() { running = false; }
+  bool isRunning() const { return running; }
+  
+  // 同步生成一批样本
+  void request(uint8_t channel, uint16_t sampleCount) {
+    if (!running || channel >= SENSOR_COUNT || sampleCount == 0) return;
+    
+    unsigned long now = millis();
+    unsigned long start = micros();
+    uint32_t sum = 0;
+    uint8_t idx = sampleIndex[channel];
+    for (uint16_t i = 0; i < sampleCount; i++) {
+      uint16_t value = signal.sample(channel, now);
+      watchdog.check(channel, value, micros());
+      sum += value;
+      samples[channel][idx] = value;
+      idx = (idx + 1 < ADC_RECENT_SAMPLES) ? idx + 1 : 0;
+    }
+    sampleIndex[channel] = idx;
+    
+    currentChannel = channel;
+    results[channel].sum = sum;
+    results[channel].count = sampleCount;
+    results[channel].sequence++;
+    results[channel].conversions += sampleCount;
+    results[channel].batchMicros = micros() - start;
+  }
+  
+  bool isBusy() const { return false; }
+  
+  bool snapshot(uint8_t channel, AdcSnapshot& out) const {
+    if (channel >= SENSOR_COUNT) return false;
+    out = results[channel];
+    return out.count > 0;
+  }
+  
+  float getAverage(uint8_t channel) const {
+    AdcSnapshot snap;
+    if (!snapshot(channel, snap)) return 0.0f;
+    return static_cast<float>(snap.sum) / snap.count;
+  }
+  
+  // 从最新样本向前复制
+  uint8_t getRecentSamples(uint8_t channel, uint16_t* out, uint8_t maxCount) const {
+    if (channel >= SENSOR_COUNT || out == nullptr) return 0;
+    
+    uint8_t n = maxCount < ADC_RECENT_SAMPLES ? maxCount : ADC_RECENT_SAMPLES;
+    if (results[channel].conversions < n) {
+      n = static_cast<uint8_t>(results[channel].conversions);
+    }
+    
+    uint8_t idx = sampleIndex[channel];
+    for (uint8_t i = 0; i < n; i++) {
+      idx = (idx == 0) ? ADC_RECENT_SAMPLES - 1 : idx - 1;
+      out[i] = samples[channel][idx];
+    }
+    return n;
+  }
+  
+  uint8_t getCurrentChannel() const { return currentChannel; }
+  
+  // 突发采集：按采样率推算各样本的时刻，同步生成全部样本
+  bool startCapture(uint8_t channel, uint16_t rateHz, uint16_t samples) {
+    if (!running || !capture.start(channel, rateHz, samples)) return false;
+    
+    unsigned long startMs = millis();
+    unsigned long startUs = micros();
+    unsigned long interval = 1000000UL / rateHz;
+    for (uint16_t i = 0; capture.isRunning(); i++) {
+      unsigned long offset = i * interval;
+      capture.store(signal.sample(channel, startMs + offset / 1000), startUs + offset);
+    }
+    return true;
+  }
+  
+  void stopCapture() { capture.cancel(); }
+  const CaptureBuffer& getCapture() const { return capture; }
+  
+  EmergencyWatchdog& getWatchdog() { return watchdog; }
+  
+  // 被监视通道的单次样本，只用于阈值检查
+  void requestWatch() {
+    if (!running || !watchdog.isEnabled()) return;
+    uint8_t channel = watchdog.getChannel();
+    watchdog.check(channel, signal.sample(channel, millis()), micros());
+  }
+  
+  void clear() {
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      for (uint8_t j = 0; j < ADC_RECENT_SAMPLES; j++) {
+        samples[i][j] = 0;
+      }
+      sampleIndex[i] = 0;
+      results[i].sum = 0;
+      results[i].count = 0;
+      results[i].sequence = 0;
+      results[i].conversions = 0;
+      results[i].batchMicros = 0;
+    }
+  }
+};
+
+#endif // SOFTWARE_SAMPLER_H
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include "SpectrumAnalyzer.h"
+
+static const float SAMPLE_UNITS = 32.0f;            // 每ADC计数的样本单位（Q5）
+static const int32_t FRAME_HEADROOM = 0x3FFF;       // 块浮点放大后的最大幅值
+static const float HANN_POWER_GAIN = 0.375f;        // Hann窗的均方增益
+static const float PERIODIC_PEAK_RATIO = 0.6f;      // 主频占比达到此值视为周期性波动
+static const uint8_t PERIODIC_MIN_BIN = 3;          // 每帧至少3个周期，更慢的波动归为漂移
+static const float DRIFT_RATIO = 0.6f;              // 最低两个频点占比达到此值视为漂移
+static const float NOISE_RATIO = 0.35f;             // 高频段占比达到此值视为宽带噪声（白噪声约0.5）
+
+// 读数换算为样本单位（1/32 ADC计数）
+static int16_t toSampleUnits(SensorValue value) {
+#if SENSOR_FIXED_POINT
+  int32_t units = (value.raw() + (1L << 10)) >> 11;
+#else
+  int32_t units = static_cast<int32_t>(value * SAMPLE_UNITS + 0.5f);
+#endif
+  return static_cast<int16_t>(constrain(units, 0L, 32767L));
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer()
+  : activeChannel(IDLE),
+    activeShift(0),
+    activePeriod(0),
+    nextChannel(0) {
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    reset(i);
+  }
+}
+
+void SpectrumAnalyzer::reset(uint8_t channel) {
+  if (channel >= SENSOR_COUNT) return;
+  
+  writeIndex[channel] = 0;
+  newSamples[channel] = 0;
+  framePeriod[channel] = 0;
+  
+  // 放弃该通道正在进行的变换
+  if (activeChannel == channel) {
+    activeChannel = IDLE;
+  }
+  
+  SpectrumFeatures& f = features[channel];
+  f.type = SPECTRUM_UNKNOWN;
+  f.dominantBin = 0;
+  f.dominantFrequency = 0.0f;
+  f.peakRatio = 0.0f;
+  f.noiseRatio = 0.0f;
+  f.driftRatio = 0.0f;
+  f.acRms = 0.0f;
+  f.noiseRms = 0.0f;
+  f.qualityFactor = SensorValue(1.0f);
+  f.timestamp = 0;
+}
+
+void SpectrumAnalyzer::addSample(uint8_t channel, SensorValue value, unsigned long periodMs) {
+  if (channel >= SENSOR_COUNT) return;
+  
+  // 采样周期改变：已缓存的样本按新周期重采样，帧继续攒满而不是重新开始
+  if (periodMs != framePeriod[channel]) {
+    if (framePeriod[channel] > 0 && periodMs > 0) {
+      resample(channel, framePeriod[channel], periodMs);
+    }
+    framePeriod[channel] = periodMs;
+  }
+  
+  samples[channel][writeIndex[channel]] = toSampleUnits(value);
+  writeIndex[channel] = (writeIndex[channel] + 1) & (FFT_SIZE - 1);
+  if (newSamples[channel] < FFT_SIZE) {
+    newSamples[channel]++;
+  }
+}
+
+void SpectrumAnalyzer::resample(uint8_t channel, unsigned long fromPeriod, unsigned long toPeriod) {
+  uint16_t count = newSamples[channel];
+  if (count < 2) return;
+  
+  // 以最新样本为终点：新样本 j（从新到旧）位于旧样本序列的 j·to/from 处，线性插值
+  int16_t* buffer = samples[channel];
+  uint16_t newest = (writeIndex[channel] - 1) & (FFT_SIZE - 1);
+  uint32_t span = static_cast<uint32_t>(count - 1) * fromPeriod;
+  uint16_t resampled = static_cast<uint16_t>(min(span / toPeriod + 1, static_cast<uint32_t>(FFT_SIZE)));
+  
+  // 原地计算：周期变长时读取的位置不比写入的新，按从新到旧的顺序；
+  // 周期变短时读取的位置不比写入的旧，按从旧到新的顺序。两种顺序都不会读到已改写的样本
+  bool longer = toPeriod >= fromPeriod;
+  for (uint16_t n = 0; n < resampled; n++) {
+    uint16_t j = longer ? n : resampled - 1 - n;
+    uint32_t position = static_cast<uint32_t>(j) * toPeriod;
+    uint16_t age = static_cast<uint16_t>(position / fromPeriod);
+    uint32_t fraction = position % fromPeriod;
+    int32_t value = buffer[(newest - age) & (FFT_SIZE - 1)];
+    if (fraction > 0) {
+      int32_t older = buffer[(newest - age - 1) & (FFT_SIZE - 1)];
+      value += static_cast<int32_t>((older - value) * static_cast<int32_t>(fraction) / static_cast<int32_t>(fromPeriod));
+    }
+    buffer[(newest - j) & (FFT_SIZE - 1)] = static_cast<int16_t>(value);
+  }
+  newSamples[channel] = resampled;
+}
+
+void SpectrumAnalyzer::update() {
+  if (activeChannel == IDLE) {
+    // 从上次的下一个通道开始查找攒满的帧，避免采样快的通道独占
+    for (uint8_t n = 0; n < SENSOR_COUNT; n++) {
+      uint8_t channel = (nextChannel + n) % SENSOR_COUNT;
+      if (newSamples[channel] >= FFT_SIZE) {
+        nextChannel = (channel + 1) % SENSOR_COUNT;
+        loadFrame(channel);
+        break;
+      }
+    }
+    return;
+  }
+  
+  if (fft.step(SPECTRUM_BUTTERFLIES_PER_PASS)) {
+    extractFeatures();
+    activeChannel = IDLE;
+  }
+}
+
+const SpectrumFeatures& SpectrumAnalyzer::getFeatures(uint8_t channel) const {
+  return features[channel < SENSOR_COUNT ? channel : 0];
+}
+
+bool SpectrumAnalyzer::isNoisy(uint8_t channel) const {
+  if (channel >= SENSOR_COUNT) return false;
+  return features[channel].type != SPECTRUM_UNKNOWN && features[channel].noiseRms > SPECTRUM_FAULT_NOISE;
+}
+
+void SpectrumAnalyzer::loadFrame(uint8_t channel) {
+  const int16_t* buffer = samples[channel];
+  uint16_t oldest = writeIndex[channel];
+  
+  int32_t sum = 0;
+  for (uint16_t n = 0; n < FFT_SIZE; n++) {
+    sum += buffer[n];
+  }
+  int16_t mean = static_cast<int16_t>((sum + FFT_SIZE / 2) / FFT_SIZE);
+  
+  // 去均值并加Hann窗，按时间顺序写入变换缓冲区
+  int32_t peak = 0;
+  for (uint16_t n = 0; n < FFT_SIZE; n++) {
+    int32_t x = buffer[(oldest + n) & (FFT_SIZE - 1)] - mean;
+    int32_t window = (32767L - fftCosine(static_cast<uint8_t>(n * (FFT_TABLE_POINTS / FFT_SIZE)))) >> 1;
+    int16_t value = static_cast<int16_t>((x * window + (1L << 14)) >> 15);
+    fft.re[n] = value;
+    int32_t magnitude = value < 0 ? -static_cast<int32_t>(value) : value;
+    if (magnitude > peak) peak = magnitude;
+  }
+  
+  // 块浮点：小信号放大到接近满量程，各级右移后仍保留足够的有效位数
+  uint8_t shift = 0;
+  while (peak > 0 && (peak << (shift + 1)) <= FRAME_HEADROOM) {
+    shift++;
+  }
+  for (uint16_t n = 0; n < FFT_SIZE; n++) {
+    fft.re[n] = static_cast<int16_t>(fft.re[n] * (1 << shift));
+  }
+  
+  activeChannel = channel;
+  activeShift = shift;
+  activePeriod = framePeriod[channel];
+  newSamples[channel] = 0;
+  fft.begin();
+}
+
+void SpectrumAnalyzer::extractFeatures() {
+  const uint16_t half = FFT_SIZE / 2;
+  
+  // 单边功率谱：1 至 N/2-1 的频点计两次（正负频率），N/2 计一次
+  float total = 0.0f;
+  float noise = 0.0f;
+  float drift = 0.0f;
+  uint16_t dominant = 1;
+  uint32_t dominantPower = 0;
+  for (uint16_t k = 1; k <= half; k++) {
+    uint32_t power = fft.power(k);
+    float energy = (k < half) ? 2.0f * power : static_cast<float>(power);
+    total += energy;
+    if (k >= FFT_SIZE / 4) noise += energy;
+    if (k <= 2) drift += energy;
+    if (power > dominantPower) {
+      dominantPower = power;
+      dominant = k;
+    }
+  }
+  
+  // Hann窗使单一频率分布在相邻的三个频点上
+  float peak = 0.0f;
+  for (uint16_t k = dominant - 1; k <= dominant + 1 && k <= half; k++) {
+    if (k == 0) continue;
+    uint32_t power = fft.power(k);
+    peak += (k < half) ? 2.0f * power : static_cast<float>(power);
+  }
+  
+  // 输出为 DFT/N，由Parseval定理各频点能量之和即为加窗信号的均方值；
+  // 除以窗的均方增益并撤销块浮点放大，换算为ADC计数
+  float unit = 1.0f / (SAMPLE_UNITS * (1UL << activeShift));
+  float inverseTotal = total > 0.0f ? 1.0f / total : 0.0f;
+  
+  SpectrumFeatures& f = features[activeChannel];
+  f.dominantBin = dominantPower > 0 ? dominant : 0;
+  f.dominantFrequency = (activePeriod > 0 && dominantPower > 0) ?
+                        dominant * 1000.0f / (static_cast<float>(FFT_SIZE) * activePeriod) : 0.0f;
+  f.peakRatio = peak * inverseTotal;
+  f.noiseRatio = noise * inverseTotal;
+  f.driftRatio = drift * inverseTotal;
+  f.acRms = sqrt(total / HANN_POWER_GAIN) * unit;
+  f.noiseRms = sqrt(noise / HANN_POWER_GAIN) * unit;
+  f.qualityFactor = SensorValue(1.0f - constrain(f.noiseRms / SPECTRUM_NOISE_LIMIT, 0.0f, 1.0f));
+  f.timestamp = millis();
+  
+  if (f.acRms < SPECTRUM_MIN_RMS) {
+    f.type = SPECTRUM_CLEAN;
+  } else if (f.peakRatio >= PERIODIC_PEAK_RATIO && dominant >= PERIODIC_MIN_BIN) {
+    f.type = SPECTRUM_PERIODIC;
+  } else if (f.driftRatio >= DRIFT_RATIO) {
+    f.type = SPECTRUM_DRIFT;
+  } else if (f.noiseRatio >= NOISE_RATIO) {
+    f.type = SPECTRUM_NOISE;
+  } else {
+    f.type = SPECTRUM_CLEAN;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef SPECTRUM_ANALYZER_H
+#define SPECTRUM_ANALYZER_H
+
+#include <Arduino.h>
+#include "../Core/CommonTypes.h"
+#include "../Core/SystemConfig.h"
+#include "../Utilities/FixedFFT.h"
+
+// 频谱类型
+enum SpectrumType : uint8_t {
+  SPECTRUM_UNKNOWN = 0,   // 尚未完成一帧
+  SPECTRUM_CLEAN,         // 没有明显的波动，或只有缓慢的过程变化
+  SPECTRUM_PERIODIC,      // 单一频率占优（泵脉动等周期性波动）
+  SPECTRUM_NOISE,         // 高频段宽带噪声（工频干扰经采样时刻抖动混叠后也表现为宽带）
+  SPECTRUM_DRIFT          // 能量集中在最低频点（探头漂移）
+};
+
+// 单个通道最近一帧的频谱特征
+struct SpectrumFeatures {
+  SpectrumType type;
+  uint8_t dominantBin;        // 主频频点（不含直流）
+  float dominantFrequency;    // 主频 (Hz)
+  float peakRatio;            // 主频及相邻频点占交流能量的比例
+  float noiseRatio;           // 高频段（N/4 至 N/2）占交流能量的比例
+  float driftRatio;           // 最低两个频点占交流能量的比例
+  float acRms;                // 交流分量有效值（ADC计数）
+  float noiseRms;             // 高频段有效值（ADC计数）
+  SensorValue qualityFactor;  // 数据质量系数：随高频段噪声由1降到0
+  unsigned long timestamp;    // 完成时刻 (ms)
+};
+
+// 传感器噪声与脉动分析
+// 各通道的原始读数（毛刺剔除后、低通滤波前）按采样顺序缓存 N 个，
+// 攒满一帧（不重叠）后去均值、加Hann窗，以定点FFT求频谱。
+// 所有通道共用一个变换缓冲区：update() 每次装载一帧或执行几次蝶形运算，
+// 主循环不因变换而停顿。
+// 帧内采样周期必须相同，周期改变时已缓存的样本按新周期线性插值重采样。
+class SpectrumAnalyzer {
+public:
+  static const uint16_t FFT_SIZE = SPECTRUM_FFT_SIZE;
+  
+private:
+  static const uint8_t IDLE = SENSOR_COUNT;
+  
+  // 每通道最近 N 个样本（1/32 ADC计数，满量程1023计数不超出int16）
+  int16_t samples[SENSOR_COUNT][FFT_SIZE];
+  uint16_t writeIndex[SENSOR_COUNT];
+  uint16_t newSamples[SENSOR_COUNT];    // 上一帧之后的新样本数（按当前采样周期计）
+  unsigned long framePeriod[SENSOR_COUNT];
+  
+  // 共用的变换缓冲区
+  FixedFFT<FFT_SIZE> fft;
+  uint8_t activeChannel;                // 正在变换的通道，IDLE 表示空闲
+  uint8_t activeShift;                  // 输入放大的位数（块浮点指数）
+  unsigned long activePeriod;
+  uint8_t nextChannel;                  // 轮询起点，各通道轮流使用变换缓冲区
+  
+  SpectrumFeatures features[SENSOR_COUNT];
+  
+public:
+  SpectrumAnalyzer();
+  
+  // 清除通道的样本与特征
+  void reset(uint8_t channel);
+  
+  // 记录通道的一个读数（ADC计数）及其采样周期 (ms)
+  void addSample(uint8_t channel, SensorValue value, unsigned long periodMs);
+  
+  // 主循环调用：空闲时装载下一个攒满的帧，否则执行一部分蝶形运算
+  void update();
+  
+  const SpectrumFeatures& getFeatures(uint8_t channel) const;
+  
+  // 高频段噪声超过故障阈值
+  bool isNoisy(uint8_t channel) const;
+  
+private:
+  void resample(uint8_t channel, unsigned long fromPeriod, unsigned long toPeriod);
+  void loadFrame(uint8_t channel);
+  void extractFeatures();
+};
+
+#endif // SPECTRUM_ANALYZER_H
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "SyntheticSignal.h"
+
+// 默认工况：流量50%、污染物约200ppm、中等光照、pH 7、温度25°C
+static const SyntheticChannel DEFAULT_CHANNELS[SENSOR_COUNT] = {
+  // base   drift   swing  period  noise
+  { 512.0f,  0.0f,  60.0f,  300.0f, 4.0f },  // 流量
+  { 410.0f, 20.0f,  80.0f,  900.0f, 3.0f },  // 污染物
+  { 600.0f,  0.0f, 200.0f, 3600.0f, 6.0f },  // 光照
+  { 512.0f, -5.0f,  10.0f, 1800.0f, 2.0f },  // pH
+  { 256.0f,  2.0f,  15.0f, 3600.0f, 1.0f }   // 温度
+};
+
+static const float DEFAULT_SPIKE_PROBABILITY = 0.001f;
+static const float DEFAULT_SPIKE_AMPLITUDE = 300.0f;
+static const float TWO_PI_F = 6.2831853f;
+
+SyntheticSignal::SyntheticSignal(uint32_t seed) : seed(seed), state(seed), startTime(0) {
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    channels[i] = DEFAULT_CHANNELS[i];
+  }
+  setSpikes(DEFAULT_SPIKE_PROBABILITY, DEFAULT_SPIKE_AMPLITUDE);
+}
+
+bool SyntheticSignal::begin() {
+  // xorshift 的状态不能为0
+  state = seed != 0 ? seed : 1;
+  startTime = millis();
+  return true;
+}
+
+void SyntheticSignal::setSeed(uint32_t newSeed) {
+  seed = newSeed;
+  state = seed != 0 ? seed : 1;
+}
+
+void SyntheticSignal::setChannel(uint8_t channel, const SyntheticChannel& params) {
+  if (channel >= SENSOR_COUNT) return;
+  channels[channel] = params;
+}
+
+void SyntheticSignal::setSpikes(float probability, float amplitude) {
+  probability = constrain(probability, 0.0f, 1.0f);
+  spikeThreshold = static_cast<uint16_t>(probability * 65535.0f);
+  spikeAmplitude = amplitude;
+}
+
+uint16_t SyntheticSignal::sample(uint8_t channel, unsigned long timeMs) {
+  if (channel >= SENSOR_COUNT) return 0;
+  
+  const SyntheticChannel& params = channels[channel];
+  float seconds = (timeMs - startTime) * 0.001f;
+  
+  float value = params.base + params.driftPerHour * (seconds / 3600.0f);
+  if (params.periodSeconds > 0.0f) {
+    value += params.swing * sin(TWO_PI_F * seconds / params.periodSeconds);
+  }
+  value += params.noise * gaussianNoise();
+  
+  // 毛刺：随机方向的大幅跳变
+  uint32_t r = nextRandom();
+  if ((r & 0xFFFF) < spikeThreshold) {
+    value += (r & 0x10000UL) ? spikeAmplitude : -spikeAmplitude;
+  }
+  
+  value = constrain(value, 0.0f, 1023.0f);
+  return static_cast<uint16_t>(value + 0.5f);
+}
+
+uint32_t SyntheticSignal::nextRandom() {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+float SyntheticSignal::gaussianNoise() {
+  // 4个[0,1)均匀分布之和的均值为2、方差为1/3
+  float sum = 0.0f;
+  for (uint8_t i = 0; i < 4; i++) {
+    sum += (nextRandom() >> 8) * (1.0f / 16777216.0f);
+  }
+  return (sum - 2.0f) * 1.7320508f;
+}
\ No newline at end of file
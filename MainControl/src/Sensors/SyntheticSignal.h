@@ -0,0 +1,48 @@
+#ifndef SYNTHETIC_SIGNAL_H
+#define SYNTHETIC_SIGNAL_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+
+// 合成信号的通道参数（单位均为ADC计数）
+struct SyntheticChannel {
+  float base;           // 基线
+  float driftPerHour;   // 线性漂移
+  float swing;          // 慢速周期波动幅度
+  float periodSeconds;  // 波动周期
+  float noise;          // 噪声标准差
+};
+
+// 合成传感器信号：基线 + 漂移 + 周期波动 + 噪声 + 随机毛刺
+// 随机数由固定种子的xorshift32产生，相同种子与相同时钟序列下结果可复现
+class SyntheticSignal {
+private:
+  SyntheticChannel channels[SENSOR_COUNT];
+  uint32_t seed;
+  uint32_t state;
+  uint16_t spikeThreshold;   // 每个样本出现毛刺的概率 × 65536
+  float spikeAmplitude;
+  unsigned long startTime;
+  
+public:
+  SyntheticSignal(uint32_t seed = SYNTHETIC_SEED);
+  
+  // 重置随机数序列与时间原点
+  bool begin();
+  
+  // 参数设置
+  void setSeed(uint32_t newSeed);
+  void setChannel(uint8_t channel, const SyntheticChannel& params);
+  void setSpikes(float probability, float amplitude);
+  
+  // 生成一个原始样本 (0-1023)
+  uint16_t sample(uint8_t channel, unsigned long timeMs);
+  
+private:
+  uint32_t nextRandom();
+  
+  // 近似标准正态分布（4个均匀分布之和）
+  float gaussianNoise();
+};
+
+#endif // SYNTHETIC_SIGNAL_H
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "TraceSignal.h"
+#include <stdlib.h>
+
+static const uint8_t TRACE_LINE_LENGTH = 64;
+
+TraceSignal::TraceSignal(const char* path, Format format, bool looping)
+  : path(path),
+    format(format),
+    looping(looping),
+    nextTime(0),
+    hasNext(false),
+    traceOrigin(0),
+    startTime(0),
+    recordCount(0),
+    finished(true) {
+#if !defined(ARDUINO)
+  file = nullptr;
+#endif
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    currentValues[i] = 0;
+    nextValues[i] = 0;
+  }
+}
+
+TraceSignal::~TraceSignal() {
+  closeFile();
+}
+
+void TraceSignal::setTrace(const char* newPath, Format newFormat, bool loop) {
+  closeFile();
+  path = newPath;
+  format = newFormat;
+  looping = loop;
+}
+
+bool TraceSignal::begin() {
+  recordCount = 0;
+  return restart(millis());
+}
+
+uint16_t TraceSignal::sample(uint8_t channel, unsigned long timeMs) {
+  if (channel >= SENSOR_COUNT) return 0;
+  
+  // 推进到不晚于当前回放时间的最后一条记录
+  uint32_t elapsed = timeMs - startTime;
+  while (hasNext && nextTime - traceOrigin <= elapsed) {
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      currentValues[i] = nextValues[i];
+    }
+    hasNext = readRecord(nextTime, nextValues);
+  }
+  
+  // 文件读完：循环时从最后一条记录直接回到第一条
+  if (!hasNext && !finished) {
+    if (!looping || !restart(timeMs)) {
+      finished = true;
+    }
+  }
+  
+  return currentValues[channel];
+}
+
+bool TraceSignal::isFinished() const {
+  return finished;
+}
+
+uint32_t TraceSignal::getRecordCount() const {
+  return recordCount;
+}
+
+bool TraceSignal::openFile() {
+  closeFile();
+  if (path == nullptr) return false;
+
+#if defined(ARDUINO)
+  file = SD.open(path, FILE_READ);
+  return file;
+#else
+  file = fopen(path, format == FORMAT_BINARY ? "rb" : "r");
+  return file != nullptr;
+#endif
+}
+
+void TraceSignal::closeFile() {
+#if defined(ARDUINO)
+  if (file) {
+    file.close();
+  }
+#else
+  if (file != nullptr) {
+    fclose(file);
+    file = nullptr;
+  }
+#endif
+}
+
+int TraceSignal::readByte() {
+#if defined(ARDUINO)
+  return file.read();
+#else
+  return file != nullptr ? fgetc(file) : -1;
+#endif
+}
+
+bool TraceSignal::readRecord(uint32_t& time, uint16_t values[SENSOR_COUNT]) {
+  bool ok = (format == FORMAT_BINARY) ? readBinaryRecord(time, values) : readCsvRecord(time, values);
+  if (ok) {
+    recordCount++;
+  }
+  return ok;
+}
+
+bool TraceSignal::readCsvRecord(uint32_t& time, uint16_t values[SENSOR_COUNT]) {
+  char line[TRACE_LINE_LENGTH];
+  
+  while (true) {
+    // 读取一行，过长部分丢弃
+    uint8_t length = 0;
+    int c = readByte();
+    if (c < 0) return false;
+    while (c >= 0 && c != '\n') {
+      if (c != '\r' && length < TRACE_LINE_LENGTH - 1) {
+        line[length++] = static_cast<char>(c);
+      }
+      c = readByte();
+    }
+    line[length] = '\0';
+    
+    // 跳过表头、注释与空行
+    if (line[0] < '0' || line[0] > '9') continue;
+    
+    char* cursor = line;
+    char* end;
+    time = strtoul(cursor, &end, 10);
+    bool valid = (end != cursor);
+    for (uint8_t i = 0; i < SENSOR_COUNT && valid; i++) {
+      cursor = end;
+      while (*cursor == ',' || *cursor == ' ') cursor++;
+      unsigned long value = strtoul(cursor, &end, 10);
+      valid = (end != cursor);
+      values[i] = value > 1023 ? 1023 : static_cast<uint16_t>(value);
+    }
+    
+    if (valid) return true;
+  }
+}
+
+bool TraceSignal::readBinaryRecord(uint32_t& time, uint16_t values[SENSOR_COUNT]) {
+  uint8_t bytes[4 + 2 * SENSOR_COUNT];
+  for (uint8_t i = 0; i < sizeof(bytes); i++) {
+    int c = readByte();
+    if (c < 0) return false;
+    bytes[i] = static_cast<uint8_t>(c);
+  }
+  
+  time = static_cast<uint32_t>(bytes[0]) |
+         (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) |
+         (static_cast<uint32_t>(bytes[3]) << 24);
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    uint16_t value = bytes[4 + 2 * i] | (static_cast<uint16_t>(bytes[5 + 2 * i]) << 8);
+    values[i] = value > 1023 ? 1023 : value;
+  }
+  return true;
+}
+
+bool TraceSignal::restart(unsigned long now) {
+  hasNext = false;
+  if (!openFile()) return false;
+  
+  uint32_t firstTime;
+  if (!readRecord(firstTime, currentValues)) {
+    closeFile();
+    return false;
+  }
+  
+  traceOrigin = firstTime;
+  startTime = now;
+  hasNext = readRecord(nextTime, nextValues);
+  finished = false;
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef TRACE_SIGNAL_H
+#define TRACE_SIGNAL_H
+
+#include <Arduino.h>
+#include "../Core/SystemConfig.h"
+
+#if defined(ARDUINO)
+#include <SD.h>
+#else
+#include <stdio.h>
+#endif
+
+// 回放记录的原始ADC数据
+// 每条记录为一个时间戳 (ms) 与5个通道的原始值 (0-1023)，通道顺序同 SENSOR_PIN_LIST。
+// CSV：每行 "t,flow,pollution,light,ph,temp"，非数字开头的行（表头、注释）被跳过。
+// 二进制：小端 uint32 时间戳 + 5个 uint16，每条14字节。
+// 回放时间从 begin() 开始计算，文件读完后保持最后一条记录，或从头循环。
+// 板上从SD卡读取（需事先初始化SD卡），主机端从本地文件读取。
+class TraceSignal {
+public:
+  enum Format : uint8_t {
+    FORMAT_CSV = 0,
+    FORMAT_BINARY
+  };
+  
+private:
+#if defined(ARDUINO)
+  File file;
+#else
+  FILE* file;
+#endif
+  const char* path;
+  Format format;
+  bool looping;
+  
+  // 当前记录与下一条记录
+  uint16_t currentValues[SENSOR_COUNT];
+  uint16_t nextValues[SENSOR_COUNT];
+  uint32_t nextTime;
+  bool hasNext;
+  
+  uint32_t traceOrigin;       // 第一条记录的时间戳
+  unsigned long startTime;    // 回放开始时的 millis()
+  uint32_t recordCount;
+  bool finished;
+  
+public:
+  TraceSignal(const char* path = SENSOR_TRACE_FILE, Format format = FORMAT_CSV, bool looping = false);
+  ~TraceSignal();
+  
+  // 设置回放文件（在 begin() 之前调用）
+  void setTrace(const char* newPath, Format newFormat, bool loop);
+  
+  // 打开文件并读入第一条记录
+  bool begin();
+  
+  // 返回 timeMs 时刻对应记录中的通道值
+  uint16_t sample(uint8_t channel, unsigned long timeMs);
+  
+  bool isFinished() const;
+  uint32_t getRecordCount() const;
+  
+private:
+  bool openFile();
+  void closeFile();
+  int readByte();
+  
+  // 读取下一条记录，文件结束时返回 false
+  bool readRecord(uint32_t& time, uint16_t values[SENSOR_COUNT]);
+  bool readCsvRecord(uint32_t& time, uint16_t values[SENSOR_COUNT]);
+  bool readBinaryRecord(uint32_t& time, uint16_t values[SENSOR_COUNT]);
+  
+  // 从头开始回放
+  bool restart(unsigned long now);
+};
+
+#endif // TRACE_SIGNAL_H
\ No newline at end of file
@@ -1,9 +1,29 @@
 #ifndef CIRCULAR_BUFFER_H
 #define CIRCULAR_BUFFER_H
 
+#include "FixedPoint.h"
+
+// 环形索引回绕：N为2的幂时使用掩码，否则使用比较
+// 两种方式都避免了 % 运算（AVR上为软件除法）
+constexpr bool isPowerOfTwo(size_t n) { return (n & (n - 1)) == 0; }
+
+template<size_t N, bool PowerOfTwo = isPowerOfTwo(N)>
+struct RingIndex {
+  static size_t next(size_t i) { return (i + 1 >= N) ? 0 : i + 1; }
+  static size_t wrap(size_t i) { return (i >= N) ? i - N : i; } // 要求 i < 2N
+};
+
+template<size_t N>
+struct RingIndex<N, true> {
+  static size_t next(size_t i) { return (i + 1) & (N - 1); }
+  static size_t wrap(size_t i) { return i & (N - 1); }
+};
+
 template<typename T, size_t N>
 class CircularBuffer {
 private:
+  typedef RingIndex<N> Index;
+  
   T buffer[N];
   size_t head;
   size_t tail;
@@ -19,7 +39,7 @@ public:
       return false;
     }
     buffer[head] = value;
-    head = (head + 1) % capacity;
+    head = Index::next(head);
     count++;
     return true;
   }
@@ -30,7 +50,7 @@ public:
       return false;
     }
     value = buffer[tail];
-    tail = (tail + 1) % capacity;
+    tail = Index::next(tail);
     count--;
     return true;
   }
@@ -49,7 +69,7 @@ public:
     if (index >= count) {
       return false;
     }
-    size_t actualIndex = (tail + index) % capacity;
+    size_t actualIndex = Index::wrap(tail + index);
     value = buffer[actualIndex];
     return true;
   }
@@ -59,7 +79,7 @@ public:
     if (index >= count) {
       return false;
     }
-    size_t actualIndex = (tail + index) % capacity;
+    size_t actualIndex = Index::wrap(tail + index);
     buffer[actualIndex] = value;
     return true;
   }
@@ -84,9 +104,10 @@ public:
     }
     
     float sum = 0.0f;
+    size_t index = tail;
     for (size_t i = 0; i < count; i++) {
-      size_t index = (tail + i) % capacity;
       sum += buffer[index];
+      index = Index::next(index);
     }
     return sum / count;
   }
@@ -100,14 +121,318 @@ public:
     float mean = getAverage();
     float sumSquaredDiff = 0.0f;
     
+    size_t index = tail;
     for (size_t i = 0; i < count; i++) {
-      size_t index = (tail + i) % capacity;
       float diff = buffer[index] - mean;
       sumSquaredDiff += diff * diff;
+      index = Index::next(index);
     }
     
     return sqrt(sumSquaredDiff / (count - 1));
   }
 };
 
+// 统计量的数值类型：Fix16 数据按定点累加（不引入浮点运算），其余类型使用 float
+// Square 为平方和的类型，spread() 由 Σd² 与 Σd 计算 (Σd² - (Σd)²/n) / divisor
+template<typename T>
+struct StatisticsValue {
+  typedef float Type;
+  typedef float Square;
+  
+  static Square square(Type d) { return d * d; }
+  static Type spread(Square sumSq, Type sum, size_t n, size_t divisor) {
+    return (sumSq - sum * sum / n) / divisor;
+  }
+};
+
+// |d| > 181 时 d² 超出 Q16.16 的范围；平方和以64位整数按 Q32.32 累加，
+// 否则饱和后再减去出窗样本的平方会使平方和偏小，直到下一次重新累加
+template<>
+struct StatisticsValue<Fix16> {
+  typedef Fix16 Type;
+  typedef int64_t Square;
+  
+  static Square square(Fix16 d) { return static_cast<int64_t>(d.raw()) * d.raw(); }
+  static Fix16 spread(Square sumSq, Fix16 sum, size_t n, size_t divisor) {
+    int64_t s = sum.raw();
+    int64_t result = ((sumSq - s * s / static_cast<int64_t>(n)) / static_cast<int64_t>(divisor) +
+                      (Fix16::ONE >> 1)) >> Fix16::FRACTION_BITS;
+    return Fix16::fromRaw(result > 0x7FFFFFFFLL ? 0x7FFFFFFFL : static_cast<int32_t>(result));
+  }
+};
+
+// 带增量统计的环形缓冲区
+// push/pop时维护和与平方和，getAverage()/getStandardDeviation()为O(1)。
+// 为减小浮点抵消误差，累加的是相对参考值的偏移量 (x - reference)，
+// 并每 RESYNC_PERIOD 次更新按当前均值重新计算一次。
+// Overwrite = true 时缓冲区满后覆盖最旧数据（滑动窗口）。
+template<typename T, size_t N, bool Overwrite = false>
+class StatisticalBuffer {
+public:
+  typedef typename StatisticsValue<T>::Type Value;
+  
+private:
+  typedef StatisticsValue<T> Statistics;
+  typedef typename Statistics::Square Square;
+  
+  static const uint16_t RESYNC_PERIOD = 4 * N;
+  
+  CircularBuffer<T, N> data;
+  Value reference;
+  Value shiftedSum;
+  Square shiftedSumSq;
+  uint16_t updatesSinceResync;
+  
+public:
+  StatisticalBuffer() { clear(); }
+  
+  // 添加数据（覆盖模式下满时丢弃最旧数据）
+  bool push(const T& value) {
+    if (data.isFull()) {
+      if (!Overwrite) {
+        return false;
+      }
+      T oldest;
+      pop(oldest);
+    }
+    
+    if (data.isEmpty()) {
+      reference = static_cast<Value>(value);
+      shiftedSum = Value();
+      shiftedSumSq = Square();
+    }
+    
+    data.push(value);
+    Value d = static_cast<Value>(value) - reference;
+    shiftedSum += d;
+    shiftedSumSq += Statistics::square(d);
+    afterUpdate();
+    return true;
+  }
+  
+  // 弹出最旧数据
+  bool pop(T& value) {
+    if (!data.pop(value)) {
+      return false;
+    }
+    Value d = static_cast<Value>(value) - reference;
+    shiftedSum -= d;
+    shiftedSumSq -= Statistics::square(d);
+    afterUpdate();
+    return true;
+  }
+  
+  bool peek(T& value) const { return data.peek(value); }
+  bool get(size_t index, T& value) const { return data.get(index, value); }
+  
+  bool isEmpty() const { return data.isEmpty(); }
+  bool isFull() const { return data.isFull(); }
+  size_t size() const { return data.size(); }
+  size_t getCapacity() const { return data.getCapacity(); }
+  
+  void clear() {
+    data.clear();
+    reference = Value();
+    shiftedSum = Value();
+    shiftedSumSq = Square();
+    updatesSinceResync = 0;
+  }
+  
+  // 总和
+  Value getSum() const {
+    return reference * data.size() + shiftedSum;
+  }
+  
+  // 平均值 O(1)
+  Value getAverage() const {
+    if (data.isEmpty()) {
+      return Value();
+    }
+    return reference + shiftedSum / data.size();
+  }
+  
+  // 样本方差 O(1)
+  Value getVariance() const {
+    size_t n = data.size();
+    if (n < 2) {
+      return Value();
+    }
+    return nonNegative(Statistics::spread(shiftedSumSq, shiftedSum, n, n - 1));
+  }
+  
+  // 总体方差（除以 n）O(1)
+  Value getPopulationVariance() const {
+    size_t n = data.size();
+    if (n < 2) {
+      return Value();
+    }
+    return nonNegative(Statistics::spread(shiftedSumSq, shiftedSum, n, n));
+  }
+  
+  // 标准差 O(1)（只用于 float）
+  float getStandardDeviation() const {
+    return sqrt(getVariance());
+  }
+  
+private:
+  // 抵消误差可能使方差略小于0
+  static Value nonNegative(Value variance) {
+    return variance > Value() ? variance : Value();
+  }
+  
+  // 周期性地以当前均值为参考重新累加，限制浮点误差积累
+  void afterUpdate() {
+    if (data.isEmpty()) {
+      reference = Value();
+      shiftedSum = Value();
+      shiftedSumSq = Square();
+      updatesSinceResync = 0;
+      return;
+    }
+    
+    if (++updatesSinceResync < RESYNC_PERIOD) {
+      return;
+    }
+    updatesSinceResync = 0;
+    
+    reference = getAverage();
+    shiftedSum = Value();
+    shiftedSumSq = Square();
+    T value;
+    for (size_t i = 0; i < data.size(); i++) {
+      data.get(i, value);
+      Value d = static_cast<Value>(value) - reference;
+      shiftedSum += d;
+      shiftedSumSq += Statistics::square(d);
+    }
+  }
+};
+
+// 历史数据缓冲区（满后覆盖最旧数据）
+// 数据与整个窗口的均值、方差由 StatisticalBuffer 维护；
+// 另外维护相对参考值的前缀和 Σd 与 Σk·d（d = y - reference，k 为样本序号），
+// 较短窗口的平均值和最小二乘斜率只需两次前缀和相减，为O(1)。
+// 每 RESYNC_PERIOD 次写入按当前数据重建前缀和，限制序号增长和浮点误差积累。
+template<size_t N>
+class HistoryBuffer {
+private:
+  typedef RingIndex<N + 1> PrefixIndex;
+  static const uint16_t RESYNC_PERIOD = 2 * N;
+  
+  StatisticalBuffer<float, N, true> data;
+  float prefixSum[N + 1];
+  float prefixMoment[N + 1];
+  size_t prefixHead;        // 最新前缀和的位置
+  uint16_t sequence;        // 自上次重建以来的样本序号
+  float reference;
+  
+public:
+  HistoryBuffer() { clear(); }
+  
+  // 添加数据（满时丢弃最旧数据）
+  void push(float value) {
+    if (data.isEmpty()) {
+      reference = value;
+      resetPrefix();
+    }
+    
+    data.push(value);
+    appendPrefix(value - reference);
+    
+    if (sequence >= RESYNC_PERIOD) {
+      rebuild();
+    }
+  }
+  
+  // 按时间顺序读取（0为最旧）
+  bool get(size_t index, float& value) const { return data.get(index, value); }
+  
+  // 按时间倒序读取（0为最新）
+  bool getRecent(size_t age, float& value) const {
+    if (age >= data.size()) {
+      return false;
+    }
+    return data.get(data.size() - 1 - age, value);
+  }
+  
+  bool isEmpty() const { return data.isEmpty(); }
+  bool isFull() const { return data.isFull(); }
+  size_t size() const { return data.size(); }
+  size_t getCapacity() const { return data.getCapacity(); }
+  
+  void clear() {
+    data.clear();
+    reference = 0.0f;
+    resetPrefix();
+  }
+  
+  // 最近 window 个样本的平均值（0或超出现有数据时取全部数据）
+  float getAverage(size_t window = 0) const {
+    window = clampWindow(window);
+    if (window == data.size()) {
+      return data.getAverage();
+    }
+    size_t start = windowStart(window);
+    return reference + (prefixSum[prefixHead] - prefixSum[start]) / window;
+  }
+  
+  // 全部数据的样本方差与标准差
+  float getVariance() const { return data.getVariance(); }
+  float getStandardDeviation() const { return data.getStandardDeviation(); }
+  
+  // 最近 window 个样本的最小二乘斜率（每个样本的变化量）
+  float getTrend(size_t window = 0) const {
+    window = clampWindow(window);
+    if (window < 2) {
+      return 0.0f;
+    }
+    size_t start = windowStart(window);
+    float sumD = prefixSum[prefixHead] - prefixSum[start];
+    float sumKD = prefixMoment[prefixHead] - prefixMoment[start];
+    
+    // 换算到窗口内的局部序号 j = k - (sequence - window)
+    float w = static_cast<float>(window);
+    float sumJD = sumKD - static_cast<float>(sequence - window) * sumD;
+    float sumJ = w * (w - 1.0f) * 0.5f;
+    
+    // 分母 wΣj² - (Σj)² = w²(w²-1)/12
+    return 12.0f * (w * sumJD - sumJ * sumD) / (w * w * (w * w - 1.0f));
+  }
+  
+private:
+  size_t clampWindow(size_t window) const {
+    return (window == 0 || window > data.size()) ? data.size() : window;
+  }
+  
+  size_t windowStart(size_t window) const {
+    return (prefixHead >= window) ? prefixHead - window : prefixHead + (N + 1) - window;
+  }
+  
+  void resetPrefix() {
+    prefixHead = 0;
+    prefixSum[0] = 0.0f;
+    prefixMoment[0] = 0.0f;
+    sequence = 0;
+  }
+  
+  void appendPrefix(float d) {
+    size_t next = PrefixIndex::next(prefixHead);
+    prefixSum[next] = prefixSum[prefixHead] + d;
+    prefixMoment[next] = prefixMoment[prefixHead] + sequence * d;
+    prefixHead = next;
+    sequence++;
+  }
+  
+  // 以当前均值为参考、最旧样本为序号0重新累加
+  void rebuild() {
+    reference = data.getAverage();
+    resetPrefix();
+    float value;
+    for (size_t i = 0; i < data.size(); i++) {
+      data.get(i, value);
+      appendPrefix(value - reference);
+    }
+  }
+};
+
 #endif // CIRCULAR_BUFFER_H
\ No newline at end of file
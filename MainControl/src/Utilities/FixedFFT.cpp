@@ -0,0 +1,23 @@
+#include "FixedFFT.h"
+
+// sin(2π·k/256)，k = 0..64，Q15
+static const int16_t SINE_TABLE[FFT_TABLE_POINTS / 4 + 1] PROGMEM = {
+  0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+  6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+  12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+  18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+  23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+  27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+  30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+  32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+  32767
+};
+
+int16_t fftSine(uint8_t m) {
+  // 由四分之一周期对称得到其余三个象限
+  uint8_t quadrant = m >> 6;
+  uint8_t offset = m & 0x3F;
+  uint8_t index = (quadrant & 1) ? (FFT_TABLE_POINTS / 4 - offset) : offset;
+  int16_t value = static_cast<int16_t>(pgm_read_word(&SINE_TABLE[index]));
+  return (quadrant & 2) ? -value : value;
+}
\ No newline at end of file
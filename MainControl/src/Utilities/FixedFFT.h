@@ -0,0 +1,97 @@
+#ifndef FIXED_FFT_H
+#define FIXED_FFT_H
+
+#include <Arduino.h>
+
+// 正弦表一个周期的点数，FFT点数不超过此值
+#define FFT_TABLE_POINTS 256
+
+// sin(2π·m/256)，Q15（四分之一周期表，存放在程序存储器中）
+int16_t fftSine(uint8_t m);
+inline int16_t fftCosine(uint8_t m) { return fftSine(static_cast<uint8_t>(m + FFT_TABLE_POINTS / 4)); }
+
+// 定点基2时间抽取FFT（Q15，原位计算）
+// 每级蝶形运算的结果右移1位，任何一级都不会溢出，输出为 DFT/N。
+// 小信号应在输入前放大到接近满量程（块浮点），否则有效位数随级数减少。
+// 变换可以分步进行：step() 每次最多执行指定数量的蝶形运算，
+// N 点变换共 (N/2)·log2(N) 次蝶形运算，可分摊到多次主循环中完成。
+template<uint16_t N>
+class FixedFFT {
+  static_assert(N >= 8 && N <= FFT_TABLE_POINTS && (N & (N - 1)) == 0, "FFT size must be a power of two, 8-256");
+  
+public:
+  // 输入与结果（实部、虚部）
+  int16_t re[N];
+  int16_t im[N];
+  
+private:
+  uint16_t span;       // 当前级蝶形运算两个输入的间距，N 表示变换已完成
+  uint16_t butterfly;  // 当前级已完成的蝶形运算数
+  
+public:
+  FixedFFT() : span(N), butterfly(0) {}
+  
+  // 开始变换：re[] 中为实数输入，按位反转顺序重排并清零虚部
+  void begin() {
+    uint16_t j = 0;
+    for (uint16_t i = 0; i < N - 1; i++) {
+      if (i < j) {
+        int16_t t = re[i];
+        re[i] = re[j];
+        re[j] = t;
+      }
+      uint16_t bit = N >> 1;
+      while (j & bit) {
+        j ^= bit;
+        bit >>= 1;
+      }
+      j |= bit;
+    }
+    for (uint16_t i = 0; i < N; i++) {
+      im[i] = 0;
+    }
+    
+    span = 1;
+    butterfly = 0;
+  }
+  
+  // 执行最多 count 次蝶形运算，变换完成时返回 true
+  bool step(uint16_t count) {
+    while (count > 0 && span < N) {
+      // 同一级中第 butterfly 个蝶形运算的位置与旋转因子 W = e^(-j2πk/(2·span))
+      uint16_t k = butterfly & (span - 1);
+      uint16_t i0 = ((butterfly - k) << 1) + k;
+      uint16_t i1 = i0 + span;
+      uint8_t angle = static_cast<uint8_t>(k * (FFT_TABLE_POINTS / 2 / span));
+      int32_t c = fftCosine(angle);
+      int32_t s = fftSine(angle);
+      
+      int32_t tr = (c * re[i1] + s * im[i1] + (1L << 14)) >> 15;
+      int32_t ti = (c * im[i1] - s * re[i1] + (1L << 14)) >> 15;
+      int32_t r0 = re[i0];
+      int32_t m0 = im[i0];
+      re[i0] = static_cast<int16_t>((r0 + tr) >> 1);
+      im[i0] = static_cast<int16_t>((m0 + ti) >> 1);
+      re[i1] = static_cast<int16_t>((r0 - tr) >> 1);
+      im[i1] = static_cast<int16_t>((m0 - ti) >> 1);
+      
+      if (++butterfly >= N / 2) {
+        butterfly = 0;
+        span <<= 1;
+      }
+      count--;
+    }
+    return span >= N;
+  }
+  
+  bool isDone() const { return span >= N; }
+  
+  // 频点功率 re² + im²
+  uint32_t power(uint16_t bin) const {
+    int32_t r = re[bin];
+    int32_t i = im[bin];
+    return static_cast<uint32_t>(r * r) + static_cast<uint32_t>(i * i);
+  }
+};
+
+#endif // FIXED_FFT_H
\ No newline at end of file
@@ -0,0 +1,138 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <Arduino.h>
+
+// Q16.16 定点数（16位整数 + 16位小数）
+// 面向无FPU的ATmega2560：加减为32位整数运算，乘除使用64位中间结果，
+// 所有运算饱和到 [-32768, 32767.99998]。
+// 由浮点常量构造是 constexpr 的，常量系数在编译期完成换算；
+// 构造为 explicit，运行时的 float 不会被隐式换算（每次换算都要软件浮点乘法）。
+class Fix16 {
+private:
+  int32_t rawValue;
+  
+  static const int32_t RAW_MAX = 0x7FFFFFFFL;
+  static const int32_t RAW_MIN = -0x7FFFFFFFL - 1;
+  
+  struct RawTag {};
+  constexpr Fix16(int32_t raw, RawTag) : rawValue(raw) {}
+  
+public:
+  static const uint8_t FRACTION_BITS = 16;
+  static const int32_t ONE = 0x00010000L;
+  
+  // 已放大的浮点值四舍五入到整数；|scaled| >= 2^23 时 float 本身已是整数，
+  // 再加 0.5 会在 float 中进位，多出一个LSB
+  static constexpr int32_t roundScaled(float scaled) {
+    return static_cast<int32_t>(scaled >= 8388608.0f || scaled <= -8388608.0f ? scaled
+                                : scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+  }
+  
+  constexpr Fix16() : rawValue(0) {}
+  constexpr explicit Fix16(float value) : rawValue(roundScaled(value * 65536.0f)) {}
+  
+  // 由原始Q16.16值构造
+  static constexpr Fix16 fromRaw(int32_t raw) { return Fix16(raw, RawTag()); }
+  
+  // 由整数构造
+  static Fix16 fromInt(int16_t value) { return fromRaw(static_cast<int32_t>(value) << FRACTION_BITS); }
+  
+  // 由无符号整数比值 numerator / denominator 构造（整数运算，不经过浮点）
+  static Fix16 fromRatio(uint32_t numerator, uint16_t denominator) {
+    if (denominator == 0) return fromRaw(0);
+    uint32_t quotient = numerator / denominator;
+    uint32_t remainder = numerator % denominator;
+    if (quotient > 0x7FFFUL) return fromRaw(RAW_MAX);
+    return fromRaw(static_cast<int32_t>((quotient << FRACTION_BITS) +
+                                        (remainder << FRACTION_BITS) / denominator));
+  }
+  
+  int32_t raw() const { return rawValue; }
+  float toFloat() const { return static_cast<float>(rawValue) / 65536.0f; }
+  int16_t toInt() const { return static_cast<int16_t>((rawValue + (ONE >> 1)) >> FRACTION_BITS); }
+  
+  // 算术运算（饱和）
+  friend Fix16 operator+(Fix16 a, Fix16 b) { return saturate(static_cast<int64_t>(a.rawValue) + b.rawValue); }
+  friend Fix16 operator-(Fix16 a, Fix16 b) { return saturate(static_cast<int64_t>(a.rawValue) - b.rawValue); }
+  friend Fix16 operator*(Fix16 a, Fix16 b) {
+    return saturate((static_cast<int64_t>(a.rawValue) * b.rawValue + (ONE >> 1)) >> FRACTION_BITS);
+  }
+  friend Fix16 operator/(Fix16 a, Fix16 b) {
+    if (b.rawValue == 0) return fromRaw(a.rawValue >= 0 ? RAW_MAX : RAW_MIN);
+    return saturate((static_cast<int64_t>(a.rawValue) << FRACTION_BITS) / b.rawValue);
+  }
+  
+  // 与整数的乘除（无需换算）
+  // 浮点实参在此处编译失败，避免运行时的浮点到定点转换
+  template<typename I>
+  friend Fix16 operator*(Fix16 a, I b) {
+    static_assert(I(1) / 2 == 0, "Fix16: use a Fix16 constant instead of a floating-point operand");
+    return saturate(static_cast<int64_t>(a.rawValue) * b);
+  }
+  template<typename I>
+  friend Fix16 operator/(Fix16 a, I b) {
+    static_assert(I(1) / 2 == 0, "Fix16: use a Fix16 constant instead of a floating-point operand");
+    return b == 0 ? a : fromRaw(a.rawValue / static_cast<int32_t>(b));
+  }
+  
+  Fix16 operator-() const { return rawValue == RAW_MIN ? fromRaw(RAW_MAX) : fromRaw(-rawValue); }
+  
+  Fix16& operator+=(Fix16 other) { *this = *this + other; return *this; }
+  Fix16& operator-=(Fix16 other) { *this = *this - other; return *this; }
+  Fix16& operator*=(Fix16 other) { *this = *this * other; return *this; }
+  Fix16& operator/=(Fix16 other) { *this = *this / other; return *this; }
+  
+  // 比较
+  friend bool operator<(Fix16 a, Fix16 b) { return a.rawValue < b.rawValue; }
+  friend bool operator>(Fix16 a, Fix16 b) { return a.rawValue > b.rawValue; }
+  friend bool operator<=(Fix16 a, Fix16 b) { return a.rawValue <= b.rawValue; }
+  friend bool operator>=(Fix16 a, Fix16 b) { return a.rawValue >= b.rawValue; }
+  friend bool operator==(Fix16 a, Fix16 b) { return a.rawValue == b.rawValue; }
+  friend bool operator!=(Fix16 a, Fix16 b) { return a.rawValue != b.rawValue; }
+  
+private:
+  static Fix16 saturate(int64_t value) {
+    if (value > RAW_MAX) return fromRaw(RAW_MAX);
+    if (value < RAW_MIN) return fromRaw(RAW_MIN);
+    return fromRaw(static_cast<int32_t>(value));
+  }
+};
+
+// Q8.24 比例系数
+// 用于量程换算等绝对值小于1的常数，比Q16.16多8位小数精度
+class Fix16Scale {
+private:
+  int32_t rawValue;
+  
+public:
+  constexpr Fix16Scale() : rawValue(0) {}
+  constexpr explicit Fix16Scale(float value) : rawValue(Fix16::roundScaled(value * 16777216.0f)) {}
+  
+  int32_t raw() const { return rawValue; }
+  float toFloat() const { return static_cast<float>(rawValue) / 16777216.0f; }
+  
+  friend Fix16 operator*(Fix16 a, Fix16Scale b) {
+    int64_t product = (static_cast<int64_t>(a.raw()) * b.rawValue + (1L << 23)) >> 24;
+    if (product > 0x7FFFFFFFL) product = 0x7FFFFFFFL;
+    if (product < -0x7FFFFFFFL - 1) product = -0x7FFFFFFFL - 1;
+    return Fix16::fromRaw(static_cast<int32_t>(product));
+  }
+};
+
+// float 与 Fix16 通用的辅助函数，便于同一份代码在两种数值类型下编译
+inline float toFloat(float value) { return value; }
+inline float toFloat(Fix16 value) { return value.toFloat(); }
+inline float toFloat(Fix16Scale value) { return value.toFloat(); }
+
+inline float absValue(float value) { return fabs(value); }
+inline Fix16 absValue(Fix16 value) { return value < Fix16() ? -value : value; }
+
+template<typename T>
+inline T clampValue(T value, T minVal, T maxVal) {
+  if (value < minVal) return minVal;
+  if (value > maxVal) return maxVal;
+  return value;
+}
+
+#endif // FIXED_POINT_H
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+#include <Arduino.h>
+
+// 带序号的双缓冲快照（单生产者，T 为不含动态内存的普通结构体）
+// 生产者在后缓冲区 edit() 中组装完整的样本后调用 publish()：序号加1，前后缓冲区交换。
+// 消费者通过 latest() 以常引用读取最近发布的样本，不复制；
+// 记下 getSequence() 的值，序号未变化时可以跳过重复的处理。
+//
+// latest() 返回的引用在生产者下一次 publish() 之前保持一致，
+// 生产者与消费者同在主循环中时即可直接使用。
+// 生产者在中断中发布时，主循环应使用 read() 复制：
+// 复制前后序号不同说明期间发生了发布，重新复制（顺序锁）。
+template<typename T>
+class SnapshotBuffer {
+private:
+  T buffers[2];
+  volatile uint8_t front;              // 已发布的缓冲区
+  volatile uint32_t sequence;          // 发布次数，0 表示尚未发布
+  volatile unsigned long timestamp;    // 最近一次发布的时刻 (ms)
+  
+public:
+  SnapshotBuffer() : front(0), sequence(0), timestamp(0) {
+    memset(buffers, 0, sizeof(buffers));
+  }
+  
+  // 生产者：待发布的缓冲区（内容为上上次发布的样本，应完整重写）
+  T& edit() {
+    return buffers[front ^ 1];
+  }
+  
+  // 生产者：发布 edit() 中的样本
+  // 生产者只能是主循环或中断之一；中断中执行时整个发布对主循环是原子的
+  void publish(unsigned long now) {
+    sequence++;
+    timestamp = now;
+    front ^= 1;
+  }
+  
+  // 消费者：最近发布的样本（尚未发布时为全0）
+  const T& latest() const {
+    return buffers[front];
+  }
+  
+  // 消费者：复制一份一致的快照，返回其序号
+  uint32_t read(T& copy) const {
+    uint32_t before;
+    do {
+      before = getSequence();
+      copy = buffers[front];
+    } while (getSequence() != before);
+    return before;
+  }
+  
+  uint32_t getSequence() const {
+    noInterrupts();
+    uint32_t value = sequence;
+    interrupts();
+    return value;
+  }
+  
+  unsigned long getTimestamp() const {
+    noInterrupts();
+    unsigned long value = timestamp;
+    interrupts();
+    return value;
+  }
+  
+  // 自 seenSequence 之后是否有新的发布；有时更新 seenSequence
+  bool advance(uint32_t& seenSequence) const {
+    uint32_t current = getSequence();
+    if (current == seenSequence) return false;
+    seenSequence = current;
+    return true;
+  }
+};
+
+#endif // SNAPSHOT_BUFFER_H
\ No newline at end of file
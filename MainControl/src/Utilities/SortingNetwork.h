@@ -0,0 +1,89 @@
+#ifndef SORTING_NETWORK_H
+#define SORTING_NETWORK_H
+
+#include <Arduino.h>
+
+// 固定长度排序网络
+// 比较-交换的顺序在编译期确定，与数据无关，执行时间恒定。
+// 目前提供 N = 5, 7, 9（比较次数分别为 9, 16, 25，均为已知最优），
+// 其他长度没有定义，会在编译时报错。
+
+// 比较-交换：保证 a <= b
+// 无符号整数（ADC样本）使用掩码实现，不产生分支
+inline void compareExchange(uint16_t& a, uint16_t& b) {
+  uint16_t mask = -static_cast<uint16_t>(b < a);
+  uint16_t diff = (a ^ b) & mask;
+  a ^= diff;
+  b ^= diff;
+}
+
+template<typename T>
+inline void compareExchange(T& a, T& b) {
+  T low = (b < a) ? b : a;
+  T high = (b < a) ? a : b;
+  a = low;
+  b = high;
+}
+
+template<uint8_t N>
+struct SortingNetwork;
+
+template<>
+struct SortingNetwork<5> {
+  template<typename T>
+  static void sort(T* v) {
+    compareExchange(v[0], v[1]); compareExchange(v[3], v[4]); compareExchange(v[2], v[4]);
+    compareExchange(v[2], v[3]); compareExchange(v[0], v[3]); compareExchange(v[0], v[2]);
+    compareExchange(v[1], v[4]); compareExchange(v[1], v[3]); compareExchange(v[1], v[2]);
+  }
+};
+
+template<>
+struct SortingNetwork<7> {
+  template<typename T>
+  static void sort(T* v) {
+    compareExchange(v[1], v[2]); compareExchange(v[0], v[2]); compareExchange(v[0], v[1]);
+    compareExchange(v[3], v[4]); compareExchange(v[5], v[6]); compareExchange(v[3], v[5]);
+    compareExchange(v[4], v[6]); compareExchange(v[4], v[5]); compareExchange(v[0], v[4]);
+    compareExchange(v[0], v[3]); compareExchange(v[1], v[5]); compareExchange(v[2], v[6]);
+    compareExchange(v[2], v[5]); compareExchange(v[1], v[3]); compareExchange(v[2], v[4]);
+    compareExchange(v[2], v[3]);
+  }
+};
+
+template<>
+struct SortingNetwork<9> {
+  template<typename T>
+  static void sort(T* v) {
+    compareExchange(v[0], v[1]); compareExchange(v[3], v[4]); compareExchange(v[6], v[7]);
+    compareExchange(v[1], v[2]); compareExchange(v[4], v[5]); compareExchange(v[7], v[8]);
+    compareExchange(v[0], v[1]); compareExchange(v[3], v[4]); compareExchange(v[6], v[7]);
+    compareExchange(v[0], v[3]); compareExchange(v[3], v[6]); compareExchange(v[0], v[3]);
+    compareExchange(v[1], v[4]); compareExchange(v[4], v[7]); compareExchange(v[1], v[4]);
+    compareExchange(v[2], v[5]); compareExchange(v[5], v[8]); compareExchange(v[2], v[5]);
+    compareExchange(v[1], v[3]); compareExchange(v[5], v[7]); compareExchange(v[2], v[6]);
+    compareExchange(v[4], v[6]); compareExchange(v[2], v[4]); compareExchange(v[2], v[3]);
+    compareExchange(v[5], v[6]);
+  }
+};
+
+// 中值（原地排序）
+template<uint8_t N, typename T>
+inline T sortedMedian(T* v) {
+  SortingNetwork<N>::sort(v);
+  return v[N / 2];
+}
+
+// 截尾和：排序后两端各去掉 Trim 个样本，返回其余 N - 2*Trim 个样本之和
+template<uint8_t N, uint8_t Trim, typename T>
+inline uint32_t trimmedSum(T* v) {
+  static_assert(2 * Trim < N, "trimmedSum: nothing left after trimming");
+  SortingNetwork<N>::sort(v);
+  uint32_t sum = 0;
+  for (uint8_t i = Trim; i < N - Trim; i++) {
+    sum += v[i];
+  }
+  return sum;
+}
+
+#endif // SORTING_NETWORK_H
\ No newline at end of file
@@ -0,0 +1 @@
+#include <cstdint>
\ No newline at end of file
@@ -0,0 +1,98 @@
+// 自适应采样周期：平稳时每 ADAPT_QUIET_SAMPLES 个样本加倍直到上限，阶跃时立即减半，
+// 每次变化产生一个 SampleRateEvent（以 SENSOR_SOURCE_SYNTHETIC 编译，污染物通道的信号在每次转换前设定）
+#include "HostTest.h"
+#include "Sensors/SensorManager.h"
+
+static const unsigned long LOOP_INTERVAL = 10;  // 主循环周期 (ms)
+static const uint8_t QUIET_SAMPLES = 2 * STABILITY_WINDOW_SIZE;  // 与 SensorManager 的 ADAPT_QUIET_SAMPLES 相同
+
+// 污染物通道的合成信号：恒定值，没有噪声与随机毛刺
+static void setPollution(SensorManager& manager, float raw) {
+  SyntheticChannel channel = { raw, 0.0f, 0.0f, 0.0f, 0.0f };
+  manager.getSource().getSignal().setChannel(1, channel);
+}
+
+// 以当前信号申请一批污染物转换，并推进到该批次处理完毕
+static void feedPollution(SensorManager& manager, float raw) {
+  setPollution(manager, raw);
+  AdcSnapshot snap;
+  manager.getSource().snapshot(1, snap);
+  uint32_t sequence = snap.sequence;
+  while (manager.getSource().snapshot(1, snap), snap.sequence == sequence) {
+    hostAdvanceMillis(LOOP_INTERVAL);
+    manager.update();
+  }
+  hostAdvanceMillis(LOOP_INTERVAL);
+  manager.update();
+}
+
+// 取出污染物通道的事件（其他通道的事件丢弃），返回取到的个数
+static uint8_t pollPollutionEvents(SensorManager& manager, SampleRateEvent& last) {
+  uint8_t count = 0;
+  SampleRateEvent event;
+  while (manager.pollSampleRateEvent(event)) {
+    if (event.sensorIndex != 1) continue;
+    last = event;
+    count++;
+  }
+  return count;
+}
+
+int main() {
+  SensorManager manager;
+  manager.getSource().getSignal().setSpikes(0.0f, 0.0f);
+  setPollution(manager, 400.0f);
+  CHECK(manager.initialize());
+  CHECK(manager.getSamplePeriod(1) == POLLUTION_SAMPLE_PERIOD);
+  
+  // 平稳：周期逐级加倍，相邻两次变化之间正好 QUIET_SAMPLES 个样本，直到上限
+  SampleRateEvent event = SampleRateEvent();
+  uint8_t doublings = 0;
+  uint16_t sinceChange = 0;
+  bool regular = true;
+  for (uint16_t i = 0; i < 20 * QUIET_SAMPLES; i++) {
+    feedPollution(manager, 400.0f);
+    sinceChange++;
+    uint8_t events = pollPollutionEvents(manager, event);
+    if (events == 0) continue;
+    
+    CHECK(events == 1);
+    CHECK(event.newPeriod == min(2 * event.previousPeriod, (unsigned long)POLLUTION_MAX_PERIOD));
+    CHECK(event.newPeriod == manager.getSamplePeriod(1));
+    CHECK(event.timestamp == millis());
+    printf("平稳 第 %3u 个样本：%4lu -> %4lu ms\n", i + 1, event.previousPeriod, event.newPeriod);
+    // 第一次还要等稳定性窗口填满
+    if (doublings > 0 && sinceChange != QUIET_SAMPLES) regular = false;
+    doublings++;
+    sinceChange = 0;
+  }
+  CHECK(regular);
+  CHECK(doublings == 4);  // 100 -> 200 -> 400 -> 800 -> 1000
+  CHECK(manager.getSamplePeriod(1) == POLLUTION_MAX_PERIOD);
+  
+  // 阶跃：毛刺窗口过半后阶跃进入滤波器，第一个样本即减半
+  uint16_t firstHalving = 0;
+  unsigned long period = manager.getSamplePeriod(1);
+  for (uint16_t i = 0; i < 20; i++) {
+    feedPollution(manager, 480.0f);
+    if (pollPollutionEvents(manager, event) == 0) continue;
+    CHECK(event.newPeriod == max(event.previousPeriod / 2, (unsigned long)POLLUTION_MIN_PERIOD));
+    CHECK(event.newPeriod < period);
+    printf("阶跃 第 %3u 个样本：%4lu -> %4lu ms\n", i + 1, event.previousPeriod, event.newPeriod);
+    period = event.newPeriod;
+    if (firstHalving == 0) firstHalving = i + 1;
+  }
+  CHECK(firstHalving == HAMPEL_WINDOW_SIZE / 2 + 1);
+  CHECK(manager.getSamplePeriod(1) < POLLUTION_MAX_PERIOD / 4);
+  
+  // 阶跃之后重新平稳，周期再次放慢
+  uint8_t recovered = 0;
+  for (uint16_t i = 0; i < 20 * QUIET_SAMPLES; i++) {
+    feedPollution(manager, 480.0f);
+    recovered += pollPollutionEvents(manager, event);
+  }
+  CHECK(recovered > 0);
+  CHECK(manager.getSamplePeriod(1) == POLLUTION_MAX_PERIOD);
+  
+  return testResult("AdaptiveSamplingTest");
+}
\ No newline at end of file
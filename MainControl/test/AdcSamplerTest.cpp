@@ -0,0 +1,292 @@
+// 后台ADC采样引擎：以合成的转换结果代替ADC中断，检查通道轮换顺序与批次平均值，
+// 以及紧急监视在阈值附近的触发、滞回区间内的保持、解除与重新触发
+#include "HostTest.h"
+#include "Sensors/AdcSampler.h"
+
+// 合成转换结果：通道 c 的第 k 次转换
+static uint16_t syntheticValue(uint8_t channel, uint16_t k) {
+  return static_cast<uint16_t>(100 * channel + 3 * k + (k % 2));
+}
+
+// 模拟转换完成中断，直到ADC停止；记录转换的通道顺序，counts 为各通道已转换的次数
+static uint16_t runConversions(AdcSampler& sampler, uint16_t counts[SENSOR_COUNT],
+                               uint8_t* order, uint16_t maxCount) {
+  uint16_t n = 0;
+  while (sampler.isBusy() && n < maxCount) {
+    uint8_t channel = sampler.getCurrentChannel();
+    order[n++] = channel;
+    hostAdvanceMicros(104);
+    sampler.onConversionComplete(syntheticValue(channel, counts[channel]++));
+  }
+  return n;
+}
+
+// 执行一次被监视通道的单独转换，dt 为距上一次转换的间隔 (us)
+static void watchConversion(AdcSampler& sampler, uint16_t value, unsigned long dt) {
+  hostAdvanceMicros(dt);
+  sampler.requestWatch();
+  sampler.onConversionComplete(value);
+}
+
+static float expectedAverage(uint8_t channel, uint16_t first, uint16_t count) {
+  float sum = 0.0f;
+  for (uint16_t k = first; k < first + count; k++) {
+    sum += syntheticValue(channel, k);
+  }
+  return sum / count;
+}
+
+int main() {
+  uint8_t order[256];
+  
+  // 所有通道各申请一批：按通道轮流转换，批次交错完成
+  {
+    AdcSampler sampler;
+    uint16_t counts[SENSOR_COUNT] = {0};
+    CHECK(sampler.begin());
+    CHECK(!sampler.isBusy());
+    for (uint8_t ch = 0; ch < SENSOR_COUNT; ch++) {
+      sampler.request(ch, 4);
+    }
+    CHECK(sampler.isBusy());
+    uint16_t n = runConversions(sampler, counts, order, 256);
+    CHECK(n == 4 * SENSOR_COUNT);
+    for (uint16_t i = 0; i < n; i++) {
+      CHECK(order[i] == i % SENSOR_COUNT);
+    }
+    CHECK(!sampler.isBusy());
+    
+    for (uint8_t ch = 0; ch < SENSOR_COUNT; ch++) {
+      AdcSnapshot snap;
+      CHECK(sampler.snapshot(ch, snap));
+      CHECK(snap.count == 4);
+      CHECK(snap.sequence == 1);
+      CHECK(snap.conversions == 4);
+      CHECK_NEAR(sampler.getAverage(ch), expectedAverage(ch, 0, 4), 1e-4);
+      // 批次从申请到最后一次转换：前面每个通道各转换4次
+      CHECK(snap.batchMicros == 104UL * (3 * SENSOR_COUNT + ch + 1));
+    }
+  }
+  
+  // 批次长度不同：完成的通道退出轮换，其余通道继续
+  {
+    AdcSampler sampler;
+    uint16_t counts[SENSOR_COUNT] = {0};
+    sampler.begin();
+    sampler.request(0, 6);
+    sampler.request(3, 2);
+    sampler.request(4, 4);
+    uint16_t n = runConversions(sampler, counts, order, 256);
+    const uint8_t expected[] = { 0, 3, 4, 0, 3, 4, 0, 4, 0, 4, 0, 0 };
+    CHECK(n == sizeof(expected));
+    for (uint16_t i = 0; i < n && i < sizeof(expected); i++) {
+      CHECK(order[i] == expected[i]);
+    }
+    CHECK_NEAR(sampler.getAverage(0), expectedAverage(0, 0, 6), 1e-4);
+    CHECK_NEAR(sampler.getAverage(3), expectedAverage(3, 0, 2), 1e-4);
+    CHECK_NEAR(sampler.getAverage(4), expectedAverage(4, 0, 4), 1e-4);
+    
+    // 未申请的通道没有结果
+    AdcSnapshot snap;
+    CHECK(!sampler.snapshot(1, snap));
+    CHECK(sampler.getAverage(2) == 0.0f);
+    
+    // 最近样本从新到旧，跨越多个批次
+    sampler.request(0, 8);
+    runConversions(sampler, counts, order, 256);
+    uint16_t recent[ADC_RECENT_SAMPLES];
+    uint8_t count = sampler.getRecentSamples(0, recent, ADC_RECENT_SAMPLES);
+    CHECK(count == ADC_RECENT_SAMPLES);
+    for (uint8_t i = 0; i < count; i++) {
+      CHECK(recent[i] == syntheticValue(0, 13 - i));
+    }
+    CHECK_NEAR(sampler.getAverage(0), expectedAverage(0, 6, 8), 1e-4);
+    CHECK(sampler.snapshot(0, snap) && snap.sequence == 2);
+  }
+  
+  // 批次未完成时再次申请：覆盖原批次，锁存的结果在新批次完成前保持不变
+  {
+    AdcSampler sampler;
+    uint16_t counts[SENSOR_COUNT] = {0};
+    sampler.begin();
+    sampler.request(1, 2);
+    runConversions(sampler, counts, order, 256);
+    float first = sampler.getAverage(1);
+    
+    sampler.request(1, 5);
+    sampler.onConversionComplete(900);
+    sampler.onConversionComplete(900);
+    sampler.request(1, 3);
+    CHECK_NEAR(sampler.getAverage(1), first, 1e-4);
+    sampler.onConversionComplete(10);
+    sampler.onConversionComplete(20);
+    CHECK(sampler.onConversionComplete(30) == false);
+    CHECK_NEAR(sampler.getAverage(1), 20.0, 1e-4);
+    
+    AdcSnapshot snap;
+    sampler.snapshot(1, snap);
+    CHECK(snap.sequence == 2);
+    CHECK(snap.conversions == 7);
+  }
+  
+  // 停止后不再启动转换
+  {
+    AdcSampler sampler;
+    sampler.begin();
+    sampler.stop();
+    sampler.request(2, 4);
+    CHECK(!sampler.isBusy());
+  }
+  
+  // 紧急监视：触发值 800、解除值 700，连续 3 次超限触发，持续 50 ms 不高于解除值才解除；
+  // 速率阈值取最大，只由原始值触发
+  {
+    const unsigned long PERIOD = 5000;
+    AdcSampler sampler;
+    sampler.begin();
+    EmergencyWatchdog& watchdog = sampler.getWatchdog();
+    CHECK(!watchdog.isEnabled());
+    watchdog.configure(2, 800, 700, 0xFFFF, 20, 50, 3);
+    CHECK(watchdog.isEnabled());
+    
+    // 监视转换不进入批次结果
+    sampler.requestWatch();
+    CHECK(sampler.isBusy());
+    CHECK(sampler.getCurrentChannel() == 2);
+    CHECK(sampler.onConversionComplete(500) == false);
+    AdcSnapshot snap;
+    CHECK(!sampler.snapshot(2, snap));
+    
+    // 批次进行中申请：在当前转换完成后插入，随后继续原批次
+    uint16_t counts[SENSOR_COUNT] = {0};
+    sampler.request(0, 3);
+    sampler.requestWatch();
+    uint16_t n = runConversions(sampler, counts, order, 256);
+    const uint8_t expected[] = { 0, 2, 0, 0 };
+    CHECK(n == sizeof(expected));
+    for (uint16_t i = 0; i < n && i < sizeof(expected); i++) {
+      CHECK(order[i] == expected[i]);
+    }
+    CHECK(sampler.snapshot(0, snap) && snap.count == 3);
+    CHECK(!watchdog.isTripped());
+    
+    // 其他通道超限不触发
+    sampler.request(1, 4);
+    while (sampler.isBusy()) sampler.onConversionComplete(1000);
+    CHECK(!watchdog.isTripped());
+    
+    // 在滞回区间内与触发值以下不触发；不足 3 次的连续超限被打断后重新计数
+    const uint16_t below[] = { 650, 750, 799, 810, 820, 790, 805, 815 };
+    for (uint8_t i = 0; i < sizeof(below) / sizeof(below[0]); i++) {
+      watchConversion(sampler, below[i], PERIOD);
+      CHECK(!watchdog.isTripped());
+    }
+    EmergencyTrip trip;
+    CHECK(!watchdog.takeTrip(trip));
+    CHECK(watchdog.getTripCount() == 0);
+    
+    // 第 3 次连续超限触发
+    watchConversion(sampler, 830, PERIOD);
+    CHECK(watchdog.isTripped());
+    CHECK(watchdog.getTripCount() == 1);
+    CHECK(watchdog.takeTrip(trip));
+    CHECK(trip.rawValue == 830);
+    CHECK(trip.micros == micros());
+    CHECK(!trip.bySlope);
+    CHECK(!watchdog.takeTrip(trip));
+    
+    // 回落到滞回区间内：保持触发
+    for (uint8_t i = 0; i < 40; i++) {
+      watchConversion(sampler, 701 + i, PERIOD);
+      CHECK(watchdog.isTripped());
+    }
+    
+    // 短暂低于解除值后又回到区间内：解除计时重新开始
+    for (uint8_t i = 0; i < 8; i++) {
+      watchConversion(sampler, 690, PERIOD);
+    }
+    watchConversion(sampler, 720, PERIOD);
+    CHECK(watchdog.isTripped());
+    
+    // 持续不高于解除值（含等于解除值）：满 50 ms 时解除
+    unsigned long clearStart = micros() + PERIOD;
+    uint8_t releasedAfter = 0;
+    for (uint8_t i = 0; i < 20 && watchdog.isTripped(); i++) {
+      watchConversion(sampler, (i % 2) ? 700 : 650, PERIOD);
+      releasedAfter = i + 1;
+    }
+    printf("监视：持续 %lu us 不高于解除值后解除（第 %u 个样本）\n", micros() - clearStart, releasedAfter);
+    CHECK(!watchdog.isTripped());
+    CHECK(micros() - clearStart == 50000UL);
+    CHECK(watchdog.getTripCount() == 1);
+    CHECK(!watchdog.takeTrip(trip));
+    
+    // 解除后重新布防：再次连续超限时再触发一次
+    for (uint8_t i = 0; i < 2; i++) {
+      watchConversion(sampler, 900, PERIOD);
+    }
+    CHECK(!watchdog.isTripped());
+    watchConversion(sampler, 900, PERIOD);
+    CHECK(watchdog.isTripped());
+    CHECK(watchdog.getTripCount() == 2);
+    CHECK(watchdog.takeTrip(trip) && trip.rawValue == 900);
+    
+    // 触发期间继续超限不重复计数；reset() 立即清除触发状态
+    for (uint8_t i = 0; i < 10; i++) {
+      watchConversion(sampler, 950, PERIOD);
+    }
+    CHECK(watchdog.getTripCount() == 2);
+    CHECK(!watchdog.takeTrip(trip));
+    watchdog.reset();
+    CHECK(!watchdog.isTripped());
+    
+    // 停用后不检查，也不再申请监视转换
+    watchdog.disable();
+    for (uint8_t i = 0; i < 5; i++) {
+      watchConversion(sampler, 1000, PERIOD);
+    }
+    CHECK(!watchdog.isTripped());
+    CHECK(watchdog.getTripCount() == 2);
+    sampler.requestWatch();
+    CHECK(!sampler.isBusy());
+  }
+  
+  // 上升速率：低于触发值但快速上升时提前触发，平缓上升或速率未达到时不触发
+  {
+    const unsigned long PERIOD = 5000;
+    AdcSampler sampler;
+    sampler.begin();
+    EmergencyWatchdog& watchdog = sampler.getWatchdog();
+    // 速率阈值 2000 计数/秒，每 20 ms 计算一次
+    watchdog.configure(2, 800, 700, 2000, 20, 50, 2);
+    
+    // 1000 计数/秒 升过解除值：不触发
+    uint16_t value = 690;
+    for (uint8_t i = 0; i < 20; i++) {
+      value += 5;
+      watchConversion(sampler, value, PERIOD);
+      CHECK(!watchdog.isTripped());
+    }
+    CHECK(value == 790);
+    
+    // 回到解除值以下，再以 3000 计数/秒 上升
+    for (uint8_t i = 0; i < 10; i++) {
+      watchConversion(sampler, 650, PERIOD);
+    }
+    value = 650;
+    uint8_t steps = 0;
+    while (!watchdog.isTripped() && value < 800) {
+      value += 15;
+      watchConversion(sampler, value, PERIOD);
+      steps++;
+    }
+    EmergencyTrip trip;
+    CHECK(watchdog.takeTrip(trip));
+    printf("速率：3000 计数/秒 上升，原始值 %u 时触发（触发值 800）\n", trip.rawValue);
+    CHECK(trip.bySlope);
+    CHECK(trip.rawValue >= 700 && trip.rawValue < 800);
+    CHECK(steps < 10);
+  }
+  
+  return testResult("AdcSamplerTest");
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+// 多点校准表：断点处与段内的插值、EEPROM往返（每点4字节加校验和）、校验失败时回到量程映射，
+// 以及 SensorManager 中按温度补偿的 pH 换算（以 SENSOR_SOURCE_SYNTHETIC 编译）
+#include "HostTest.h"
+#include <EEPROM.h>
+#include "Sensors/Calibration.h"
+#include "Sensors/SensorManager.h"
+
+static const unsigned long LOOP_INTERVAL = 10;  // 主循环周期 (ms)
+static const double KELVIN = 273.15;
+
+// 物理量按量程编码为16位，往返误差不超过半个编码单位
+static const double PH_ENCODING_STEP = (PH_MAX - PH_MIN) / 65535.0;
+
+struct Breakpoint {
+  uint16_t raw;
+  float value;
+};
+
+// 参考：相邻断点间线性插值，两端按端点段外推
+static double interpolate(const Breakpoint* points, uint8_t n, double raw) {
+  uint8_t s = 0;
+  while (s + 2 < n && raw >= points[s + 1].raw) s++;
+  double slope = (points[s + 1].value - points[s].value) / static_cast<double>(points[s + 1].raw - points[s].raw);
+  return points[s].value + slope * (raw - points[s].raw);
+}
+
+// 设定一个通道的合成信号：恒定值，没有噪声与漂移
+static void setChannel(SensorManager& manager, uint8_t channel, float raw) {
+  SyntheticChannel params = { raw, 0.0f, 0.0f, 0.0f, 0.0f };
+  manager.getSource().getSignal().setChannel(channel, params);
+}
+
+// 推进到该通道再处理 samples 个批次（毛刺窗口与低通滤波随之稳定）
+static void settle(SensorManager& manager, uint8_t channel, uint8_t samples) {
+  for (uint8_t i = 0; i < samples; i++) {
+    AdcSnapshot snap;
+    manager.getSource().snapshot(channel, snap);
+    uint32_t sequence = snap.sequence;
+    while (manager.getSource().snapshot(channel, snap), snap.sequence == sequence) {
+      hostAdvanceMillis(LOOP_INTERVAL);
+      manager.update();
+    }
+    hostAdvanceMillis(LOOP_INTERVAL);
+    manager.update();
+  }
+}
+
+int main() {
+  const Breakpoint points[4] = { { 100, 2.0f }, { 300, 4.5f }, { 500, 7.0f }, { 900, 12.0f } };
+  
+  // 断点处与段内的插值，两端外推
+  CalibrationTable table;
+  table.setRange(PH_MIN, PH_MAX);
+  // 乱序添加，表内按原始值递增保存
+  const uint8_t order[4] = { 2, 0, 3, 1 };
+  for (uint8_t i = 0; i < 4; i++) {
+    table.addPoint(points[order[i]].raw, points[order[i]].value);
+  }
+  CHECK(table.getPointCount() == 4);
+  {
+    double worstBreakpoint = 0.0;
+    for (uint8_t i = 0; i < 4; i++) {
+      uint16_t raw;
+      float value;
+      CHECK(table.getPoint(i, raw, value));
+      CHECK(raw == points[i].raw);
+      worstBreakpoint = max(worstBreakpoint, fabs(toFloat(table.evaluate(SensorValue(points[i].raw))) - points[i].value));
+    }
+    double worstBetween = 0.0;
+    for (double raw = 0.0; raw <= 1023.0; raw += 0.25) {
+      double error = fabs(toFloat(table.evaluate(SensorValue(static_cast<float>(raw)))) - interpolate(points, 4, raw));
+      worstBetween = max(worstBetween, error);
+    }
+    printf("插值：断点处最大误差 %.2e，0-1023 内最大误差 %.2e（编码步长 %.2e）\n", worstBreakpoint, worstBetween,
+           PH_ENCODING_STEP);
+    CHECK(worstBreakpoint <= 0.5 * PH_ENCODING_STEP + 1e-5);
+    CHECK(worstBetween <= 0.5 * PH_ENCODING_STEP + 1e-5);
+  }
+  
+  // 少于2个校准点：量程线性映射，1个点时平移经过该点
+  {
+    CalibrationTable linear;
+    linear.setRange(PH_MIN, PH_MAX);
+    CHECK_NEAR(toFloat(linear.evaluate(SensorValue(511.5f))), 7.0, 1e-4);
+    linear.addPoint(400, 6.0f);
+    CHECK_NEAR(toFloat(linear.evaluate(SensorValue(400.0f))), 6.0, 1e-3);
+    CHECK_NEAR(toFloat(linear.evaluate(SensorValue(600.0f))) - toFloat(linear.evaluate(SensorValue(400.0f))),
+               200.0 * PH_MAX / 1023.0, 1e-3);
+    // 相距不超过 CALIBRATION_MERGE_DISTANCE 的点替换原有点
+    linear.addPoint(400 + CALIBRATION_MERGE_DISTANCE, 6.5f);
+    CHECK(linear.getPointCount() == 1);
+  }
+  
+  // EEPROM往返：点数 1 字节、每点 4 字节、校验和 1 字节
+  const int address = CALIBRATION_EEPROM_ADDR;
+  CHECK(CalibrationTable::STORAGE_SIZE == 1 + 4 * CALIBRATION_POINTS + 1);
+  EEPROM.clear();
+  table.save(address);
+  {
+    CHECK(EEPROM.read(address) == 4);
+    for (uint8_t i = 0; i < 4; i++) {
+      uint16_t raw;
+      EEPROM.get(address + 1 + 4 * i, raw);
+      CHECK(raw == points[i].raw);
+    }
+    // 保存范围之外不被写入
+    CHECK(EEPROM.read(address - 1) == 0xFF);
+    CHECK(EEPROM.read(address + CalibrationTable::STORAGE_SIZE) == 0xFF);
+    
+    CalibrationTable loaded;
+    loaded.setRange(PH_MIN, PH_MAX);
+    CHECK(loaded.load(address));
+    CHECK(loaded.getPointCount() == 4);
+    bool identical = true;
+    for (uint16_t raw = 0; raw <= 1023; raw++) {
+      identical &= toFloat(loaded.evaluate(SensorValue(raw))) == toFloat(table.evaluate(SensorValue(raw)));
+    }
+    CHECK(identical);
+  }
+  
+  // 校验失败：点数、已用的校准点或校验和中任一字节损坏都使校准点被清空，回到量程映射
+  {
+    uint8_t rejected = 0;
+    for (uint8_t offset = 0; offset < CalibrationTable::STORAGE_SIZE; offset++) {
+      table.save(address);
+      EEPROM.write(address + offset, EEPROM.read(address + offset) ^ 0x04);
+      CalibrationTable corrupted;
+      corrupted.setRange(PH_MIN, PH_MAX);
+      if (corrupted.load(address)) continue;
+      rejected++;
+      CHECK(corrupted.getPointCount() == 0);
+      CHECK_NEAR(toFloat(corrupted.evaluate(SensorValue(511.5f))), 7.0, 1e-4);
+    }
+    printf("EEPROM中 %u 字节逐一损坏，拒绝 %u 次\n", CalibrationTable::STORAGE_SIZE, rejected);
+    // 未使用的校准点槽位不参与校验
+    CHECK(rejected == CalibrationTable::STORAGE_SIZE - 4 * (CALIBRATION_POINTS - 4));
+    
+    // 未写入过的EEPROM
+    EEPROM.clear();
+    CalibrationTable blank;
+    CHECK(!blank.load(address));
+    CHECK(blank.getPointCount() == 0);
+  }
+  
+  // pH温度补偿：25°C 下用两种标准液校准，温度升高后偏离中性点的读数按绝对温度之比缩小
+  {
+    EEPROM.clear();
+    SensorManager manager;
+    manager.getSource().getSignal().setSpikes(0.0f, 0.0f);
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) setChannel(manager, i, 512.0f);
+    setChannel(manager, 4, 255.75f);  // 25°C（温度通道无校准点，量程 0-100°C）
+    CHECK(manager.initialize());
+    settle(manager, 4, 40);
+    double reference = manager.readAllSensors().temperature;
+    
+    const float bufferRaw[2] = { 300.0f, 700.0f };
+    const float bufferPh[2] = { 4.0f, 10.0f };
+    for (uint8_t i = 0; i < 2; i++) {
+      setChannel(manager, 3, bufferRaw[i]);
+      settle(manager, 3, 40);
+      CHECK(manager.calibrateSensor(3, bufferPh[i]));
+    }
+    // 校准时的温度与参考温度相差约 0.02°C，期望值按实际温度换算
+    double referenceFactor = (PH_REFERENCE_TEMP + KELVIN) / (reference + KELVIN);
+    for (uint8_t i = 0; i < 2; i++) {
+      setChannel(manager, 3, bufferRaw[i]);
+      settle(manager, 3, 40);
+      CHECK_NEAR(manager.readAllSensors().pH, bufferPh[i], 1e-3);
+    }
+    
+    // 升温到约 50°C
+    setChannel(manager, 4, 511.5f);
+    settle(manager, 4, 40);
+    double hot = manager.readAllSensors().temperature;
+    double factor = (PH_REFERENCE_TEMP + KELVIN) / (hot + KELVIN);
+    double worst = 0.0;
+    for (uint8_t i = 0; i < 2; i++) {
+      setChannel(manager, 3, bufferRaw[i]);
+      settle(manager, 3, 40);
+      double expected = 7.0 + (bufferPh[i] - 7.0) / referenceFactor * factor;
+      worst = max(worst, fabs(manager.readAllSensors().pH - expected));
+    }
+    printf("pH补偿：%.2f°C 校准，%.2f°C 时 pH 4 标准液读数 %.3f（系数 %.4f），最大误差 %.2e\n", reference, hot,
+           7.0 + (4.0 - 7.0) / referenceFactor * factor, factor, worst);
+    CHECK(worst < 2e-4);
+    
+    // 高温下重新校准：标称值换算到参考温度后存入，当前温度下读数等于标称值
+    setChannel(manager, 3, bufferRaw[0]);
+    settle(manager, 3, 40);
+    CHECK(manager.calibrateSensor(3, 4.0f));
+    settle(manager, 3, 5);
+    CHECK_NEAR(manager.readAllSensors().pH, 4.0, 1e-3);
+    
+    // 校准表已写入EEPROM，重新初始化后仍然有效
+    SensorManager restarted;
+    restarted.getSource().getSignal().setSpikes(0.0f, 0.0f);
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) setChannel(restarted, i, 512.0f);
+    setChannel(restarted, 4, 511.5f);
+    setChannel(restarted, 3, bufferRaw[0]);
+    CHECK(restarted.initialize());
+    settle(restarted, 4, 40);
+    settle(restarted, 3, 40);
+    CHECK_NEAR(restarted.readAllSensors().pH, 4.0, 1e-3);
+  }
+  
+  return testResult("CalibrationTest");
+}
\ No newline at end of file
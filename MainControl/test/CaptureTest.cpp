@@ -0,0 +1,200 @@
+// 突发采集：SoftwareSampler::startCapture 的样本数、时刻与内容，命令参数的范围检查，
+// 以及 CaptureStreamer 按有限大小的分段输出文本与JSON（采样器直接使用 SyntheticSignal）
+#include <string>
+#include "HostTest.h"
+#include "Sensors/SoftwareSampler.h"
+#include "Sensors/SyntheticSignal.h"
+#include "Communication/CaptureStreamer.h"
+
+// 每次最多取走的字节数（与主循环经WiFi发送时相同）
+static const size_t CHUNK_BYTES = CAPTURE_WIFI_BYTES;
+// 一行的最大长度：头部约 48 字节，每个样本最多 5 个字符
+static const size_t MAX_LINE = 48 + CAPTURE_LINE_SAMPLES * 5;
+
+struct StreamResult {
+  std::string text;
+  uint16_t chunks;
+  size_t largestPeek;
+  uint16_t progressSteps;   // getProgress() 每次增加的最大值
+};
+
+// 像主循环一样每次只取走一部分，直到输出结束
+static StreamResult drain(CaptureStreamer& streamer) {
+  StreamResult result = StreamResult();
+  uint16_t progress = 0;
+  const char* data;
+  size_t available;
+  while ((available = streamer.peek(data)) > 0) {
+    result.largestPeek = max(result.largestPeek, available);
+    size_t count = min(available, CHUNK_BYTES);
+    result.text.append(data, count);
+    streamer.consume(count);
+    result.chunks++;
+    result.progressSteps = max(result.progressSteps, static_cast<uint16_t>(streamer.getProgress() - progress));
+    progress = streamer.getProgress();
+  }
+  return result;
+}
+
+// 按行拆分
+static uint16_t splitLines(const std::string& text, std::string* lines, uint16_t maxLines) {
+  uint16_t n = 0;
+  size_t start = 0;
+  size_t end;
+  while ((end = text.find('\n', start)) != std::string::npos && n < maxLines) {
+    lines[n++] = text.substr(start, end - start);
+    start = end + 1;
+  }
+  return n;
+}
+
+// 从一行中依次读出以逗号分隔的无符号数，返回个数
+static uint16_t parseNumbers(const char* text, unsigned long* values, uint16_t maxValues) {
+  uint16_t n = 0;
+  while (*text && n < maxValues) {
+    char* end;
+    values[n++] = strtoul(text, &end, 10);
+    if (*end != ',') break;
+    text = end + 1;
+  }
+  return n;
+}
+
+int main() {
+  SoftwareSampler<SyntheticSignal> sampler;
+  
+  // 未启动时不采集；参数超出范围时拒绝
+  CHECK(!sampler.startCapture(1, 1000, 100));
+  CHECK(sampler.begin());
+  CHECK(!sampler.startCapture(SENSOR_COUNT, 1000, 100));
+  CHECK(!sampler.startCapture(1, 0, 100));
+  CHECK(!sampler.startCapture(1, CAPTURE_MAX_RATE + 1, 100));
+  CHECK(!sampler.startCapture(1, 1000, 0));
+  CHECK(sampler.getCapture().getState() == CaptureBuffer::CAPTURE_IDLE);
+  
+  // 命令参数先按 unsigned long 检查：截断后会落入有效范围的值同样被拒绝
+  CHECK(CaptureBuffer::checkArguments(0, 1, 1) == CaptureBuffer::ARGUMENT_OK);
+  CHECK(CaptureBuffer::checkArguments(SENSOR_COUNT - 1, CAPTURE_MAX_RATE, CAPTURE_MAX_SAMPLES) ==
+        CaptureBuffer::ARGUMENT_OK);
+  CHECK(CaptureBuffer::checkArguments(SENSOR_COUNT, 1000, 100) == CaptureBuffer::ARGUMENT_CHANNEL);
+  CHECK(CaptureBuffer::checkArguments(256, 1000, 100) == CaptureBuffer::ARGUMENT_CHANNEL);
+  CHECK(CaptureBuffer::checkArguments(1, 0, 100) == CaptureBuffer::ARGUMENT_RATE);
+  CHECK(CaptureBuffer::checkArguments(1, CAPTURE_MAX_RATE + 1, 100) == CaptureBuffer::ARGUMENT_RATE);
+  CHECK(CaptureBuffer::checkArguments(1, 65536UL + 1000, 100) == CaptureBuffer::ARGUMENT_RATE);
+  CHECK(CaptureBuffer::checkArguments(1, 1000, 0) == CaptureBuffer::ARGUMENT_SAMPLES);
+  CHECK(CaptureBuffer::checkArguments(1, 1000, CAPTURE_MAX_SAMPLES + 1) == CaptureBuffer::ARGUMENT_SAMPLES);
+  CHECK(CaptureBuffer::checkArguments(1, 1000, 65536UL + 100) == CaptureBuffer::ARGUMENT_SAMPLES);
+  
+  // 采集：样本数、计划采样率与时长，内容与相同种子的信号逐个一致
+  const uint16_t SAMPLES = 500;
+  const uint16_t RATE = 2000;
+  SyntheticSignal reference;
+  reference.begin();
+  CHECK(sampler.begin());
+  unsigned long startMs = millis();
+  CHECK(sampler.startCapture(1, RATE, SAMPLES));
+  const CaptureBuffer& capture = sampler.getCapture();
+  CHECK(capture.getState() == CaptureBuffer::CAPTURE_COMPLETE);
+  CHECK(capture.size() == SAMPLES);
+  CHECK(capture.getChannel() == 1);
+  CHECK(capture.getRate() == RATE);
+  CHECK(capture.getDuration() == (SAMPLES - 1) * (1000000UL / RATE));
+  uint16_t mismatches = 0;
+  for (uint16_t i = 0; i < SAMPLES; i++) {
+    unsigned long offset = i * (1000000UL / RATE);
+    if (capture.get(i) != reference.sample(1, startMs + offset / 1000)) mismatches++;
+  }
+  CHECK(mismatches == 0);
+  
+  // 超出容量的样本数截断到 CAPTURE_MAX_SAMPLES
+  {
+    SoftwareSampler<SyntheticSignal> full;
+    full.begin();
+    CHECK(full.startCapture(0, CAPTURE_MAX_RATE, 0xFFFF));
+    CHECK(full.getCapture().size() == CAPTURE_MAX_SAMPLES);
+    CHECK(full.getCapture().getState() == CaptureBuffer::CAPTURE_COMPLETE);
+  }
+  
+  // 文本输出：头部、每行 CAPTURE_LINE_SAMPLES 个样本（行首为起始序号）、结束标记
+  {
+    CaptureStreamer streamer;
+    CHECK(streamer.begin(capture, CaptureStreamer::FORMAT_TEXT));
+    StreamResult result = drain(streamer);
+    CHECK(!streamer.isActive());
+    
+    const uint16_t dataLines = (SAMPLES + CAPTURE_LINE_SAMPLES - 1) / CAPTURE_LINE_SAMPLES;
+    static std::string lines[128];
+    uint16_t n = splitLines(result.text, lines, 128);
+    printf("文本：%u 个样本，%u 行 %u 字节，分 %u 次输出，单次最多可取 %u 字节\n", SAMPLES, n,
+           (unsigned)result.text.size(), result.chunks, (unsigned)result.largestPeek);
+    CHECK(n == dataLines + 2);
+    CHECK(result.largestPeek <= MAX_LINE);
+    CHECK(result.progressSteps <= CAPTURE_LINE_SAMPLES);
+    CHECK(streamer.getProgress() == SAMPLES);
+    CHECK(lines[0] == "# capture channel=1 samples=500 rate=2000 duration_us=249500");
+    CHECK(lines[n - 1] == "# end");
+    
+    uint16_t mismatched = 0;
+    uint16_t total = 0;
+    for (uint16_t k = 1; k + 1 < n; k++) {
+      unsigned long values[CAPTURE_LINE_SAMPLES + 1] = { 0 };
+      uint16_t count = parseNumbers(lines[k].c_str(), values, CAPTURE_LINE_SAMPLES + 1);
+      if (values[0] != total) mismatched++;
+      for (uint16_t i = 1; i < count; i++) {
+        if (values[i] != capture.get(total++)) mismatched++;
+      }
+    }
+    CHECK(total == SAMPLES);
+    CHECK(mismatched == 0);
+  }
+  
+  // JSON输出：每行一个对象，数据行带偏移量
+  {
+    CaptureStreamer streamer;
+    CHECK(streamer.begin(capture, CaptureStreamer::FORMAT_JSON));
+    StreamResult result = drain(streamer);
+    static std::string lines[128];
+    uint16_t n = splitLines(result.text, lines, 128);
+    CHECK(result.largestPeek <= MAX_LINE);
+    CHECK(lines[0] == "{\"type\":\"captureBegin\",\"channel\":1,\"samples\":500,\"rate\":2000,\"duration\":249500}");
+    CHECK(lines[n - 1] == "{\"type\":\"captureEnd\"}");
+    
+    uint16_t mismatched = 0;
+    uint16_t total = 0;
+    for (uint16_t k = 1; k + 1 < n; k++) {
+      unsigned long offset = 0;
+      int consumed = 0;
+      if (sscanf(lines[k].c_str(), "{\"type\":\"capture\",\"offset\":%lu,\"data\":[%n", &offset, &consumed) != 1 ||
+          consumed == 0 || offset != total) {
+        mismatched++;
+        continue;
+      }
+      unsigned long values[CAPTURE_LINE_SAMPLES];
+      uint16_t count = parseNumbers(lines[k].c_str() + consumed, values, CAPTURE_LINE_SAMPLES);
+      for (uint16_t i = 0; i < count; i++) {
+        if (values[i] != capture.get(total++)) mismatched++;
+      }
+      if (lines[k].compare(lines[k].size() - 2, 2, "]}") != 0) mismatched++;
+    }
+    CHECK(total == SAMPLES);
+    CHECK(mismatched == 0);
+  }
+  
+  // 取消后不再输出；未完成或为空的采集不能开始输出
+  {
+    CaptureStreamer streamer;
+    CHECK(streamer.begin(capture, CaptureStreamer::FORMAT_TEXT));
+    const char* data;
+    CHECK(streamer.peek(data) > 0);
+    streamer.cancel();
+    CHECK(!streamer.isActive());
+    CHECK(streamer.peek(data) == 0);
+    
+    CaptureBuffer empty;
+    CHECK(!streamer.begin(empty, CaptureStreamer::FORMAT_TEXT));
+    CHECK(empty.start(1, 1000, 10));
+    CHECK(!streamer.begin(empty, CaptureStreamer::FORMAT_TEXT));
+  }
+  
+  return testResult("CaptureTest");
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+// StatisticalBuffer / HistoryBuffer：增量统计与逐元素重新计算的一致性，以及与 CircularBuffer 的对比基准
+// 基准统计每个样本（滑动窗口写入 + 均值 + 标准差）读取缓冲区元素的次数与主机耗时；
+// 读取次数与平台无关，AVR上的耗时大致与之成正比。
+#include <time.h>
+#include "HostTest.h"
+#include "Utilities/CircularBuffer.h"
+
+// 记录元素读取次数的数值类型
+static uint32_t elementReads = 0;
+
+struct CountedValue {
+  float value;
+  CountedValue() : value(0.0f) {}
+  CountedValue(float v) : value(v) {}
+  operator float() const { elementReads++; return value; }
+};
+
+static uint32_t randomState = 12345;
+
+static float nextSample() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  // 大偏置上的小波动，检验抵消误差
+  return 1000.0f + static_cast<float>(randomState % 2000) / 100.0f;
+}
+
+// 最近 n 个样本的均值与样本方差（双精度参考）
+static void referenceStatistics(const float* history, size_t count, size_t n, double& mean, double& variance) {
+  size_t first = count - n;
+  double sum = 0.0;
+  for (size_t i = first; i < count; i++) sum += history[i];
+  mean = sum / n;
+  double sumSq = 0.0;
+  for (size_t i = first; i < count; i++) sumSq += (history[i] - mean) * (history[i] - mean);
+  variance = n > 1 ? sumSq / (n - 1) : 0.0;
+}
+
+template<size_t N>
+static void checkAgainstReference() {
+  static float history[2000];
+  StatisticalBuffer<float, N, true> buffer;
+  double worstMean = 0.0;
+  double worstStd = 0.0;
+  for (size_t k = 0; k < 2000; k++) {
+    history[k] = nextSample();
+    CHECK(buffer.push(history[k]));
+    size_t n = min(k + 1, N);
+    CHECK(buffer.size() == n);
+    
+    double mean, variance;
+    referenceStatistics(history, k + 1, n, mean, variance);
+    worstMean = max(worstMean, fabs(buffer.getAverage() - mean));
+    worstStd = max(worstStd, fabs(buffer.getStandardDeviation() - sqrt(variance)));
+  }
+  printf("N=%2u: 最大均值误差 %.2e，最大标准差误差 %.2e\n", static_cast<unsigned>(N), worstMean, worstStd);
+  CHECK(worstMean < 1e-3);
+  CHECK(worstStd < 2e-2);
+}
+
+// 最近 window 个样本的最小二乘斜率（双精度参考）
+static double referenceTrend(const float* history, size_t count, size_t window) {
+  size_t first = count - window;
+  double meanJ = (window - 1) / 2.0;
+  double meanY = 0.0;
+  for (size_t j = 0; j < window; j++) meanY += history[first + j];
+  meanY /= window;
+  double sxy = 0.0;
+  double sxx = 0.0;
+  for (size_t j = 0; j < window; j++) {
+    sxy += (j - meanJ) * (history[first + j] - meanY);
+    sxx += (j - meanJ) * (j - meanJ);
+  }
+  return sxy / sxx;
+}
+
+// 任意窗口的平均值与斜率、全部数据的方差
+template<size_t N>
+static void checkHistory() {
+  static float history[1000];
+  HistoryBuffer<N> buffer;
+  double worstMean = 0.0;
+  double worstTrend = 0.0;
+  double worstStd = 0.0;
+  for (size_t k = 0; k < 1000; k++) {
+    // 斜坡叠加波动，斜率有意义
+    history[k] = nextSample() + 0.5f * (k % 300);
+    buffer.push(history[k]);
+    size_t n = min(k + 1, N);
+    CHECK(buffer.size() == n);
+    float newest = 0.0f;
+    CHECK(buffer.getRecent(0, newest) && newest == history[k]);
+    
+    for (size_t window = 1; window <= n; window += 3) {
+      double mean, variance;
+      referenceStatistics(history, k + 1, window, mean, variance);
+      worstMean = max(worstMean, fabs(buffer.getAverage(window) - mean));
+      if (window >= 2) {
+        worstTrend = max(worstTrend, fabs(buffer.getTrend(window) - referenceTrend(history, k + 1, window)));
+      }
+    }
+    double mean, variance;
+    referenceStatistics(history, k + 1, n, mean, variance);
+    worstMean = max(worstMean, fabs(buffer.getAverage() - mean));
+    worstStd = max(worstStd, fabs(buffer.getStandardDeviation() - sqrt(variance)));
+  }
+  printf("HistoryBuffer<%u>: 最大均值误差 %.2e，最大斜率误差 %.2e，最大标准差误差 %.2e\n",
+         static_cast<unsigned>(N), worstMean, worstTrend, worstStd);
+  CHECK(worstMean < 1e-3);
+  CHECK(worstTrend < 1e-2);  // float 前缀和相减，短窗口的斜率放大舍入误差
+  CHECK(worstStd < 2e-2);
+}
+
+// 每个样本：写入滑动窗口，读取均值与标准差
+template<size_t N>
+static void benchmark() {
+  const uint32_t samples = 200000;
+  CircularBuffer<CountedValue, N> plain;
+  StatisticalBuffer<CountedValue, N, true> statistical;
+  float sink = 0.0f;
+  
+  elementReads = 0;
+  clock_t started = clock();
+  for (uint32_t k = 0; k < samples; k++) {
+    if (plain.isFull()) {
+      CountedValue oldest;
+      plain.pop(oldest);
+    }
+    plain.push(CountedValue(nextSample()));
+    sink += plain.getAverage() + plain.getStandardDeviation();
+  }
+  double plainNs = 1e9 * (clock() - started) / CLOCKS_PER_SEC / samples;
+  double plainReads = static_cast<double>(elementReads) / samples;
+  
+  elementReads = 0;
+  started = clock();
+  for (uint32_t k = 0; k < samples; k++) {
+    statistical.push(CountedValue(nextSample()));
+    sink += statistical.getAverage() + statistical.getStandardDeviation();
+  }
+  double statisticalNs = 1e9 * (clock() - started) / CLOCKS_PER_SEC / samples;
+  double statisticalReads = static_cast<double>(elementReads) / samples;
+  
+  printf("N=%2u: CircularBuffer 每样本读取 %5.1f 个元素 %6.1f ns，StatisticalBuffer 读取 %4.2f 个 %5.1f ns%s\n",
+         static_cast<unsigned>(N), plainReads, plainNs, statisticalReads, statisticalNs, sink > 0.0f ? "" : " ");
+  
+  // 逐元素计算的开销随 N 线性增长；增量统计为常数（含周期性重新累加的均摊）
+  CHECK(plainReads >= 2.0 * N);
+  CHECK(statisticalReads < 2.5);
+}
+
+int main() {
+  // 2的幂与非2的幂容量的索引回绕
+  {
+    CircularBuffer<int, 4> masked;
+    CircularBuffer<int, 5> compared;
+    for (int k = 0; k < 23; k++) {
+      int dropped;
+      if (masked.isFull()) masked.pop(dropped);
+      if (compared.isFull()) compared.pop(dropped);
+      CHECK(masked.push(k));
+      CHECK(compared.push(k));
+    }
+    int value = 0;
+    CHECK(masked.get(0, value) && value == 19);
+    CHECK(masked.get(3, value) && value == 22);
+    CHECK(compared.get(0, value) && value == 18);
+    CHECK(compared.get(4, value) && value == 22);
+    CHECK(!compared.get(5, value));
+  }
+  
+  // 非覆盖模式满时拒绝写入，覆盖模式丢弃最旧数据
+  {
+    StatisticalBuffer<float, 3> bounded;
+    StatisticalBuffer<float, 3, true> sliding;
+    for (int k = 1; k <= 4; k++) {
+      bool accepted = bounded.push(static_cast<float>(k));
+      CHECK(accepted == (k <= 3));
+      CHECK(sliding.push(static_cast<float>(k)));
+    }
+    CHECK_NEAR(bounded.getAverage(), 2.0, 1e-6);
+    CHECK_NEAR(sliding.getAverage(), 3.0, 1e-6);
+    CHECK_NEAR(sliding.getSum(), 9.0, 1e-6);
+    CHECK_NEAR(sliding.getVariance(), 1.0, 1e-6);
+    CHECK_NEAR(sliding.getPopulationVariance(), 2.0 / 3.0, 1e-6);
+    
+    float oldest = 0.0f;
+    CHECK(sliding.pop(oldest) && oldest == 2.0f);
+    CHECK_NEAR(sliding.getAverage(), 3.5, 1e-6);
+    sliding.clear();
+    CHECK(sliding.isEmpty() && sliding.getAverage() == 0.0f);
+  }
+  
+  // 定点数据按定点累加
+  {
+    StatisticalBuffer<Fix16, 5, true> fixed;
+    StatisticalBuffer<float, 5, true> reference;
+    for (int k = 0; k < 200; k++) {
+      float value = 100.0f + 5.0f * sin(0.3f * k);
+      fixed.push(Fix16(value));
+      reference.push(value);
+    }
+    CHECK_NEAR(fixed.getAverage().toFloat(), reference.getAverage(), 1e-3);
+    CHECK_NEAR(fixed.getPopulationVariance().toFloat(), reference.getPopulationVariance(), 1e-2);
+  }
+  
+  // 定点数据偏离参考值超过 181 时 d² 超出 Q16.16：平方和不能饱和，
+  // 否则出窗时减去的平方大于累加进去的，方差在下一次重新累加前偏小
+  {
+    StatisticalBuffer<Fix16, 10, true> fixed;
+    StatisticalBuffer<float, 10, true> reference;
+    double worst = 0.0;
+    for (int k = 0; k < 200; k++) {
+      float value = 1000.0f + 200.0f * sin(0.7f * k) + ((k / 50) % 2 ? 150.0f : 0.0f);
+      fixed.push(Fix16(value));
+      reference.push(value);
+      double variance = reference.getVariance();
+      if (k > 0) worst = max(worst, fabs(fixed.getVariance().toFloat() - variance) / variance);
+      CHECK_NEAR(fixed.getPopulationVariance().toFloat(), reference.getPopulationVariance(),
+                 1e-3 * reference.getPopulationVariance() + 1e-2);
+    }
+    printf("Fix16 大偏差：方差最大相对误差 %.2e\n", worst);
+    CHECK(worst < 1e-3);
+    
+    // 方差本身超出 Q16.16 时饱和到上限
+    StatisticalBuffer<Fix16, 4, true> wide;
+    wide.push(Fix16(-300.0f));
+    wide.push(Fix16(300.0f));
+    CHECK(wide.getVariance() == Fix16::fromRaw(0x7FFFFFFFL));
+  }
+  
+  checkAgainstReference<5>();
+  checkAgainstReference<16>();
+  checkAgainstReference<20>();
+  checkAgainstReference<50>();
+  
+  checkHistory<10>();
+  checkHistory<20>();
+  checkHistory<30>();
+  
+  benchmark<5>();
+  benchmark<20>();
+  benchmark<50>();
+  
+  return testResult("CircularBufferTest");
+}
\ No newline at end of file
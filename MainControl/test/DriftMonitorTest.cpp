@@ -0,0 +1,241 @@
+// 传感器漂移监测：以 SENSOR_SOURCE_SYNTHETIC 编译，按主循环 acquireSensorData() 的顺序采集与融合，
+// 每个监测间隔运行一次漂移监测。基线记录完成后在一个通道注入缓慢的偏移，检查漂移来源的判定、
+// 漂移量的估计（污染物通道以融合前的测量值比较，与融合值无关）以及每次修正的上限
+#include "HostTest.h"
+#include "Sensors/SensorManager.h"
+#include "Sensors/SensorFusion.h"
+#include "Sensors/DriftMonitor.h"
+
+static const unsigned long LOOP_INTERVAL = 10;       // 主循环周期 (ms)
+static const unsigned long CYCLE = 100;              // 每隔此时间运行一次主循环，其间没有通道到期的循环跳过 (ms)
+static const float ALPHA = DRIFT_UPDATE_INTERVAL / (DRIFT_TIME_CONSTANT * 3600000.0f);
+
+// 各通道量程与每个原始计数对应的物理量（未校准时按量程线性映射）
+static const float CHANNEL_SPAN[SENSOR_COUNT] = {
+  FLOW_MAX - FLOW_MIN, POLLUTION_MAX - POLLUTION_MIN, LIGHT_MAX - LIGHT_MIN, PH_MAX - PH_MIN, TEMP_MAX - TEMP_MIN
+};
+
+// 流量、污染物与光照随同一慢速工况变化，回归模型可由其余通道预测；pH与温度基本恒定
+static const SyntheticChannel CHANNELS[SENSOR_COUNT] = {
+  // base   drift  swing  period   noise
+  { 512.0f, 0.0f, 120.0f, 7200.0f, 3.0f },
+  { 410.0f, 0.0f,  80.0f, 7200.0f, 3.0f },
+  { 600.0f, 0.0f, 200.0f, 7200.0f, 6.0f },
+  { 512.0f, 0.0f,  10.0f, 1800.0f, 2.0f },
+  { 256.0f, 0.0f,  15.0f, 3600.0f, 1.0f }
+};
+
+struct Plant {
+  SensorManager manager;
+  SensorFusion fusion;
+  DriftMonitor monitor;
+  DriftMonitor control;         // 对照：快照中的融合值换成常数，结果应与 monitor 完全相同
+  DigitalTwinData twin;
+  SensorData sample;
+  unsigned long startMs;
+  uint8_t suggestions;
+  
+  Plant() : twin(DigitalTwinData()), sample(SensorData()), startMs(0), suggestions(0) {
+    manager.getSource().getSignal().setSpikes(0.0f, 0.0f);
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      manager.getSource().getSignal().setChannel(i, CHANNELS[i]);
+    }
+  }
+  
+  bool begin() {
+    if (!manager.initialize()) return false;
+    fusion.initialize();
+    monitor.initialize();
+    control.initialize();
+    startMs = millis();
+    return true;
+  }
+  
+  // 一次主循环：采集、故障补偿、融合
+  void loop() {
+    hostAdvanceMillis(LOOP_INTERVAL);
+    if (!manager.update()) return;
+    
+    sample = manager.readAllSensors();
+    SampleRateEvent event;
+    while (manager.pollSampleRateEvent(event)) {
+      if (event.sensorIndex == 1) {
+        fusion.setSamplePeriod(event.newPeriod);
+      }
+    }
+    fusion.compensateFaults(sample);
+    sample.pollutionLevel = fusion.fuseSensorData(sample);
+  }
+  
+  // 推进一个监测间隔，漂移监测运行一次
+  void step() {
+    for (uint16_t i = 0; i < DRIFT_UPDATE_INTERVAL / CYCLE; i++) {
+      hostAdvanceMillis(CYCLE - LOOP_INTERVAL);
+      loop();
+    }
+    if (monitor.update(sample, fusion, twin, millis())) suggestions++;
+    SensorData altered = sample;
+    altered.pollutionLevel = POLLUTION_MIN;
+    control.update(altered, fusion, twin, millis());
+  }
+  
+  // 从现在起通道以 countsPerHour 的速率漂移（合成信号的漂移从时间原点算起，基线随之平移）
+  void startDrift(uint8_t channel, float countsPerHour) {
+    SyntheticChannel params = CHANNELS[channel];
+    params.driftPerHour = countsPerHour;
+    params.base -= countsPerHour * (millis() - startMs) / 3600000.0f;
+    manager.getSource().getSignal().setChannel(channel, params);
+  }
+  
+  // 通道固定为恒定原始值，只运行采集直到读数稳定，不运行漂移监测
+  float settle(uint8_t channel, float raw) {
+    SyntheticChannel params = { raw, 0.0f, 0.0f, 0.0f, 0.0f };
+    manager.getSource().getSignal().setChannel(channel, params);
+    for (uint16_t i = 0; i < 2000; i++) {
+      hostAdvanceMillis(5 * LOOP_INTERVAL);
+      loop();
+    }
+    return channel == 1 ? sample.measuredPollution : manager.readAllSensors().temperature;
+  }
+  
+  bool allTracking() const {
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      if (monitor.getStatus(i).phase != DRIFT_TRACKING) return false;
+    }
+    return true;
+  }
+};
+
+struct ScenarioResult {
+  float hoursToDetect;          // 从开始漂移到给出修正建议 (h)
+  uint8_t suspect;
+  uint8_t suggestions;
+  float estimated;              // 给出建议时的漂移估计（物理单位）
+  float expected;               // 注入漂移按相同时间常数平均后的值
+  uint8_t falseBeforeDrift;     // 注入漂移前给出的建议次数
+};
+
+// 基线完成后在 channel 注入漂移，直到给出修正建议（最多 maxHours）
+static ScenarioResult runScenario(Plant& plant, uint8_t channel, float countsPerHour, float maxHours) {
+  ScenarioResult result = ScenarioResult();
+  result.suspect = SENSOR_COUNT;
+  
+  // 回归模型训练与基线记录
+  while (!plant.allTracking()) plant.step();
+  result.falseBeforeDrift = plant.suggestions;
+  
+  plant.startDrift(channel, countsPerHour);
+  unsigned long driftStart = millis();
+  float perCount = CHANNEL_SPAN[channel] / 1023.0f;
+  
+  // 监测统计在基线完成时重新开始：参考值为注入漂移的指数加权平均
+  double expected = 0.0;
+  uint16_t samples = plant.monitor.getStatus(channel).samples;
+  while (plant.monitor.getSuspect() == SENSOR_COUNT && millis() - driftStart < maxHours * 3600000.0f) {
+    plant.step();
+    uint16_t now = plant.monitor.getStatus(channel).samples;
+    if (now == samples) continue;
+    double injected = countsPerHour * perCount * (millis() - driftStart) / 3600000.0;
+    expected = (now == 1) ? injected : expected + ALPHA * (injected - expected);
+    samples = now;
+  }
+  
+  result.hoursToDetect = (millis() - driftStart) / 3600000.0f;
+  result.suspect = plant.monitor.getSuspect();
+  result.suggestions = plant.suggestions - result.falseBeforeDrift;
+  result.estimated = plant.monitor.getStatus(channel).error;
+  result.expected = static_cast<float>(expected);
+  return result;
+}
+
+int main() {
+  // 污染物探头漂移：由其余通道的回归预测判定来源，估计值与注入漂移的平均值一致；
+  // 监测以融合前的测量值比较，快照中的融合值换成常数时结果完全相同
+  {
+    Plant plant;
+    CHECK(plant.begin());
+    ScenarioResult result = runScenario(plant, 1, 20.0f, 24.0f);
+    printf("污染物漂移 20 计数/h：%.1f h 后判定通道 %u，估计 %.2f ppm，注入漂移的平均值 %.2f ppm\n",
+           result.hoursToDetect, result.suspect, result.estimated, result.expected);
+    CHECK(result.falseBeforeDrift == 0);
+    CHECK(result.suspect == 1);
+    CHECK(result.suggestions == 1);
+    CHECK(plant.monitor.getStatus(1).exceeded);
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      if (i != 1) CHECK(!plant.monitor.getStatus(i).exceeded);
+    }
+    CHECK(fabs(result.estimated) > DRIFT_OFFSET_LIMIT * CHANNEL_SPAN[1]);
+    CHECK(fabs(result.estimated - result.expected) < 0.15f * result.expected);
+    // 刚超过阈值即判定：监测开始满一个时间常数后的第一次判断
+    CHECK(result.hoursToDetect < DRIFT_TIME_CONSTANT + 0.5f);
+    
+    // 漂移监测只使用融合前的测量值，与快照中的融合值无关
+    bool identical = plant.control.getSuspect() == plant.monitor.getSuspect();
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      const DriftStatus& a = plant.monitor.getStatus(i);
+      const DriftStatus& b = plant.control.getStatus(i);
+      identical &= a.phase == b.phase && a.error == b.error && a.offset == b.offset && a.gain == b.gain &&
+                   a.residualMean == b.residualMean && a.samples == b.samples && a.exceeded == b.exceeded;
+    }
+    CHECK(identical);
+    
+    // 继续漂移到超过单次修正上限的两倍，修正量按上限截断
+    float maxOffset = DRIFT_MAX_OFFSET_STEP * CHANNEL_SPAN[1];
+    while (plant.monitor.getStatus(1).error < 2.0f * maxOffset && plant.monitor.getSuspect() == 1) {
+      plant.step();
+    }
+    CHECK(plant.monitor.getSuspect() == 1);
+    
+    // 修正前后各在两个恒定原始值处读数，得到实际施加的换算：修正后 = (修正前 - 偏移) / 增益
+    const float raws[2] = { 300.0f, 700.0f };
+    DriftStatus drift = plant.monitor.getStatus(1);
+    float before[2];
+    float after[2];
+    for (uint8_t i = 0; i < 2; i++) before[i] = plant.settle(1, raws[i]);
+    CHECK(plant.monitor.applyCorrection(1, plant.manager));
+    for (uint8_t i = 0; i < 2; i++) after[i] = plant.settle(1, raws[i]);
+    float gain = (before[1] - before[0]) / (after[1] - after[0]);
+    float offset = before[0] - gain * after[0];
+    printf("修正：漂移 %.2f ppm（建议偏移 %.2f ppm、增益 %.4f），施加偏移 %.2f ppm、增益 %.4f（上限 %.2f ppm）\n",
+           drift.error, drift.offset, drift.gain, offset, gain, maxOffset);
+    // 冻结的回归参考变化不足，只估计偏移：整个量程上的修正量都按上限截断，方向与漂移一致
+    CHECK(drift.gain == 1.0f);
+    CHECK(drift.error > 2.0f * maxOffset);
+    CHECK_NEAR(gain, 1.0, 1e-3);
+    CHECK_NEAR(offset, maxOffset, 0.002 * CHANNEL_SPAN[1]);
+    // 修正后该通道重新统计，不再作为漂移来源
+    CHECK(!plant.monitor.getStatus(1).exceeded);
+    CHECK(plant.monitor.getStatus(1).samples == 0);
+    CHECK(plant.monitor.getSuspect() == SENSOR_COUNT);
+  }
+  
+  // 温度探头漂移：不与其他通道相关，只估计偏移，判定为温度通道
+  {
+    Plant plant;
+    CHECK(plant.begin());
+    ScenarioResult result = runScenario(plant, 4, 10.0f, 24.0f);
+    printf("温度漂移 10 计数/h：%.1f h 后判定通道 %u，估计 %.2f °C，注入漂移的平均值 %.2f °C\n",
+           result.hoursToDetect, result.suspect, result.estimated, result.expected);
+    CHECK(result.falseBeforeDrift == 0);
+    CHECK(result.suspect == 4);
+    CHECK(result.suggestions == 1);
+    CHECK(fabs(result.estimated - result.expected) < 0.15f * result.expected);
+  }
+  
+  // 没有漂移：整个运行期间不给出建议
+  {
+    Plant plant;
+    CHECK(plant.begin());
+    for (uint32_t i = 0; i < 3 * DRIFT_TIME_CONSTANT * 360; i++) plant.step();
+    CHECK(plant.allTracking());
+    CHECK(plant.suggestions == 0);
+    float worst = 0.0f;
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+      worst = max(worst, fabs(plant.monitor.getStatus(i).error) / CHANNEL_SPAN[i]);
+    }
+    printf("无漂移：%.0f h 内最大漂移估计为量程的 %.2f%%\n", 3 * DRIFT_TIME_CONSTANT, 100.0f * worst);
+    CHECK(worst < 0.5f * DRIFT_OFFSET_LIMIT);
+  }
+  
+  return testResult("DriftMonitorTest");
+}
\ No newline at end of file
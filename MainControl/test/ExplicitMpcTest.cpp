@@ -0,0 +1,156 @@
+// 显式MPC：表格与当前在线求解器一致（格点与单元中心），设定值偏离线性化点的误差与在线求解的切换
+// 表格参数或求解器改变后用 make table 重新生成，本测试随之校验。
+#include "HostTest.h"
+#include "Control/ControlSystem.h"
+
+static uint32_t randomState = 521288629UL;
+
+// [0, 1) 内的随机数
+static float nextUniform() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return static_cast<float>(randomState % 1000000UL) / 1000000.0f;
+}
+
+// 在 setpoint 处线性化、由在线求解器求得的控制量（与 solvePoint 相同，设定值不同）
+static float solveAt(PredictiveController& solver, float setpoint, float baseRate, float steadyOutput,
+                     float previousOutput, float error) {
+  float a, b;
+  ExplicitController::reactorModel(baseRate, steadyOutput, setpoint, a, b);
+  solver.setModel(a, b, 0.0f);
+  float estimate = (1.0f - a) * setpoint - b * steadyOutput;
+  return solver.plan(setpoint + error, estimate, setpoint, previousOutput);
+}
+
+static SensorData sensorsAt(float pollution) {
+  SensorData sensors = SensorData();
+  sensors.flowRate = 50.0f;
+  sensors.pollutionLevel = pollution;
+  sensors.lightIntensity = 500.0f;
+  sensors.pH = 7.0f;
+  sensors.temperature = 25.0f;
+  return sensors;
+}
+
+int main() {
+  PredictiveController solver;
+  solver.setHorizon(MPC_HORIZON);
+  solver.setWeights(MPC_TRACKING_WEIGHT, MPC_MOVE_WEIGHT, MPC_ENERGY_WEIGHT);
+  solver.setLimits(0.0f, 100.0f, MPC_MAX_RATE);
+  ExplicitController table;
+  
+  // 格点上的查表结果即生成时的解，只差 0.01% 的量化；表格过期时在此失败
+  {
+    double worst = 0.0;
+    uint16_t count = 0;
+    for (uint8_t r = 0; r < ExplicitController::RATE_POINTS; r++) {
+      // 两端的格点在对数换算后可能略超出范围，向内收一点
+      float baseRate = ExplicitController::rateAt(r) *
+                       (r == 0 ? 1.00001f : (r + 1 == ExplicitController::RATE_POINTS ? 0.99999f : 1.0f));
+      for (uint8_t s = 0; s < ExplicitController::OUTPUT_POINTS; s++) {
+        for (uint8_t p = 0; p < ExplicitController::OUTPUT_POINTS; p++) {
+          for (uint8_t e = 0; e < ExplicitController::ERROR_POINTS; e++) {
+            float steadyOutput = ExplicitController::outputAt(s);
+            float previousOutput = ExplicitController::outputAt(p);
+            float error = ExplicitController::errorAt(e);
+            float output;
+            if (!table.compute(baseRate, steadyOutput, previousOutput, error, output)) continue;
+            float exact = ExplicitController::solvePoint(solver, baseRate, steadyOutput, previousOutput, error);
+            worst = max(worst, static_cast<double>(fabs(output - exact)));
+            count++;
+          }
+        }
+      }
+    }
+    printf("格点: %u 个，最大误差 %.4f%%\n", count, worst);
+    CHECK(count == ExplicitController::TABLE_SIZE);
+    CHECK(worst < 0.02);
+  }
+  
+  // 单元中心：多线性插值的误差（生成时为最大 6.1%）
+  {
+    float rmsError;
+    float maxError = ExplicitController::verifyTable(solver, rmsError);
+    printf("单元中心: 最大误差 %.2f%%，均方根 %.3f%%\n", maxError, rmsError);
+    CHECK(maxError < 6.5f);
+    CHECK(rmsError < 0.75f);
+  }
+  
+  // 设定值偏离 TARGET_POLLUTION 时，在 TARGET_POLLUTION 处线性化的解与在设定值处线性化的解之差
+  // 约与偏离量成正比（每 ppm 约 0.5%）；容差以内的附加误差远小于表格本身的插值误差
+  {
+    const float offsets[] = { -10.0f, -MPC_TABLE_TARGET_TOLERANCE, MPC_TABLE_TARGET_TOLERANCE, 8.0f, 20.0f };
+    for (uint8_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+      double worst = 0.0;
+      for (uint16_t k = 0; k < 2000; k++) {
+        float baseRate = MPC_TABLE_RATE_MIN * pow(MPC_TABLE_RATE_MAX / MPC_TABLE_RATE_MIN, nextUniform());
+        float steadyOutput = 100.0f * nextUniform();
+        float previousOutput = 100.0f * nextUniform();
+        float error = MPC_TABLE_ERROR_MIN + (MPC_TABLE_ERROR_MAX - MPC_TABLE_ERROR_MIN) * nextUniform();
+        float atTarget = solveAt(solver, TARGET_POLLUTION, baseRate, steadyOutput, previousOutput, error);
+        float atSetpoint = solveAt(solver, TARGET_POLLUTION + offsets[i], baseRate, steadyOutput, previousOutput, error);
+        worst = max(worst, static_cast<double>(fabs(atTarget - atSetpoint)));
+      }
+      printf("设定值 %+5.1f ppm: 线性化点不同造成的最大差别 %.2f%%\n", offsets[i], worst);
+      CHECK(worst < 0.6 * fabs(offsets[i]));
+      CHECK(worst > 0.3 * fabs(offsets[i]));
+    }
+  }
+  
+  // 控制系统：设定值在容差内查表，数字孪生给出的 90/108/120 ppm 改为在线求解
+  {
+    ControlSystem control;
+    control.initialize();
+    DigitalTwinData twin = DigitalTwinData();
+    const ExplicitController& explicitLaw = control.getExplicitController();
+    
+    twin.optimalSetpoint = TARGET_POLLUTION + 0.5f * MPC_TABLE_TARGET_TOLERANCE;
+    for (uint8_t k = 0; k < 5; k++) {
+      control.modelPredictiveControl(sensorsAt(150.0f), twin);
+    }
+    CHECK(explicitLaw.wasInTable());
+    CHECK(explicitLaw.getMissCount() == 0);
+    
+    const float setpoints[] = { 90.0f, 108.0f, 120.0f };
+    for (uint8_t i = 0; i < 3; i++) {
+      twin.optimalSetpoint = setpoints[i];
+      float output = control.modelPredictiveControl(sensorsAt(150.0f), twin);
+      CHECK(!explicitLaw.wasInTable());
+      CHECK(output >= 0.0f && output <= 100.0f);
+    }
+    CHECK(explicitLaw.getMissCount() == 3);
+    
+    twin.optimalSetpoint = TARGET_POLLUTION;
+    control.modelPredictiveControl(sensorsAt(150.0f), twin);
+    CHECK(explicitLaw.wasInTable());
+  }
+  
+  // 闭环：非线性反应器 dC/dt = -k0·(1 + 增益·u/100)·C + 负荷，负荷使稳态输出为 40%；
+  // 线性化所用的稳态输出逐周期收敛，浓度回到设定值且一直查表
+  {
+    ControlSystem control;
+    control.initialize();
+    DigitalTwinData twin = DigitalTwinData();
+    twin.optimalSetpoint = TARGET_POLLUTION;
+    const ExplicitController& explicitLaw = control.getExplicitController();
+    
+    const float baseRate = 0.1f * 1.1f * 1.05f;  // reactorBaseRate() 在 sensorsAt() 的流量与光照下
+    const float load = baseRate * (1.0f + MPC_STRESS_GAIN * 0.4f) * TARGET_POLLUTION;
+    const float step = CONTROL_INTERVAL / 1000.0f;
+    float concentration = 150.0f;
+    float output = 0.0f;
+    for (uint16_t k = 0; k < 600; k++) {
+      output = control.modelPredictiveControl(sensorsAt(concentration), twin);
+      control.executeControl(output);
+      float rate = baseRate * (1.0f + MPC_STRESS_GAIN * output / 100.0f);
+      concentration = concentration * exp(-rate * step) + load / rate * (1.0f - exp(-rate * step));
+    }
+    printf("闭环 60 s: 浓度 %.2f ppm，输出 %.2f%%，表外 %u 次\n", concentration, output, explicitLaw.getMissCount());
+    CHECK_NEAR(concentration, TARGET_POLLUTION, 0.5);
+    CHECK_NEAR(output, 40.0, 1.0);
+    CHECK(explicitLaw.getMissCount() == 0);
+  }
+  
+  return testResult("ExplicitMpcTest");
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+// Q16.16 / Q8.24 定点运算：与双精度结果比较的误差上限与饱和行为
+// 周期数只能在板上测量（串口命令 fixed bench）。
+#include "HostTest.h"
+#include "Utilities/FixedPoint.h"
+
+static const double LSB = 1.0 / 65536.0;          // Q16.16 的最小单位
+static const double SCALE_LSB = 1.0 / 16777216.0;  // Q8.24 的最小单位
+
+static uint32_t randomState = 2463534242UL;
+
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// [-range, range) 内的随机 Q16.16 值
+static Fix16 randomFix16(int32_t range) {
+  int64_t span = static_cast<int64_t>(range) << 17;
+  return Fix16::fromRaw(static_cast<int32_t>(static_cast<int64_t>(nextRandom() % span) - span / 2));
+}
+
+static double exact(Fix16 value) {
+  return static_cast<double>(value.raw()) * LSB;
+}
+
+int main() {
+  const int SAMPLES = 200000;
+  
+  // 由 float 常量构造：四舍五入，误差不超过半个LSB
+  {
+    double worst = 0.0;
+    for (int k = 0; k < SAMPLES; k++) {
+      float value = static_cast<float>(static_cast<int32_t>(nextRandom() % 6553600) - 3276800) / 100.0f;
+      worst = max(worst, fabs(exact(Fix16(value)) - value));
+    }
+    printf("float 构造：最大误差 %.3g LSB\n", worst / LSB);
+    CHECK(worst <= 0.5 * LSB);
+    CHECK(Fix16(-1.5f).raw() == -98304);
+    CHECK(Fix16(0.3f).raw() == 19661);
+  }
+  
+  // 乘法：结果四舍五入，误差不超过半个LSB
+  {
+    double worst = 0.0;
+    for (int k = 0; k < SAMPLES; k++) {
+      Fix16 a = randomFix16(180);
+      Fix16 b = randomFix16(180);
+      worst = max(worst, fabs(exact(a * b) - exact(a) * exact(b)));
+    }
+    printf("乘法：最大误差 %.3g LSB\n", worst / LSB);
+    CHECK(worst <= 0.5 * LSB);
+  }
+  
+  // 除法：向零截断，误差小于一个LSB
+  {
+    double worst = 0.0;
+    for (int k = 0; k < SAMPLES; k++) {
+      Fix16 a = randomFix16(1000);
+      Fix16 b = randomFix16(100);
+      if (absValue(b) < Fix16(0.5f)) continue;
+      worst = max(worst, fabs(exact(a / b) - exact(a) / exact(b)));
+    }
+    printf("除法：最大误差 %.3g LSB\n", worst / LSB);
+    CHECK(worst < LSB);
+  }
+  
+  // 乘 Q8.24 系数：系数量化误差 0.5 LSB(Q8.24)·|a| 加结果舍入 0.5 LSB
+  {
+    double worst = 0.0;
+    for (int k = 0; k < SAMPLES; k++) {
+      Fix16 a = randomFix16(32767);
+      float coefficient = static_cast<float>(nextRandom() % 2000000) / 1000000.0f - 1.0f;
+      double error = fabs(exact(a * Fix16Scale(coefficient)) - exact(a) * coefficient);
+      double bound = 0.5 * LSB + 0.5 * SCALE_LSB * fabs(exact(a));
+      worst = max(worst, error / bound);
+    }
+    printf("乘Q8.24系数：最大误差为上限的 %.3f 倍\n", worst);
+    CHECK(worst <= 1.0);
+  }
+  
+  // 整数比值：不经过浮点，向零截断
+  {
+    double worst = 0.0;
+    for (int k = 0; k < SAMPLES; k++) {
+      uint32_t numerator = nextRandom() % (1023UL * 32);  // 商不超过Q16.16的整数范围
+      uint16_t denominator = static_cast<uint16_t>(1 + nextRandom() % 64);
+      double expected = static_cast<double>(numerator) / denominator;
+      double error = expected - exact(Fix16::fromRatio(numerator, denominator));
+      CHECK(error >= 0.0);
+      worst = max(worst, error);
+    }
+    printf("整数比值：最大误差 %.3g LSB\n", worst / LSB);
+    CHECK(worst < LSB);
+    CHECK(Fix16::fromRatio(5, 0).raw() == 0);
+  }
+  
+  // 一阶低通 y += alpha * (x - y)：与同一 alpha 的双精度递推比较，ADC计数量级的输入
+  {
+    const Fix16 alpha(0.3f);
+    const double alphaExact = exact(alpha);
+    Fix16 y = Fix16::fromInt(512);
+    double reference = 512.0;
+    double worst = 0.0;
+    for (int k = 0; k < SAMPLES; k++) {
+      int16_t x = static_cast<int16_t>(400 + nextRandom() % 224);
+      y += alpha * (Fix16::fromInt(x) - y);
+      reference += alphaExact * (x - reference);
+      worst = max(worst, fabs(exact(y) - reference));
+    }
+    printf("低通滤波：最大累积误差 %.3g 计数\n", worst);
+    // 每步舍入误差不超过半个LSB，经 (1 - alpha) 衰减后累积不超过 0.5 LSB / alpha
+    CHECK(worst <= 0.5 * LSB / alphaExact);
+  }
+  
+  // 饱和
+  {
+    Fix16 large(30000.0f);
+    CHECK(large + large == Fix16::fromRaw(0x7FFFFFFFL));
+    CHECK(-large - large == Fix16::fromRaw(-0x7FFFFFFFL - 1));
+    CHECK(large * Fix16(2.0f) == Fix16::fromRaw(0x7FFFFFFFL));
+    CHECK(large * 2 == Fix16::fromRaw(0x7FFFFFFFL));
+    CHECK(large / Fix16() == Fix16::fromRaw(0x7FFFFFFFL));
+    CHECK(-large / Fix16() == Fix16::fromRaw(-0x7FFFFFFFL - 1));
+    CHECK(-Fix16::fromRaw(-0x7FFFFFFFL - 1) == Fix16::fromRaw(0x7FFFFFFFL));
+    CHECK(Fix16::fromInt(300) / 4 == Fix16(75.0f));
+    CHECK(Fix16(2.5f).toInt() == 3);
+    CHECK(Fix16(-2.25f).toInt() == -2);
+  }
+  
+  return testResult("FixedPointTest");
+}
\ No newline at end of file
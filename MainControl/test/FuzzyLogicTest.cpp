@@ -0,0 +1,165 @@
+// 模糊推理：每个控制模式的规则库上控制曲面插值与完整推理之差的上限，
+// 论域两端 0 与 100 的肩形隶属度，以及没有规则激活时取中间输出等级
+#include "HostTest.h"
+#include "Control/FuzzyRuleBases.h"
+
+static const uint8_t MODES = sizeof(FUZZY_RULE_BASES) / sizeof(FUZZY_RULE_BASES[0]);
+static const float GRID_STEP = 0.5f;    // 比较插值与完整推理的网格间距
+static const float SURFACE_TOLERANCE = 0.11f;  // Kp 倍数单位
+
+static const char* const MODE_NAMES[MODES] = { "节能", "标准", "高效", "冲击负荷", "维护" };
+
+// 窄隶属度函数在相邻中心之间留出空隙（如 12.5 处五个函数都为 0），输出等级为 1-5
+static const FuzzyLogicSystem::RuleBase GAPPED_BASE PROGMEM = {
+  { { 0.0f, 10.0f }, { 25.0f, 10.0f }, { 50.0f, 10.0f }, { 75.0f, 10.0f }, { 100.0f, 10.0f } },
+  { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f },
+  2,
+  {
+    { 0, 0, FUZZY_VERY_LOW, 1.0f }, { 4, 4, FUZZY_VERY_HIGH, 1.0f }
+  }
+};
+
+// 没有规则
+static const FuzzyLogicSystem::RuleBase EMPTY_BASE PROGMEM = {
+  { { 0.0f, 25.0f }, { 25.0f, 25.0f }, { 50.0f, 25.0f }, { 75.0f, 25.0f }, { 100.0f, 25.0f } },
+  { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f },
+  0,
+  {
+  }
+};
+
+// 规则库中输入为 (level1, level2) 的规则的输出单点值
+static float ruleOutput(const FuzzyLogicSystem::RuleBase& base, uint8_t level1, uint8_t level2) {
+  for (uint8_t i = 0; i < base.ruleCount; i++) {
+    if (base.rules[i].input1Level == level1 && base.rules[i].input2Level == level2) {
+      return base.outputLevels[base.rules[i].outputLevel];
+    }
+  }
+  return NAN;
+}
+
+// 隶属度是否只有 level 一项为 1
+static bool onlyMember(const float* values, uint8_t level) {
+  for (uint8_t i = 0; i < 5; i++) {
+    if (values[i] != (i == level ? 1.0f : 0.0f)) return false;
+  }
+  return true;
+}
+
+int main() {
+  FuzzyLogicSystem fuzzy;
+  
+  // 未设置规则库：推理与插值都为 0
+  {
+    CHECK(!fuzzy.initialize(nullptr));
+    CHECK(fuzzy.infer(30.0f, 70.0f) == 0.0f);
+    CHECK(fuzzy.evaluate(30.0f, 70.0f) == 0.0f);
+    fuzzy.calculateMembership(0.0f);
+    CHECK(onlyMember(fuzzy.getMembershipValues(), 5));
+  }
+  
+  // 每个规则库：网格上 |evaluate - infer| 的最大值不超过上限，曲面网格点上两者相同
+  {
+    for (uint8_t mode = 0; mode < MODES; mode++) {
+      CHECK(fuzzy.initialize(&FUZZY_RULE_BASES[mode]));
+      float worst = 0.0f;
+      float worstInput1 = 0.0f;
+      float worstInput2 = 0.0f;
+      double sumSquares = 0.0;
+      uint32_t points = 0;
+      for (float input1 = 0.0f; input1 <= 100.0f; input1 += GRID_STEP) {
+        for (float input2 = 0.0f; input2 <= 100.0f; input2 += GRID_STEP) {
+          float difference = fabs(fuzzy.evaluate(input1, input2) - fuzzy.infer(input1, input2));
+          sumSquares += difference * difference;
+          points++;
+          if (difference > worst) {
+            worst = difference;
+            worstInput1 = input1;
+            worstInput2 = input2;
+          }
+        }
+      }
+      
+      float nodeError = 0.0f;
+      for (uint8_t i = 0; i < FuzzyLogicSystem::SURFACE_POINTS; i++) {
+        for (uint8_t j = 0; j < FuzzyLogicSystem::SURFACE_POINTS; j++) {
+          float input1 = 100.0f * i / (FuzzyLogicSystem::SURFACE_POINTS - 1);
+          float input2 = 100.0f * j / (FuzzyLogicSystem::SURFACE_POINTS - 1);
+          nodeError = max(nodeError, fabs(fuzzy.evaluate(input1, input2) - fuzzy.infer(input1, input2)));
+        }
+      }
+      
+      printf("%-8s %u 个点：最大误差 %.4f（%.1f, %.1f），均方根 %.4f，网格点 %.1e\n", MODE_NAMES[mode],
+             points, worst, worstInput1, worstInput2, sqrt(sumSquares / points), nodeError);
+      CHECK(worst <= SURFACE_TOLERANCE);
+      CHECK(nodeError < 1e-5f);
+    }
+  }
+  
+  // 肩形：0 及以下只属于“很低”，100 及以上只属于“很高”；超出论域的输入与端点结果相同，
+  // 四个角上只有对应的一条规则激活，输出为该规则的单点值
+  {
+    for (uint8_t mode = 0; mode < MODES; mode++) {
+      const FuzzyLogicSystem::RuleBase& base = FUZZY_RULE_BASES[mode];
+      fuzzy.setRuleBase(&base);
+      
+      bool shoulders = true;
+      const float lowInputs[] = { -50.0f, -0.5f, 0.0f };
+      const float highInputs[] = { 100.0f, 100.5f, 150.0f };
+      for (uint8_t k = 0; k < 3; k++) {
+        fuzzy.calculateMembership(lowInputs[k]);
+        if (!onlyMember(fuzzy.getMembershipValues(), FUZZY_VERY_LOW)) shoulders = false;
+        fuzzy.calculateMembership(highInputs[k]);
+        if (!onlyMember(fuzzy.getMembershipValues(), FUZZY_VERY_HIGH)) shoulders = false;
+      }
+      CHECK(shoulders);
+      
+      uint16_t mismatches = 0;
+      for (float input = 0.0f; input <= 100.0f; input += 5.0f) {
+        if (fuzzy.infer(-20.0f, input) != fuzzy.infer(0.0f, input)) mismatches++;
+        if (fuzzy.infer(120.0f, input) != fuzzy.infer(100.0f, input)) mismatches++;
+        if (fuzzy.infer(input, -20.0f) != fuzzy.infer(input, 0.0f)) mismatches++;
+        if (fuzzy.infer(input, 120.0f) != fuzzy.infer(input, 100.0f)) mismatches++;
+        if (fuzzy.evaluate(-20.0f, input) != fuzzy.evaluate(0.0f, input)) mismatches++;
+        if (fuzzy.evaluate(input, 120.0f) != fuzzy.evaluate(input, 100.0f)) mismatches++;
+      }
+      CHECK(mismatches == 0);
+      
+      CHECK_NEAR(fuzzy.infer(0.0f, 0.0f), ruleOutput(base, FUZZY_VERY_LOW, FUZZY_VERY_LOW), 1e-6);
+      CHECK_NEAR(fuzzy.infer(0.0f, 100.0f), ruleOutput(base, FUZZY_VERY_LOW, FUZZY_VERY_HIGH), 1e-6);
+      CHECK_NEAR(fuzzy.infer(100.0f, 0.0f), ruleOutput(base, FUZZY_VERY_HIGH, FUZZY_VERY_LOW), 1e-6);
+      CHECK_NEAR(fuzzy.infer(100.0f, 100.0f), ruleOutput(base, FUZZY_VERY_HIGH, FUZZY_VERY_HIGH), 1e-6);
+      CHECK_NEAR(fuzzy.evaluate(0.0f, 0.0f), ruleOutput(base, FUZZY_VERY_LOW, FUZZY_VERY_LOW), 1e-6);
+      CHECK_NEAR(fuzzy.evaluate(100.0f, 100.0f), ruleOutput(base, FUZZY_VERY_HIGH, FUZZY_VERY_HIGH), 1e-6);
+    }
+  }
+  
+  // 没有规则激活：隶属度函数之间的空隙、只有不相关的规则、没有规则时都取中间等级
+  {
+    fuzzy.setRuleBase(&GAPPED_BASE);
+    const float middle = GAPPED_BASE.outputLevels[FUZZY_MEDIUM];
+    fuzzy.calculateMembership(12.5f);
+    CHECK(onlyMember(fuzzy.getMembershipValues(), 5));
+    CHECK(fuzzy.infer(12.5f, 0.0f) == middle);
+    CHECK(fuzzy.infer(50.0f, 50.0f) == middle);
+    CHECK(fuzzy.infer(0.0f, 100.0f) == middle);
+    CHECK(fuzzy.infer(0.0f, 0.0f) == GAPPED_BASE.outputLevels[FUZZY_VERY_LOW]);
+    CHECK(fuzzy.infer(100.0f, 100.0f) == GAPPED_BASE.outputLevels[FUZZY_VERY_HIGH]);
+    CHECK(fuzzy.evaluate(50.0f, 50.0f) == middle);
+    
+    const float none[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    CHECK(fuzzy.defuzzify(none) == middle);
+    
+    fuzzy.setRuleBase(&EMPTY_BASE);
+    float largest = 0.0f;
+    for (float input1 = 0.0f; input1 <= 100.0f; input1 += 2.5f) {
+      for (float input2 = 0.0f; input2 <= 100.0f; input2 += 2.5f) {
+        largest = max(largest, fabs(fuzzy.infer(input1, input2) - middle));
+        largest = max(largest, fabs(fuzzy.evaluate(input1, input2) - middle));
+      }
+    }
+    CHECK(largest == 0.0f);
+  }
+  
+  return testResult("FuzzyLogicTest");
+}
\ No newline at end of file
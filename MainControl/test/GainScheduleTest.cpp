@@ -0,0 +1,129 @@
+// 增益调度与控制律切换：闭环仿真中模式切换、浓度档位切换、复位与第一次计算时执行器的跳变
+#include "HostTest.h"
+#include "Control/ControlSystem.h"
+
+// 反应器 dC/dt = -k0·(1 + MPC_STRESS_GAIN·u/100)·C + 负荷，k0 = 0.1/s（流量与光照为 0）
+struct Reactor {
+  double concentration;
+  double load;
+  
+  void advance(double output, double seconds) {
+    const double step = 0.01;
+    for (long i = 0; i < lround(seconds / step); i++) {
+      concentration += step * (-0.1 * (1.0 + MPC_STRESS_GAIN * output / 100.0) * concentration + load);
+    }
+  }
+};
+
+struct Event {
+  double time;         // (s)
+  ControlMode mode;
+  bool reset;
+  const char* name;
+};
+
+// 下一周期起由PID控制
+static bool usesPID(ControlMode mode) {
+  return mode == STANDARD || mode == ENERGY_SAVING || mode == SHOCK_LOAD;
+}
+
+int main() {
+  // 负荷 18 ppm/s 时输出 40% 使浓度稳定在 100 ppm；65-110 s 与 215-235 s 负荷为 60 ppm/s，浓度升入中浓度档位。
+  // 负荷与模式不同时改变，切换后下一周期的变化只来自控制律本身
+  const Event events[] = {
+    {  30.0, ENERGY_SAVING,   false, "标准 -> 节能" },
+    {  60.0, SHOCK_LOAD,      false, "节能 -> 冲击负荷" },
+    {  90.0, HIGH_EFFICIENCY, false, "冲击负荷 -> 高效(MPC)" },
+    { 120.0, STANDARD,        false, "高效(MPC) -> 标准" },
+    { 150.0, MAINTENANCE,     false, "标准 -> 维护" },
+    { 170.0, STANDARD,        false, "维护 -> 标准" },
+    { 200.0, STANDARD,        true,  "复位" },
+  };
+  const uint8_t EVENT_COUNT = sizeof(events) / sizeof(events[0]);
+  
+  ControlSystem control;
+  control.initialize();
+  SystemModel model = SystemModel();
+  model.reactionRate = 0.1f;
+  model.degradation = 1.0f;
+  control.setReactorModel(model);
+  control.setControlMode(STANDARD);
+  
+  SensorData sensors = SensorData();
+  DigitalTwinData twin = DigitalTwinData();
+  twin.optimalSetpoint = TARGET_POLLUTION;
+  Reactor reactor = { TARGET_POLLUTION, 18.0 };
+  
+  // 第一次计算前执行器由其他来源置于 40%
+  control.executeControl(40.0f);
+  double previous = 40.0;
+  bool switched = true;
+  const char* switchName = "第一次计算";
+  uint8_t lastBand = 0xFF;
+  uint8_t next = 0;
+  double worstSwitch = 0.0;
+  double worstAfter = 0.0;
+  double worstOther = 0.0;
+  bool after = false;
+  
+  for (uint16_t k = 0; k < 3000; k++) {
+    double t = k * CONTROL_INTERVAL / 1000.0;
+    reactor.load = ((t >= 65.0 && t < 110.0) || (t >= 215.0 && t < 235.0)) ? 60.0 : 18.0;
+    if (next < EVENT_COUNT && t >= events[next].time) {
+      const Event& event = events[next++];
+      if (event.reset) {
+        control.reset();
+        previous = 0.0;  // 复位时执行器回到 0
+      } else {
+        control.setControlMode(event.mode);
+      }
+      switched = usesPID(event.mode);
+      switchName = event.name;
+    }
+    
+    // 控制周期有抖动
+    hostAdvanceMicros(CONTROL_INTERVAL * 1000UL + (k % 7) * 3000UL);
+    sensors.pollutionLevel = static_cast<float>(reactor.concentration);
+    double output = control.computeControl(sensors, twin);
+    control.executeControl(static_cast<float>(output));
+    double step = fabs(output - previous);
+    
+    uint8_t band = control.getScheduleBand();
+    bool pid = usesPID(control.getCurrentMode());
+    if (pid && !switched && lastBand != 0xFF && band != lastBand) {
+      switched = true;
+      switchName = "浓度档位";
+    }
+    if (pid) lastBand = band;
+    
+    if (switched) {
+      printf("t=%6.1f s %-24s 浓度 %6.1f ppm，输出 %5.1f -> %5.1f%%，", t, switchName, reactor.concentration,
+             previous, output);
+      worstSwitch = max(worstSwitch, step);
+      after = true;
+      switched = false;
+    } else if (after) {
+      printf("下一周期变化 %.2f%%\n", step);
+      worstAfter = max(worstAfter, step);
+      after = false;
+    } else if (pid) {
+      worstOther = max(worstOther, step);
+    }
+    
+    previous = output;
+    reactor.advance(output, CONTROL_INTERVAL / 1000.0);
+  }
+  
+  printf("切换时最大变化 %.2f%%，下一周期 %.2f%%，其余PID周期 %.2f%%；最终浓度 %.1f ppm\n",
+         worstSwitch, worstAfter, worstOther, reactor.concentration);
+  CHECK(next == EVENT_COUNT);
+  // 每次切换都从当前输出接续；下一周期只有PID对浓度变化的正常响应
+  // （复位后执行器为 0，浓度每周期上升约 0.8 ppm，输出相应变化约 0.9%）
+  CHECK(worstSwitch < 1.0);
+  CHECK(worstAfter < 1.0);
+  printf("无扰切换 %u 次\n", control.getTransferCount());
+  CHECK(control.getTransferCount() == 9);
+  CHECK_NEAR(reactor.concentration, TARGET_POLLUTION, 2.0);
+  
+  return testResult("GainScheduleTest");
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <Arduino.h>
+
+// 主机测试的断言：失败时打印位置并继续，main() 以 testResult() 作为返回值
+static int testFailures = 0;
+static int testChecks = 0;
+
+static inline bool testCheck(bool condition, const char* expression, const char* file, int line) {
+  testChecks++;
+  if (!condition) {
+    testFailures++;
+    printf("%s:%d: 失败: %s\n", file, line, expression);
+  }
+  return condition;
+}
+
+static inline bool testNear(double actual, double expected, double tolerance,
+                            const char* expression, const char* file, int line) {
+  testChecks++;
+  if (!(fabs(actual - expected) <= tolerance)) {
+    testFailures++;
+    printf("%s:%d: 失败: %s = %g，期望 %g ± %g\n", file, line, expression, actual, expected, tolerance);
+    return false;
+  }
+  return true;
+}
+
+static inline int testResult(const char* name) {
+  printf("%s: %d 项检查，%d 项失败\n", name, testChecks, testFailures);
+  return testFailures == 0 ? 0 : 1;
+}
+
+#define CHECK(condition) testCheck((condition), #condition, __FILE__, __LINE__)
+#define CHECK_NEAR(actual, expected, tolerance) \
+  testNear((actual), (expected), (tolerance), #actual, __FILE__, __LINE__)
+
+#endif // HOST_TEST_H
\ No newline at end of file
@@ -0,0 +1,22 @@
+// 显式MPC查找表的主机生成程序（make table），与串口命令 'mpc table' 输出相同的内容
+// 以 MPC_EXPLICIT=false 编译，不依赖现有的表格；以 CRLF 换行、末行不带换行，与仓库中的源文件一致
+#include <stdio.h>
+#include "Control/ExplicitController.h"
+
+static bool firstLine = true;
+
+static void writeLine(const String& line) {
+  if (!firstLine) fputs("\r\n", stdout);
+  fputs(line.c_str(), stdout);
+  firstLine = false;
+}
+
+int main() {
+  // 与 ControlSystem::initialize() 相同的MPC参数
+  PredictiveController solver;
+  solver.setHorizon(MPC_HORIZON);
+  solver.setWeights(MPC_TRACKING_WEIGHT, MPC_MOVE_WEIGHT, MPC_ENERGY_WEIGHT);
+  solver.setLimits(0.0f, 100.0f, MPC_MAX_RATE);
+  ExplicitController::generateTable(solver, writeLine);
+  return ferror(stdout) ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+// PIDControllerT<float> / PIDControllerT<Fix16>：与按实测间隔计算的双精度参考轨迹比较，
+// 覆盖抖动的计算间隔、超过 PID_MAX_INTERVAL 的停顿与 micros() 回绕
+#include <limits.h>
+#include "HostTest.h"
+#include "Control/PIDController.h"
+
+// micros() 的最大值：AVR上 unsigned long 为32位，主机上为64位，回绕的处理相同
+static const unsigned long MICROS_MAX = ULONG_MAX;
+
+// 与 PIDControllerT 相同的控制律（默认参数：积分限幅 ±1000，输出 0-100，微分滤波 0.3，抗饱和阈值 0.8）
+struct ReferencePID {
+  double Kp, Ki, Kd;
+  double integral;
+  double filtered;
+  double previousMeasurement;
+  double lastOutput;
+  unsigned long lastTime;
+  bool timeValid;
+  
+  ReferencePID(double p, double i, double d)
+    : Kp(p), Ki(i), Kd(d), integral(0.0), filtered(0.0), previousMeasurement(0.0),
+      lastOutput(0.0), lastTime(0), timeValid(false) {}
+  
+  double compute(double setpoint, double measurement, unsigned long now) {
+    double dt = CONTROL_INTERVAL / 1000.0;
+    bool derivativeValid = timeValid;
+    if (timeValid) {
+      unsigned long interval = now - lastTime;
+      if (interval < PID_MIN_INTERVAL) return lastOutput;
+      if (interval > PID_MAX_INTERVAL) {
+        interval = PID_MAX_INTERVAL;
+        derivativeValid = false;
+      }
+      dt = interval * 1e-6;
+    }
+    lastTime = now;
+    timeValid = true;
+    
+    double error = setpoint - measurement;
+    integral = fmax(-1000.0, fmin(1000.0, integral + Ki * error * dt));
+    if (derivativeValid) {
+      filtered = 0.3 * (measurement - previousMeasurement) / dt + 0.7 * filtered;
+    }
+    double output = Kp * error + integral - Kd * filtered;
+    if (fabs(output) > 80.0 && fabs(output) > 100.0) integral *= 0.95;
+    previousMeasurement = measurement;
+    lastOutput = fmax(0.0, fmin(100.0, output));
+    return lastOutput;
+  }
+};
+
+static uint32_t randomState = 2463534242UL;
+
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// 一阶对象 5·dy/dt = -y + 2·u，在间隔内细分积分
+static double plantStep(double y, double u, unsigned long interval) {
+  double h = interval * 1e-6 / 100.0;
+  for (uint8_t s = 0; s < 100; s++) {
+    y += h * (-y + 2.0 * u) / 5.0;
+  }
+  return y;
+}
+
+// 设定值 50，间隔在 60-140 ms 之间抖动，第 STALL 步停顿 3 s；
+// 两个闭环分别由被测控制器与参考控制器驱动，返回输出之差的最大值
+template<typename T>
+static double runTrajectory(const char* name, unsigned long start, double tolerance) {
+  const uint16_t STEPS = 3000;
+  const uint16_t STALL = 1500;
+  PIDControllerT<T> pid(T(1.0f), T(0.5f), T(0.05f));
+  ReferencePID reference(1.0, 0.5, 0.05);
+  
+  // 按固定控制周期计算的参考：说明实测间隔的必要性
+  ReferencePID nominal(1.0, 0.5, 0.05);
+  unsigned long nominalTime = start;
+  
+  randomState = 2463534242UL;
+  double y = 0.0;
+  double yReference = 0.0;
+  double yNominal = 0.0;
+  double worst = 0.0;
+  double nominalWorst = 0.0;
+  bool wrapped = false;
+  unsigned long now = start;
+  for (uint16_t k = 0; k < STEPS; k++) {
+    unsigned long interval = (k == STALL) ? 3000000UL : 60000UL + nextRandom() % 80001UL;
+    wrapped |= now + interval < now;
+    now += interval;
+    nominalTime += CONTROL_INTERVAL * 1000UL;
+    
+    double u = toFloat(pid.compute(T(50.0f), T(static_cast<float>(y)), now));
+    double uReference = reference.compute(50.0, yReference, now);
+    double uNominal = nominal.compute(50.0, yNominal, nominalTime);
+    worst = max(worst, fabs(u - uReference));
+    nominalWorst = max(nominalWorst, fabs(uNominal - uReference));
+    
+    y = plantStep(y, u, interval);
+    yReference = plantStep(yReference, uReference, interval);
+    yNominal = plantStep(yNominal, uNominal, interval);
+  }
+  CHECK(wrapped == (start > MICROS_MAX - 400000000UL));
+  printf("%-5s 起点 %20lu us%s: 与参考的最大输出差 %.2e%%，终值 %.3f/%.3f；按固定周期计算时最大差 %.2f%%\n",
+         name, start, wrapped ? "（回绕）" : "", worst, y, yReference, nominalWorst);
+  CHECK(worst < tolerance);
+  CHECK_NEAR(y, 50.0, 0.1);
+  CHECK_NEAR(y, yReference, tolerance);
+  CHECK(pid.getOverrunCount() == 1);
+  CHECK(nominalWorst > 10.0 * tolerance);
+  return worst;
+}
+
+template<typename T>
+static void checkTiming(const char* name) {
+  PIDControllerT<T> pid(T(1.0f), T(0.5f), T(0.05f));
+  
+  // 第一次计算按控制周期积分，不计算微分
+  T first = pid.compute(T(50.0f), T(0.0f), 1000000UL);
+  CHECK_NEAR(toFloat(pid.getLastInterval()), CONTROL_INTERVAL / 1000.0, 1e-4);
+  CHECK(toFloat(pid.getDerivativeTerm()) == 0.0f);
+  
+  // 间隔短于 PID_MIN_INTERVAL：不更新状态，返回上次输出
+  T integral = pid.getIntegralTerm();
+  CHECK(pid.compute(T(50.0f), T(10.0f), 1000000UL + PID_MIN_INTERVAL - 1) == first);
+  CHECK(pid.getIntegralTerm() == integral);
+  
+  // 跨越 micros() 回绕的间隔
+  pid.reset();
+  const unsigned long beforeWrap = MICROS_MAX - 20000UL;
+  pid.compute(T(50.0f), T(0.0f), beforeWrap);
+  CHECK_NEAR(toFloat(pid.elapsed(beforeWrap + 100000UL)), 0.1, 1e-4);
+  pid.compute(T(50.0f), T(0.0f), beforeWrap + 100000UL);
+  CHECK_NEAR(toFloat(pid.getLastInterval()), 0.1, 1e-4);
+  CHECK(pid.getOverrunCount() == 0);
+  
+  // 停顿：按 PID_MAX_INTERVAL 积分
+  CHECK_NEAR(toFloat(pid.elapsed(beforeWrap + 100000UL + 5000000UL)), PID_MAX_INTERVAL * 1e-6, 1e-4);
+  printf("%-5s 计时检查完成\n", name);
+}
+
+int main() {
+  checkTiming<float>("float");
+  checkTiming<Fix16>("Fix16");
+  
+  runTrajectory<float>("float", 0UL, 1e-3);
+  runTrajectory<Fix16>("Fix16", 0UL, 1e-2);
+  runTrajectory<float>("float", MICROS_MAX - 1000000UL, 1e-3);
+  runTrajectory<Fix16>("Fix16", MICROS_MAX - 1000000UL, 1e-2);
+  
+  return testResult("PIDControllerTest");
+}
\ No newline at end of file
@@ -0,0 +1,367 @@
+// 预测控制的在线二次规划：各预测时域下预计算与求解的主机耗时；随机参数点上与穷举有效集的双精度参考解比较
+// （含两段同时位于输出边界的退化顶点）；显式表格全部格点上有效集法的迭代次数不达到上限
+#include <time.h>
+#include "HostTest.h"
+#include "Control/ExplicitController.h"
+
+static const uint8_t BLOCKS = PredictiveController::BLOCKS;
+static const uint8_t CONSTRAINTS = PredictiveController::CONSTRAINTS;
+static const uint16_t MAX_HORIZON = 400;
+
+static uint32_t randomState = 2463534242UL;
+
+// [0, 1) 内的随机数
+static double nextUniform() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return static_cast<double>(randomState % 1000000UL) / 1000000.0;
+}
+
+// 一次 plan() 的参数
+struct Problem {
+  float a;
+  float b;
+  float measurement;
+  float estimate;
+  float reference;
+  float previousOutput;
+};
+
+// 参考问题：按时域逐步仿真得到 ½vᵀHv + fᵀv，与控制器的递推预计算无关
+struct ReferenceQP {
+  double hessian[BLOCKS][BLOCKS];
+  double linear[BLOCKS];
+  double lower[CONSTRAINTS];
+  double upper[CONSTRAINTS];
+};
+
+// 约束矩阵的第 i 行：各段输出，其后为相邻两段之差
+static double constraintValue(uint8_t row, const double v[BLOCKS]) {
+  if (row < BLOCKS) return v[row];
+  return v[row - BLOCKS + 1] - v[row - BLOCKS];
+}
+
+static void constraintCoefficients(uint8_t row, double coefficients[BLOCKS]) {
+  for (uint8_t j = 0; j < BLOCKS; j++) coefficients[j] = 0.0;
+  if (row < BLOCKS) {
+    coefficients[row] = 1.0;
+  } else {
+    coefficients[row - BLOCKS + 1] = 1.0;
+    coefficients[row - BLOCKS] = -1.0;
+  }
+}
+
+// 代价 Σ q·(y(k) - r)² + ρ·Σ(段间变化量)² + e·Σ u(k)，第一段的变化量相对上次输出
+static ReferenceQP buildReference(const PredictiveController& solver, const Problem& p) {
+  static double response[BLOCKS][MAX_HORIZON + 1];
+  static double freeResponse[MAX_HORIZON + 1];
+  ReferenceQP qp;
+  uint16_t horizon = solver.getHorizon();
+  
+  // 自由响应与各段单位输入的响应
+  double y = p.measurement;
+  double unit[BLOCKS] = { 0.0 };
+  uint16_t blockEnd[BLOCKS];
+  uint16_t end = 0;
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    end += solver.getBlockLength(j);
+    blockEnd[j] = end;
+  }
+  for (uint16_t k = 1; k <= horizon; k++) {
+    y = p.a * y + p.estimate;
+    freeResponse[k] = y;
+    for (uint8_t j = 0; j < BLOCKS; j++) {
+      bool inBlock = k - 1 < blockEnd[j] && (j == 0 || k - 1 >= blockEnd[j - 1]);
+      unit[j] = p.a * unit[j] + (inBlock ? p.b : 0.0);
+      response[j][k] = unit[j];
+    }
+  }
+  
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    qp.linear[j] = MPC_ENERGY_WEIGHT * solver.getBlockLength(j);
+    for (uint16_t k = 1; k <= horizon; k++) {
+      qp.linear[j] += 2.0 * MPC_TRACKING_WEIGHT * response[j][k] * (freeResponse[k] - p.reference);
+    }
+    for (uint8_t l = 0; l < BLOCKS; l++) {
+      double sum = 0.0;
+      for (uint16_t k = 1; k <= horizon; k++) sum += response[j][k] * response[l][k];
+      qp.hessian[j][l] = 2.0 * MPC_TRACKING_WEIGHT * sum;
+    }
+  }
+  
+  // 变化量 (v0 - 上次输出)、(v1 - v0)、(v2 - v1) 的平方和
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    qp.hessian[j][j] += 2.0 * MPC_MOVE_WEIGHT * (j + 1 < BLOCKS ? 2.0 : 1.0);
+    if (j > 0) {
+      qp.hessian[j][j - 1] -= 2.0 * MPC_MOVE_WEIGHT;
+      qp.hessian[j - 1][j] -= 2.0 * MPC_MOVE_WEIGHT;
+    }
+  }
+  qp.linear[0] -= 2.0 * MPC_MOVE_WEIGHT * p.previousOutput;
+  
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    qp.lower[j] = 0.0;
+    qp.upper[j] = 100.0;
+  }
+  for (uint8_t i = BLOCKS; i < CONSTRAINTS; i++) {
+    qp.lower[i] = -MPC_MAX_RATE;
+    qp.upper[i] = MPC_MAX_RATE;
+  }
+  qp.lower[0] = max(qp.lower[0], p.previousOutput - MPC_MAX_RATE);
+  qp.upper[0] = min(qp.upper[0], p.previousOutput + MPC_MAX_RATE);
+  return qp;
+}
+
+static double cost(const ReferenceQP& qp, const double v[BLOCKS]) {
+  double value = 0.0;
+  for (uint8_t j = 0; j < BLOCKS; j++) {
+    value += qp.linear[j] * v[j];
+    for (uint8_t l = 0; l < BLOCKS; l++) value += 0.5 * v[j] * qp.hessian[j][l] * v[l];
+  }
+  return value;
+}
+
+// 选主元高斯消元，奇异时返回 false
+static bool solveLinear(double matrix[][BLOCKS + CONSTRAINTS + 1], uint8_t n, double x[]) {
+  for (uint8_t c = 0; c < n; c++) {
+    uint8_t pivot = c;
+    for (uint8_t r = c + 1; r < n; r++) {
+      if (fabs(matrix[r][c]) > fabs(matrix[pivot][c])) pivot = r;
+    }
+    if (fabs(matrix[pivot][c]) < 1e-9) return false;
+    for (uint8_t k = 0; k <= n; k++) {
+      double t = matrix[c][k];
+      matrix[c][k] = matrix[pivot][k];
+      matrix[pivot][k] = t;
+    }
+    for (uint8_t r = c + 1; r < n; r++) {
+      double factor = matrix[r][c] / matrix[c][c];
+      for (uint8_t k = c; k <= n; k++) matrix[r][k] -= factor * matrix[c][k];
+    }
+  }
+  for (int8_t r = n - 1; r >= 0; r--) {
+    double value = matrix[r][n];
+    for (uint8_t k = r + 1; k < n; k++) value -= matrix[r][k] * x[k];
+    x[r] = value / matrix[r][r];
+  }
+  return true;
+}
+
+// 穷举：每个约束取 不起作用/下界/上界，解等式约束下的最优点（KKT方程），
+// 可行点中代价最小的即为全局最优（凸问题的最优点是某个面上的等式约束最优点）
+static double bruteForce(const ReferenceQP& qp, double best[BLOCKS]) {
+  double bestCost = 1e300;
+  uint16_t combinations = 1;
+  for (uint8_t i = 0; i < CONSTRAINTS; i++) combinations *= 3;
+  
+  for (uint16_t mask = 0; mask < combinations; mask++) {
+    uint8_t rows[CONSTRAINTS];
+    double bounds[CONSTRAINTS];
+    uint8_t count = 0;
+    uint16_t code = mask;
+    for (uint8_t i = 0; i < CONSTRAINTS; i++, code /= 3) {
+      if (code % 3 == 0) continue;
+      rows[count] = i;
+      bounds[count] = (code % 3 == 1) ? qp.lower[i] : qp.upper[i];
+      count++;
+    }
+    if (count > BLOCKS) continue;
+    
+    // [H Gᵀ; G 0]·[v; λ] = [-f; 边界]
+    uint8_t n = BLOCKS + count;
+    double matrix[BLOCKS + CONSTRAINTS][BLOCKS + CONSTRAINTS + 1] = { { 0.0 } };
+    for (uint8_t j = 0; j < BLOCKS; j++) {
+      for (uint8_t l = 0; l < BLOCKS; l++) matrix[j][l] = qp.hessian[j][l];
+      matrix[j][n] = -qp.linear[j];
+    }
+    for (uint8_t r = 0; r < count; r++) {
+      double coefficients[BLOCKS];
+      constraintCoefficients(rows[r], coefficients);
+      for (uint8_t j = 0; j < BLOCKS; j++) {
+        matrix[BLOCKS + r][j] = coefficients[j];
+        matrix[j][BLOCKS + r] = coefficients[j];
+      }
+      matrix[BLOCKS + r][n] = bounds[r];
+    }
+    double x[BLOCKS + CONSTRAINTS];
+    if (!solveLinear(matrix, n, x)) continue;
+    
+    bool feasible = true;
+    for (uint8_t i = 0; i < CONSTRAINTS && feasible; i++) {
+      double value = constraintValue(i, x);
+      feasible = value >= qp.lower[i] - 1e-7 && value <= qp.upper[i] + 1e-7;
+    }
+    if (!feasible) continue;
+    double value = cost(qp, x);
+    if (value < bestCost) {
+      bestCost = value;
+      for (uint8_t j = 0; j < BLOCKS; j++) best[j] = x[j];
+    }
+  }
+  return bestCost;
+}
+
+static void configure(PredictiveController& solver, uint16_t horizon) {
+  solver.setHorizon(horizon);
+  solver.setWeights(MPC_TRACKING_WEIGHT, MPC_MOVE_WEIGHT, MPC_ENERGY_WEIGHT);
+  solver.setLimits(0.0f, 100.0f, MPC_MAX_RATE);
+}
+
+// 反应器模型在随机工况下线性化；部分点的上次输出位于边界且误差很大，使多段同时饱和
+static Problem randomProblem() {
+  Problem p;
+  float baseRate = MPC_TABLE_RATE_MIN * pow(MPC_TABLE_RATE_MAX / MPC_TABLE_RATE_MIN, nextUniform());
+  float steadyOutput = 100.0f * nextUniform();
+  p.reference = TARGET_POLLUTION + 40.0f * (nextUniform() - 0.5f);
+  ExplicitController::reactorModel(baseRate, steadyOutput, p.reference, p.a, p.b);
+  p.estimate = (1.0f - p.a) * p.reference - p.b * steadyOutput;
+  
+  double kind = nextUniform();
+  if (kind < 0.2) {
+    p.previousOutput = 100.0f;
+    p.measurement = p.reference + MPC_TABLE_ERROR_MAX * (0.5f + 0.5f * nextUniform());
+  } else if (kind < 0.4) {
+    p.previousOutput = 0.0f;
+    p.measurement = p.reference + MPC_TABLE_ERROR_MIN * (0.5f + 0.5f * nextUniform());
+  } else {
+    p.previousOutput = 100.0f * nextUniform();
+    p.measurement = p.reference + MPC_TABLE_ERROR_MIN + (MPC_TABLE_ERROR_MAX - MPC_TABLE_ERROR_MIN) * nextUniform();
+  }
+  return p;
+}
+
+int main() {
+  // 耗时：预计算随时域线性增长，求解与时域无关（主机上的相对关系，板上数值由 'mpc bench' 给出）
+  {
+    static const uint16_t horizons[] = { 10, 25, 50, 100, 200, 400 };
+    static const uint8_t COUNT = sizeof(horizons) / sizeof(horizons[0]);
+    static const uint16_t REPEAT = 20000;
+    static const uint8_t TRIALS = 5;
+    double prepareTime[COUNT];
+    double solveTime[COUNT];
+    volatile float sink = 0.0f;
+    for (uint8_t i = 0; i < COUNT; i++) {
+      PredictiveController solver;
+      configure(solver, horizons[i]);
+      float a[2];
+      float b[2];
+      ExplicitController::reactorModel(0.05f, 40.0f, TARGET_POLLUTION, a[0], b[0]);
+      ExplicitController::reactorModel(0.06f, 40.0f, TARGET_POLLUTION, a[1], b[1]);
+      float estimate = (1.0f - a[0]) * TARGET_POLLUTION - b[0] * 40.0f;
+      
+      // 每个量取多次测量的最小值，减小主机上其他负载的影响
+      double withPrepare = 1e30;
+      double solveOnly = 1e30;
+      for (uint8_t t = 0; t < TRIALS; t++) {
+        // 模型交替变化，每次 plan 都先重新预计算
+        clock_t started = clock();
+        for (uint16_t k = 0; k < REPEAT; k++) {
+          solver.setModel(a[k & 1], b[k & 1], 0.0f);
+          sink = solver.plan(TARGET_POLLUTION + (k % 50), estimate, TARGET_POLLUTION, 40.0f);
+        }
+        withPrepare = min(withPrepare, static_cast<double>(clock() - started) / CLOCKS_PER_SEC / REPEAT);
+        
+        started = clock();
+        for (uint16_t k = 0; k < REPEAT; k++) {
+          sink = solver.plan(TARGET_POLLUTION + (k % 50), estimate, TARGET_POLLUTION, 40.0f);
+        }
+        solveOnly = min(solveOnly, static_cast<double>(clock() - started) / CLOCKS_PER_SEC / REPEAT);
+      }
+      prepareTime[i] = max(withPrepare - solveOnly, 0.0) * 1e6;
+      solveTime[i] = solveOnly * 1e6;
+      printf("N=%3u：分块 %u/%u/%u，预计算 %.3f us，求解 %.3f us\n", horizons[i], solver.getBlockLength(0),
+             solver.getBlockLength(1), solver.getBlockLength(2), prepareTime[i], solveTime[i]);
+    }
+    (void)sink;
+    CHECK(prepareTime[COUNT - 1] > 4.0 * prepareTime[0]);
+    CHECK(solveTime[COUNT - 1] < 3.0 * solveTime[0]);
+  }
+  
+  // 随机参数点：与穷举的参考解一致，迭代次数不达到上限
+  {
+    static const uint16_t horizons[] = { 10, 25, 50, 100, 200, 400 };
+    static const uint16_t POINTS = 3000;
+    double worst = 0.0;
+    double worstViolation = 0.0;
+    uint16_t degenerate = 0;
+    uint16_t constrained = 0;
+    uint8_t maxIterations = 0;
+    uint16_t atLimit = 0;
+    for (uint8_t h = 0; h < sizeof(horizons) / sizeof(horizons[0]); h++) {
+      // 同一个求解器连续求解，与控制器一样从上一次的解与工作集热启动
+      PredictiveController solver;
+      configure(solver, horizons[h]);
+      for (uint16_t k = 0; k < POINTS / 6; k++) {
+        Problem p = randomProblem();
+        solver.setModel(p.a, p.b, 0.0f);
+        float output = solver.plan(p.measurement, p.estimate, p.reference, p.previousOutput);
+        maxIterations = max(maxIterations, solver.getLastIterations());
+        if (solver.getLastIterations() >= MPC_MAX_ITERATIONS) atLimit++;
+        
+        float planned[BLOCKS];
+        solver.getLastSolution(planned);
+        double v[BLOCKS];
+        for (uint8_t j = 0; j < BLOCKS; j++) v[j] = planned[j];
+        ReferenceQP qp = buildReference(solver, p);
+        double optimum[BLOCKS];
+        bruteForce(qp, optimum);
+        
+        for (uint8_t j = 0; j < BLOCKS; j++) worst = max(worst, fabs(v[j] - optimum[j]));
+        worst = max(worst, fabs(output - optimum[0]));
+        for (uint8_t i = 0; i < CONSTRAINTS; i++) {
+          double value = constraintValue(i, v);
+          worstViolation = max(worstViolation, max(qp.lower[i] - value, value - qp.upper[i]));
+        }
+        
+        // 最优解中至少两段位于输出边界
+        uint8_t saturated = 0;
+        for (uint8_t j = 0; j < BLOCKS; j++) {
+          if (optimum[j] <= qp.lower[j] + 1e-6 || optimum[j] >= qp.upper[j] - 1e-6) saturated++;
+        }
+        if (saturated >= 2) degenerate++;
+        if (solver.wasConstrained()) constrained++;
+      }
+    }
+    printf("随机参数点 %u 个（有约束起作用 %u 个，两段以上位于输出边界 %u 个）：与参考解最大相差 %.2e%%，"
+           "最大约束违反 %.2e%%，最多迭代 %u 次\n", POINTS, constrained, degenerate, worst, worstViolation, maxIterations);
+    CHECK(degenerate > POINTS / 10);
+    CHECK(worst < 1e-2);
+    CHECK(worstViolation < 1e-2);
+    CHECK(atLimit == 0);
+    CHECK(maxIterations < MPC_MAX_ITERATIONS);
+  }
+  
+  // 显式表格的全部格点（格点速率及其乘以 1+1e-5，按生成顺序连续求解）：
+  // 退化顶点上曾在有效集之间循环直到迭代上限
+  {
+    PredictiveController solver;
+    configure(solver, MPC_HORIZON);
+    const float scales[2] = { 1.0f, 1.00001f };
+    uint32_t solves = 0;
+    uint16_t atLimit = 0;
+    uint8_t maxIterations = 0;
+    for (uint8_t c = 0; c < 2; c++) {
+      for (uint8_t r = 0; r < ExplicitController::RATE_POINTS; r++) {
+        float baseRate = ExplicitController::rateAt(r) * scales[c];
+        for (uint8_t s = 0; s < ExplicitController::OUTPUT_POINTS; s++) {
+          for (uint8_t p = 0; p < ExplicitController::OUTPUT_POINTS; p++) {
+            for (uint8_t e = 0; e < ExplicitController::ERROR_POINTS; e++) {
+              ExplicitController::solvePoint(solver, baseRate, ExplicitController::outputAt(s),
+                                             ExplicitController::outputAt(p), ExplicitController::errorAt(e));
+              solves++;
+              maxIterations = max(maxIterations, solver.getLastIterations());
+              if (solver.getLastIterations() >= MPC_MAX_ITERATIONS) atLimit++;
+            }
+          }
+        }
+      }
+    }
+    printf("表格格点 %u 次求解：最多迭代 %u 次，达到上限 %u 次\n", solves, maxIterations, atLimit);
+    CHECK(solves == 2UL * ExplicitController::TABLE_SIZE);
+    CHECK(atLimit == 0);
+    CHECK(maxIterations < MPC_MAX_ITERATIONS);
+  }
+  
+  return testResult("PredictiveControllerTest");
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+// 继电反馈自整定：对一阶惯性加纯滞后过程仿真，临界增益与周期与解析值比较，以及各种中止条件
+#include "HostTest.h"
+#include "Control/RelayAutotuner.h"
+
+static const double PLANT_STEP = 0.01;       // 过程仿真步长 (s)
+static const unsigned long PERIOD_MS = 100;  // 控制周期
+static const uint16_t MAX_DELAY_STEPS = 4096;
+
+static uint32_t randomState = 2463534242UL;
+
+// [-0.5, 0.5) 均匀分布
+static double uniform() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState / 4294967296.0 - 0.5;
+}
+
+// 工作点附近的过程 τ·dy/dt = -(y - y0) - K·(u(t - L) - u0)：输出越高污染物越低（反向作用）
+struct Plant {
+  double gain;
+  double timeConstant;
+  double y0;
+  double u0;
+  double y;
+  double delayed[MAX_DELAY_STEPS];
+  uint16_t delaySteps;
+  uint16_t head;
+  
+  Plant(double K, double tau, double L, double y0, double u0)
+    : gain(K), timeConstant(tau), y0(y0), u0(u0), y(y0), head(0) {
+    delaySteps = static_cast<uint16_t>(lround(L / PLANT_STEP));
+    for (uint16_t i = 0; i < MAX_DELAY_STEPS; i++) delayed[i] = u0;
+  }
+  
+  void advance(double u, double seconds) {
+    long steps = lround(seconds / PLANT_STEP);
+    for (long i = 0; i < steps; i++) {
+      // delayed[head] 是 delaySteps 步之前写入的输出
+      double ud = u;
+      if (delaySteps > 0) {
+        ud = delayed[head];
+        delayed[head] = u;
+        head = (head + 1) % delaySteps;
+      }
+      y += PLANT_STEP / timeConstant * (-(y - y0) - gain * (ud - u0));
+    }
+  }
+};
+
+// K·e^(-Ls)/(τs+1) 的临界点：atan(ωτ) + ωL = π
+static void analyticUltimate(double K, double tau, double L, double& Ku, double& Pu) {
+  double low = 0.0;
+  double high = M_PI / L;
+  for (int i = 0; i < 100; i++) {
+    double w = 0.5 * (low + high);
+    if (atan(w * tau) + w * L < M_PI) low = w;
+    else high = w;
+  }
+  Ku = sqrt(1.0 + low * low * tau * tau) / K;
+  Pu = 2.0 * M_PI / low;
+}
+
+// 从稳态开始整定，读数叠加 ±noise/2 的均匀噪声
+static void checkProcess(double K, double tau, double L, double noise) {
+  double Ku, Pu;
+  analyticUltimate(K, tau, L, Ku, Pu);
+  
+  Plant plant(K, tau, L, 100.0, 40.0);
+  RelayAutotuner tuner;
+  unsigned long now = 0;
+  CHECK(tuner.start(100.0f, 40.0f, now));
+  while (tuner.isActive() && now < AUTOTUNE_TIMEOUT) {
+    float u = tuner.update(static_cast<float>(plant.y + noise * uniform()), now);
+    plant.advance(u, PERIOD_MS / 1000.0);
+    now += PERIOD_MS;
+  }
+  
+  printf("K=%.1f τ=%3.0f L=%2.0f 噪声 %.1f：%2u 个周期 %4lus，Ku %.3f/%.3f (%+.1f%%)，Pu %.1f/%.1f (%+.1f%%)，"
+         "模型 K %.2f τ %.1f L %.1f\n",
+         K, tau, L, noise, tuner.getCycleCount(), now / 1000, tuner.getUltimateGain(), Ku,
+         100.0 * (tuner.getUltimateGain() / Ku - 1.0), tuner.getUltimatePeriod(), Pu,
+         100.0 * (tuner.getUltimatePeriod() / Pu - 1.0),
+         tuner.getProcessGain(), tuner.getTimeConstant(), tuner.getDeadTime());
+  CHECK(tuner.getState() == RelayAutotuner::AUTOTUNE_DONE);
+  CHECK(tuner.hasModel());
+  // 峰值时刻按控制周期量化，噪声使切换时刻与极值抖动
+  CHECK_NEAR(tuner.getUltimateGain(), Ku, 0.08 * Ku);
+  CHECK_NEAR(tuner.getUltimatePeriod(), Pu, 0.05 * Pu);
+  CHECK_NEAR(tuner.getDeadTime(), L, 0.1 * L + PERIOD_MS / 1000.0);
+  
+  float Kp, Ki, Kd;
+  tuner.getParameters(Kp, Ki, Kd);
+  CHECK_NEAR(Kp, 0.6 * tuner.getUltimateGain(), 1e-4);
+  CHECK_NEAR(Ki * tuner.getUltimatePeriod(), 1.2 * tuner.getUltimateGain(), 1e-3);
+}
+
+int main() {
+  // 滞后与惯性之比从 0.15 到 0.25，读数噪声为滞回的一半
+  checkProcess(2.0, 20.0, 3.0, 0.0);
+  checkProcess(2.0, 20.0, 3.0, 0.5);
+  checkProcess(1.0, 60.0, 10.0, 0.5);
+  checkProcess(3.0, 10.0, 2.0, 0.5);
+  checkProcess(0.5, 120.0, 30.0, 0.5);
+  checkProcess(0.5, 120.0, 30.0, 0.0);
+  
+  // 继电器围绕启动时的输出切换，偏置限制在 [幅值, 100 - 幅值]
+  {
+    RelayAutotuner tuner;
+    CHECK(tuner.start(100.0f, 5.0f, 0));
+    CHECK(!tuner.start(100.0f, 50.0f, 0));
+    CHECK_NEAR(tuner.update(110.0f, 100), 2.0 * AUTOTUNE_RELAY_AMPLITUDE, 1e-4);
+    CHECK_NEAR(tuner.update(90.0f, 200), 0.0, 1e-4);
+    tuner.abort();
+    CHECK(tuner.getFault() == RelayAutotuner::AUTOTUNE_FAULT_ABORTED);
+  }
+  
+  // 污染物失控：偏离设定值超过限制时中止，输出回到偏置
+  {
+    RelayAutotuner tuner;
+    tuner.start(100.0f, 50.0f, 0);
+    float u = 0.0f;
+    for (int i = 0; i < 5; i++) u = tuner.update(100.0f + 50.0f * i, i * PERIOD_MS);
+    CHECK(tuner.getState() == RelayAutotuner::AUTOTUNE_FAILED);
+    CHECK(tuner.getFault() == RelayAutotuner::AUTOTUNE_FAULT_DEVIATION);
+    CHECK_NEAR(u, 50.0, 1e-4);
+  }
+  
+  // 读数始终在滞回带内：继电器不切换，超时中止
+  {
+    RelayAutotuner tuner;
+    tuner.start(100.0f, 50.0f, 0);
+    unsigned long now = 0;
+    while (tuner.isActive() && now <= 2 * AUTOTUNE_TIMEOUT) {
+      tuner.update(100.5f, now);
+      now += PERIOD_MS;
+    }
+    CHECK(tuner.getFault() == RelayAutotuner::AUTOTUNE_FAULT_TIMEOUT);
+    CHECK(tuner.getCycleCount() == 0);
+    CHECK(now > AUTOTUNE_TIMEOUT && now <= AUTOTUNE_TIMEOUT + 2 * PERIOD_MS);
+  }
+  
+  // 幅值交替变化，相邻周期始终不一致：超过最大周期数后中止
+  {
+    RelayAutotuner tuner;
+    tuner.start(100.0f, 50.0f, 0);
+    unsigned long now = 0;
+    for (int cycle = 0; cycle < 2 * AUTOTUNE_MAX_CYCLES && tuner.isActive(); cycle++) {
+      float swing = (cycle % 2) ? 5.0f : 10.0f;
+      for (int i = 0; i < 40 && tuner.isActive(); i++, now += PERIOD_MS) {
+        tuner.update(100.0f + swing * static_cast<float>(sin(2.0 * M_PI * i / 40.0)), now);
+      }
+    }
+    CHECK(tuner.getFault() == RelayAutotuner::AUTOTUNE_FAULT_UNSTABLE);
+    CHECK(tuner.getCycleCount() == AUTOTUNE_MAX_CYCLES + 1);
+  }
+  
+  return testResult("RelayAutotunerTest");
+}
\ No newline at end of file
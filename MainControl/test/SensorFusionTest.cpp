@@ -0,0 +1,347 @@
+// 污染物融合滤波器：与双精度时变卡尔曼滤波比较稳态增益，噪声配置变化时重新求解，置信度与方差的关系；
+// 故障补偿的递推最小二乘回归：系数辨识、无激励时协方差有界、故障通道的替代
+#include "HostTest.h"
+#include "Sensors/SensorFusion.h"
+
+static const double PROCESS_NOISE = 0.1;      // 与 SensorFusion 的默认值相同 (ppm²)
+static const double MEASUREMENT_NOISE = 0.5;
+
+static uint32_t randomState = 2891336453UL;
+
+// 标准正态分布（Box-Muller）
+static double gaussian() {
+  double u[2];
+  for (uint8_t i = 0; i < 2; i++) {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    u[i] = (randomState + 1.0) / 4294967297.0;
+  }
+  return sqrt(-2.0 * log(u[0])) * cos(2.0 * M_PI * u[1]);
+}
+
+// 双精度参考：匀速模型，只有直接测量，每一步都重新计算增益
+struct ReferenceFilter {
+  double x[2];
+  double P[2][2];
+  
+  void initialize(double z, double r) {
+    x[0] = z;
+    x[1] = 0.0;
+    P[0][0] = r;
+    P[0][1] = P[1][0] = 0.0;
+    P[1][1] = r;
+  }
+  
+  // r <= 0 表示没有可用观测
+  void step(double z, double r) {
+    const double q = PROCESS_NOISE;
+    x[0] += x[1];
+    double p00 = P[0][0] + 2.0 * P[0][1] + P[1][1] + q / 4.0;
+    double p01 = P[0][1] + P[1][1] + q / 2.0;
+    double p11 = P[1][1] + q;
+    if (r > 0.0) {
+      double k0 = p00 / (p00 + r);
+      double k1 = p01 / (p00 + r);
+      double innovation = z - x[0];
+      x[0] += k0 * innovation;
+      x[1] += k1 * innovation;
+      p11 -= k1 * p01;
+      p01 -= k0 * p01;
+      p00 -= k0 * p00;
+    }
+    P[0][0] = p00;
+    P[0][1] = P[1][0] = p01;
+    P[1][1] = p11;
+  }
+};
+
+static SensorData healthySensors() {
+  SensorData sensors = SensorData();
+  sensors.flowRate = 50.0f;
+  sensors.lightIntensity = 500.0f;
+  sensors.pH = 7.0f;
+  sensors.temperature = 25.0f;
+  for (uint8_t i = 0; i < 5; i++) {
+    sensors.dataQuality[i] = 1.0f;
+  }
+  return sensors;
+}
+
+// 满质量时观测噪声为 MEASUREMENT_NOISE，质量按 1/8 量化后噪声按比例放大
+static double directNoise(float quality) {
+  return MEASUREMENT_NOISE * 8.0 / lround(quality * 8.0f);
+}
+
+// 污染物与协变量的线性关系（ppm），回归在各通道归一化的 [0, 1] 区间内辨识
+static const double POLLUTION_OFFSET = 40.0;
+static const double POLLUTION_PER_UNIT[4] = { 1.5, 0.08, 6.0, -0.8 };  // 每单位流量、光照、pH、温度
+
+static double pollutionFor(const SensorData& sensors) {
+  return POLLUTION_OFFSET + POLLUTION_PER_UNIT[0] * sensors.flowRate + POLLUTION_PER_UNIT[1] * sensors.lightIntensity +
+         POLLUTION_PER_UNIT[2] * sensors.pH + POLLUTION_PER_UNIT[3] * sensors.temperature;
+}
+
+// 协变量在量程内随机取值，污染物叠加 1 ppm 的测量噪声
+static void randomSensors(SensorData& sensors) {
+  sensors.flowRate = static_cast<float>(50.0 + 15.0 * gaussian());
+  sensors.lightIntensity = static_cast<float>(500.0 + 150.0 * gaussian());
+  sensors.pH = static_cast<float>(7.0 + 1.0 * gaussian());
+  sensors.temperature = static_cast<float>(25.0 + 5.0 * gaussian());
+  sensors.pollutionLevel = static_cast<float>(pollutionFor(sensors) + gaussian());
+}
+
+int main() {
+  SensorFusion fusion;
+  ReferenceFilter reference = ReferenceFilter();
+  SensorData sensors = healthySensors();
+  
+  // 阶段：满质量 -> 质量降为 0.5 -> 直接测量故障 -> 恢复满质量
+  struct Phase { uint16_t samples; float quality; bool faulty; const char* name; };
+  const Phase phases[] = {
+    { 400, 1.0f, false, "满质量" },
+    { 400, 0.5f, false, "质量 0.5" },
+    {  20, 1.0f, true,  "故障" },
+    { 400, 1.0f, false, "恢复" },
+  };
+  
+  double truth = 200.0;
+  uint16_t k = 0;
+  for (uint8_t p = 0; p < sizeof(phases) / sizeof(phases[0]); p++) {
+    const Phase& phase = phases[p];
+    sensors.dataQuality[1] = phase.quality;
+    sensors.sensorFaults[1] = phase.faulty;
+    double r = phase.faulty ? 0.0 : directNoise(phase.quality);
+    
+    double worst = 0.0;
+    uint16_t frozenAt = 0;
+    double previousVariance = fusion.getFusionVariance();
+    for (uint16_t i = 0; i < phase.samples; i++, k++) {
+      truth += 0.05;
+      double z = truth + sqrt(MEASUREMENT_NOISE) * gaussian();
+      sensors.pollutionLevel = static_cast<float>(z);
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      
+      float fused = fusion.fuseSensorData(sensors);
+      // 与 SensorFusion 相同：首个样本初始化后在同一次调用中完成预测与更新
+      if (k == 0) reference.initialize(z, r);
+      reference.step(z, r);
+      worst = max(worst, fabs(fused - reference.x[0]));
+      if (fusion.isSteadyState() && frozenAt == 0) frozenAt = i + 1;
+      
+      // 置信度由估计方差换算：单次满质量测量的方差对应 0.5
+      CHECK_NEAR(fusion.getFusionConfidence(),
+                 MEASUREMENT_NOISE / (MEASUREMENT_NOISE + fusion.getFusionVariance()), 1e-6);
+      
+      // 噪声配置改变的第一个样本重新求解增益
+      if (i == 0 && p > 0) CHECK(!fusion.isSteadyState());
+      
+      // 没有观测时方差只增不减
+      if (phase.faulty) CHECK(fusion.getFusionVariance() > previousVariance);
+      previousVariance = fusion.getFusionVariance();
+    }
+    
+    printf("%-12s 第 %3u 个样本冻结增益，与时变滤波最大差 %.2e ppm，方差 %.4f/%.4f，置信度 %.3f\n",
+           phase.name, frozenAt, worst, fusion.getFusionVariance(), reference.P[0][0],
+           fusion.getFusionConfidence());
+    if (phase.faulty) {
+      CHECK(!fusion.isSteadyState());
+      CHECK(fusion.getFusionConfidence() < 0.5f);
+      CHECK_NEAR(fusion.getFusionVariance(), reference.P[0][0], 1e-3 * reference.P[0][0]);
+    } else {
+      // 冻结的增益与收敛后的时变增益一致：估计与方差都与参考相同
+      CHECK(frozenAt > 0 && frozenAt < 100);
+      CHECK(fusion.isSteadyState());
+      CHECK(worst < 0.01);
+      CHECK_NEAR(fusion.getFusionVariance(), reference.P[0][0], 5e-3 * reference.P[0][0]);
+    }
+  }
+  
+  // 方差越大置信度越低：质量 0.5 时的稳态方差大于满质量
+  {
+    SensorFusion full;
+    SensorFusion half;
+    SensorData a = healthySensors();
+    SensorData b = healthySensors();
+    b.dataQuality[1] = 0.5f;
+    for (uint16_t i = 0; i < 200; i++) {
+      a.pollutionLevel = b.pollutionLevel = 150.0f;
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      full.fuseSensorData(a);
+      half.fuseSensorData(b);
+    }
+    CHECK(half.getFusionVariance() > full.getFusionVariance());
+    CHECK(half.getFusionConfidence() < full.getFusionConfidence());
+  }
+  
+  // 同一采样周期内的重复调用不推进滤波器
+  {
+    SensorFusion repeated;
+    SensorData s = healthySensors();
+    s.pollutionLevel = 100.0f;
+    hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+    repeated.fuseSensorData(s);
+    float variance = repeated.getFusionVariance();
+    s.pollutionLevel = 300.0f;
+    CHECK_NEAR(repeated.fuseSensorData(s), 100.0, 1e-4);
+    CHECK(repeated.getFusionVariance() == variance);
+  }
+  
+  // 观测噪声按量化后的配置比较：同一质量等级内的波动不重新求解
+  {
+    SensorFusion quantized;
+    SensorData s = healthySensors();
+    s.pollutionLevel = 100.0f;
+    for (uint16_t i = 0; i < 100; i++) {
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      quantized.fuseSensorData(s);
+    }
+    CHECK(quantized.isSteadyState());
+    const float jitter[] = { 0.97f, 1.0f, 0.94f, 0.99f };
+    for (uint8_t i = 0; i < 4; i++) {
+      s.dataQuality[1] = jitter[i];
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      quantized.fuseSensorData(s);
+      CHECK(quantized.isSteadyState());
+    }
+    s.dataQuality[1] = 0.9f;
+    hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+    quantized.fuseSensorData(s);
+    CHECK(!quantized.isSteadyState());
+  }
+  
+  // 回归观测投入后，残差方差在同一个2的幂区间内变化时增益保持冻结
+  {
+    SensorFusion regression;
+    SensorData s = healthySensors();
+    uint16_t resolves = 0;
+    bool wasSteady = false;
+    for (uint16_t i = 0; i < 1500; i++) {
+      // 协变量缓慢变化：既能训练回归，浓度的变化也符合匀速模型
+      s.flowRate = static_cast<float>(50.0 + 20.0 * sin(2.0 * M_PI * i / 200.0));
+      s.lightIntensity = static_cast<float>(500.0 + 100.0 * cos(2.0 * M_PI * i / 300.0));
+      s.pollutionLevel = static_cast<float>(100.0 + 2.0 * (s.flowRate - 50.0f) + 0.1 * (s.lightIntensity - 500.0f) +
+                                            gaussian());
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      regression.compensateFaults(s);
+      regression.fuseSensorData(s);
+      // 前 1000 个样本用于训练回归与残差方差收敛
+      if (i >= 1000 && wasSteady && !regression.isSteadyState()) resolves++;
+      wasSteady = regression.isSteadyState();
+    }
+    printf("回归观测投入后 500 个样本中重新求解增益 %u 次，方差 %.3f\n", resolves, regression.getFusionVariance());
+    CHECK(regression.isRegressionReady(1));
+    CHECK(resolves <= 2);
+    // 两个观测融合后方差低于只有直接测量时
+    CHECK(regression.getFusionVariance() < 0.28f);
+  }
+  
+  // 噪声参数修改后重新收敛
+  {
+    SensorFusion tuned;
+    SensorData s = healthySensors();
+    s.pollutionLevel = 100.0f;
+    for (uint16_t i = 0; i < 200; i++) {
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      tuned.fuseSensorData(s);
+    }
+    float before = tuned.getFusionVariance();
+    CHECK(tuned.isSteadyState());
+    tuned.setFusionNoise(PROCESS_NOISE, 4.0f * MEASUREMENT_NOISE);
+    CHECK(!tuned.isSteadyState());
+    for (uint16_t i = 0; i < 200; i++) {
+      hostAdvanceMillis(POLLUTION_SAMPLE_PERIOD);
+      tuned.fuseSensorData(s);
+    }
+    CHECK(tuned.isSteadyState());
+    CHECK(tuned.getFusionVariance() > before);
+  }
+  
+  // 回归辨识：全部通道正常时轮流训练，污染物目标的系数收敛到已知的线性关系
+  {
+    SensorFusion rls;
+    SensorData s = healthySensors();
+    for (uint16_t i = 0; i < 5000; i++) {
+      randomSensors(s);
+      rls.compensateFaults(s);
+    }
+    CHECK(rls.isRegressionReady(1));
+    
+    // 归一化系数：预测量依次为流量、光照、pH、温度与常数项
+    const double span[4] = { FLOW_MAX - FLOW_MIN, LIGHT_MAX - LIGHT_MIN, PH_MAX - PH_MIN, TEMP_MAX - TEMP_MIN };
+    const double pollutionSpan = POLLUTION_MAX - POLLUTION_MIN;
+    double expected[5];
+    for (uint8_t i = 0; i < 4; i++) {
+      expected[i] = POLLUTION_PER_UNIT[i] * span[i] / pollutionSpan;
+    }
+    expected[4] = POLLUTION_OFFSET / pollutionSpan;
+    
+    float weights[5];
+    CHECK(rls.getRegressionWeights(1, weights));
+    double worstWeight = 0.0;
+    for (uint8_t i = 0; i < 5; i++) {
+      worstWeight = max(worstWeight, fabs(weights[i] - expected[i]));
+    }
+    
+    // 新数据上的估计误差接近测量噪声
+    double sumSq = 0.0;
+    for (uint16_t i = 0; i < 200; i++) {
+      randomSensors(s);
+      double error = rls.estimateByRegression(s, 1) - pollutionFor(s);
+      sumSq += error * error;
+    }
+    double rms = sqrt(sumSq / 200.0);
+    float excitedTrace = rls.getRegressionTrace(1);
+    printf("回归系数最大误差 %.2e（归一化），估计均方根误差 %.3f ppm，协方差的迹 %.3f\n", worstWeight, rms,
+           excitedTrace);
+    CHECK(worstWeight < 0.01);
+    CHECK(rms < 0.5);
+    
+    // 无激励：协变量恒定时停止遗忘，迹不超过上限的一个遗忘步
+    double peakTrace = 0.0;
+    for (uint16_t i = 0; i < 20000; i++) {
+      s = healthySensors();
+      s.pollutionLevel = static_cast<float>(pollutionFor(s));
+      rls.compensateFaults(s);
+      peakTrace = max(peakTrace, static_cast<double>(rls.getRegressionTrace(1)));
+    }
+    double errorConstant = fabs(rls.estimateByRegression(s, 1) - pollutionFor(s));
+    printf("恒定输入 20000 次后协方差的迹最大 %.1f，工作点估计误差 %.3f ppm\n", peakTrace, errorConstant);
+    CHECK(peakTrace > 100.0);
+    CHECK(peakTrace < 1000.0 / 0.998 + 1.0);
+    CHECK(errorConstant < 0.5);
+    
+    // 激励恢复后迹重新下降，系数仍然正确
+    for (uint16_t i = 0; i < 2000; i++) {
+      randomSensors(s);
+      rls.compensateFaults(s);
+    }
+    CHECK(rls.getRegressionTrace(1) < 2.0f * excitedTrace);
+    CHECK(rls.getRegressionWeights(1, weights));
+    for (uint8_t i = 0; i < 5; i++) {
+      CHECK_NEAR(weights[i], expected[i], 0.01);
+    }
+    
+    // 污染物通道故障：读数由回归估计替代，故障标志保留
+    randomSensors(s);
+    double truth = pollutionFor(s);
+    s.pollutionLevel = 0.0f;
+    s.sensorFaults[1] = true;
+    rls.compensateFaults(s);
+    printf("故障通道替代值 %.2f ppm，实际 %.2f ppm\n", s.pollutionLevel, truth);
+    CHECK_NEAR(s.pollutionLevel, truth, 1.0);
+    CHECK(s.sensorFaults[1]);
+    
+    // 模型训练完成前保持最近一次正常读数
+    SensorFusion untrained;
+    SensorData u = healthySensors();
+    u.pollutionLevel = 123.0f;
+    untrained.compensateFaults(u);
+    u.pollutionLevel = 0.0f;
+    u.sensorFaults[1] = true;
+    untrained.compensateFaults(u);
+    CHECK_NEAR(u.pollutionLevel, 123.0, 1e-4);
+  }
+  
+  return testResult("SensorFusionTest");
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+// 传感器处理链 readAllSensors → compensateFaults → fuseSensorData 的主机运行
+// 以 SENSOR_SOURCE_TRACE 编译时回放记录文件（默认 data/plant_trace.csv，可由第一个参数指定），
+// 以 SENSOR_SOURCE_SYNTHETIC 编译时运行合成数据。时钟按主循环周期推进，不等待真实时间。
+// 回放也以 SENSOR_FIXED_POINT 编译一份（FixedTraceReplayTest），定点处理链须满足相同的误差要求。
+#include <time.h>
+#include "HostTest.h"
+#include "Sensors/SensorManager.h"
+#include "Sensors/SensorFusion.h"
+
+static const unsigned long LOOP_INTERVAL = 10;       // 主循环周期 (ms)
+
+struct PipelineStats {
+  uint32_t updates;
+  float minPollution;
+  float maxPollution;
+  float maxFusionError;         // 融合值与污染物读数之差的最大值 (ppm)
+  uint32_t checksum;            // 全部融合值的哈希，用于比较两次运行
+  SensorData last;
+};
+
+// 与主循环 acquireSensorData() 的顺序相同
+static PipelineStats runPipeline(SensorManager& manager, SensorFusion& fusion, unsigned long durationMs) {
+  PipelineStats stats;
+  stats.updates = 0;
+  stats.minPollution = 1e9f;
+  stats.maxPollution = -1e9f;
+  stats.maxFusionError = 0.0f;
+  stats.checksum = 2166136261UL;
+  
+  unsigned long end = millis() + durationMs;
+  while (millis() < end) {
+    hostAdvanceMillis(LOOP_INTERVAL);
+    if (!manager.update()) continue;
+    
+    SensorData sample = manager.readAllSensors();
+    SampleRateEvent event;
+    while (manager.pollSampleRateEvent(event)) {
+      if (event.sensorIndex == 1) {
+        fusion.setSamplePeriod(event.newPeriod);
+      }
+    }
+    float reading = sample.pollutionLevel;
+    fusion.compensateFaults(sample);
+    sample.pollutionLevel = fusion.fuseSensorData(sample);
+    
+    stats.updates++;
+    stats.minPollution = min(stats.minPollution, sample.pollutionLevel);
+    stats.maxPollution = max(stats.maxPollution, sample.pollutionLevel);
+    stats.maxFusionError = max(stats.maxFusionError, fabs(sample.pollutionLevel - reading));
+    uint32_t bits;
+    memcpy(&bits, &sample.pollutionLevel, sizeof(bits));
+    stats.checksum = (stats.checksum ^ bits) * 16777619UL;
+    stats.last = sample;
+  }
+  return stats;
+}
+
+static void printSpeed(const char* name, unsigned long simulatedMs, clock_t started) {
+  double seconds = static_cast<double>(clock() - started) / CLOCKS_PER_SEC;
+  printf("%s: 仿真 %.0f s，用时 %.1f ms（约为实时的 %.0f 倍）\n",
+         name, simulatedMs / 1000.0, seconds * 1000.0, simulatedMs / 1000.0 / max(seconds, 1e-6));
+}
+
+#if SENSOR_SOURCE == SENSOR_SOURCE_TRACE
+
+#if SENSOR_FIXED_POINT
+static const char* const TEST_NAME = "FixedTraceReplayTest";
+#else
+static const char* const TEST_NAME = "TraceReplayTest";
+#endif
+
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "data/plant_trace.csv";
+  
+  SensorManager manager;
+  SensorFusion fusion;
+  manager.getSource().getSignal().setTrace(path, TraceSignal::FORMAT_CSV, false);
+  if (!CHECK(manager.initialize())) {
+    printf("无法打开 %s\n", path);
+    return testResult(TEST_NAME);
+  }
+  fusion.initialize(manager.getSamplePeriod(1));
+  
+  // 记录前段：约200ppm 衰减到稳态约111ppm
+  clock_t started = clock();
+  PipelineStats early = runPipeline(manager, fusion, 290000UL);
+  CHECK(early.updates > 1000);
+  CHECK_NEAR(early.last.pollutionLevel, 111.0, 8.0);
+  CHECK(early.maxFusionError < 10.0f);
+  
+  // 300 s 起冲击负荷，120 s 内上升到300ppm以上，之后回落
+  PipelineStats shock = runPipeline(manager, fusion, 130000UL);
+  CHECK(shock.maxPollution > 290.0f);
+  CHECK_NEAR(shock.last.pollutionLevel, 325.0, 15.0);
+  
+  PipelineStats tail = runPipeline(manager, fusion, 200000UL);
+  CHECK(tail.minPollution < 130.0f);
+  CHECK(tail.maxPollution < 340.0f);
+  printSpeed(TEST_NAME, 620000UL, started);
+  
+  // 文件读完后保持最后一条记录
+  CHECK(manager.getSource().getSignal().isFinished());
+  CHECK(manager.getSource().getSignal().getRecordCount() == 3000);
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    CHECK(!tail.last.sensorFaults[i]);
+  }
+  CHECK_NEAR(tail.last.flowRate, 50.0, 8.0);
+  CHECK_NEAR(tail.last.pH, 7.0, 0.5);
+  CHECK_NEAR(tail.last.temperature, 25.5, 1.0);
+  
+  // 复位通道后，已处理过的批次不再被处理
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    manager.resetSensor(i);
+  }
+  CHECK(!manager.update());
+  
+  // 重新初始化清除数据源，批次序号从0重新计数：连续初始化两次，
+  // 温度通道在第一次初始化中只完成1批，第二次初始化的第1批不能被当作已处理
+  CHECK(manager.initialize());
+  CHECK(manager.initialize());
+  SensorData restarted = manager.readAllSensors();
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    CHECK(restarted.sampleAge[i] < 1000);
+  }
+  
+  return testResult(TEST_NAME);
+}
+
+#elif SENSOR_SOURCE == SENSOR_SOURCE_SYNTHETIC
+
+static PipelineStats runSynthetic(uint32_t seed, unsigned long durationMs, uint16_t& spikes) {
+  hostSetMicros(0);
+  SensorManager manager;
+  SensorFusion fusion;
+  manager.getSource().getSignal().setSeed(seed);
+  manager.initialize();
+  fusion.initialize(manager.getSamplePeriod(1));
+  PipelineStats stats = runPipeline(manager, fusion, durationMs);
+  spikes = manager.getSpikeCount(1);
+  return stats;
+}
+
+int main() {
+  const unsigned long duration = 3600000UL;
+  
+  // 默认工况：污染物基线约200ppm，慢速波动±40ppm，偶有毛刺（由Hampel滤波剔除）
+  uint16_t spikes = 0;
+  clock_t started = clock();
+  PipelineStats first = runSynthetic(SYNTHETIC_SEED, duration, spikes);
+  printSpeed("SyntheticPipelineTest", duration, started);
+  CHECK(first.updates > 3000);
+  CHECK(first.minPollution > 130.0f);
+  CHECK(first.maxPollution < 280.0f);
+  CHECK(first.maxFusionError < 10.0f);
+  CHECK(spikes > 0);
+  
+  // 相同种子与时钟序列的结果逐位相同，不同种子不同
+  uint16_t repeatSpikes = 0;
+  PipelineStats repeat = runSynthetic(SYNTHETIC_SEED, duration, repeatSpikes);
+  CHECK(repeat.checksum == first.checksum);
+  CHECK(repeatSpikes == spikes);
+  PipelineStats other = runSynthetic(SYNTHETIC_SEED + 1, duration, repeatSpikes);
+  CHECK(other.checksum != first.checksum);
+  
+  return testResult("SyntheticPipelineTest");
+}
+
+#else
+#error "SensorPipelineTest 需要以 SENSOR_SOURCE_TRACE 或 SENSOR_SOURCE_SYNTHETIC 编译"
+#endif
\ No newline at end of file
@@ -0,0 +1,138 @@
+// 序号双缓冲快照：发布与读取、advance() 的去重，以及复制途中发生发布（模拟中断）时 read() 重新复制
+#include "HostTest.h"
+
+// 测试样本的复制赋值在两半之间调用钩子，模拟复制途中进入中断；
+// SnapshotBuffer 构造时以 memset 清零，该类型只是不满足平凡复制，清零仍然有效
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+#include "Utilities/SnapshotBuffer.h"
+#pragma GCC diagnostic pop
+
+static const uint8_t FIELDS = 8;
+
+static void (*midCopy)() = nullptr;
+static uint16_t copies = 0;
+
+// 一个完整的样本中所有字段相同
+struct Sample {
+  uint32_t fields[FIELDS];
+  
+  Sample& operator=(const Sample& other) {
+    copies++;
+    for (uint8_t i = 0; i < FIELDS / 2; i++) fields[i] = other.fields[i];
+    if (midCopy) midCopy();
+    for (uint8_t i = FIELDS / 2; i < FIELDS; i++) fields[i] = other.fields[i];
+    return *this;
+  }
+  
+  bool isConsistent() const {
+    for (uint8_t i = 1; i < FIELDS; i++) {
+      if (fields[i] != fields[0]) return false;
+    }
+    return true;
+  }
+};
+
+static SnapshotBuffer<Sample> buffer;
+static uint32_t nextValue = 1;
+static uint8_t pendingPublishes = 0;   // 下一次复制途中要发布的次数
+
+// 生产者：完整写入后发布
+static void produce() {
+  Sample& sample = buffer.edit();
+  for (uint8_t i = 0; i < FIELDS; i++) sample.fields[i] = nextValue;
+  nextValue++;
+  buffer.publish(millis());
+}
+
+// 钩子：只在第一次复制途中发布，重新复制时不再打断
+static void interruptPublish() {
+  while (pendingPublishes > 0) {
+    pendingPublishes--;
+    produce();
+  }
+}
+
+int main() {
+  // 尚未发布：全0，序号为0
+  {
+    Sample copy;
+    CHECK(buffer.read(copy) == 0);
+    CHECK(copy.fields[0] == 0 && copy.isConsistent());
+    uint32_t seen = 0;
+    CHECK(!buffer.advance(seen));
+  }
+  
+  // 正常发布与读取：复制一次，advance() 只在有新发布时返回 true
+  {
+    hostAdvanceMillis(10);
+    produce();
+    uint32_t seen = 0;
+    CHECK(buffer.advance(seen));
+    CHECK(!buffer.advance(seen));
+    CHECK(seen == 1);
+    CHECK(buffer.getTimestamp() == millis());
+    CHECK(buffer.latest().fields[0] == 1);
+    
+    Sample copy;
+    copies = 0;
+    CHECK(buffer.read(copy) == 1);
+    CHECK(copies == 1);
+    CHECK(copy.fields[0] == 1 && copy.isConsistent());
+  }
+  
+  // 复制途中发布一次：被复制的缓冲区没有被改写，但样本已过时，重新复制得到新样本
+  {
+    midCopy = interruptPublish;
+    pendingPublishes = 1;
+    Sample copy;
+    copies = 0;
+    uint32_t sequence = buffer.read(copy);
+    printf("复制途中发布 1 次：复制 %u 次，序号 %u，样本 %u\n", copies, sequence, copy.fields[0]);
+    CHECK(copies == 2);
+    CHECK(sequence == buffer.getSequence());
+    CHECK(copy.isConsistent());
+    CHECK(copy.fields[0] == buffer.latest().fields[0]);
+  }
+  
+  // 复制途中连续发布两次：第二次改写正在复制的缓冲区，第一次的复制前后两半不一致，
+  // 重新复制后得到完整的最新样本
+  {
+    pendingPublishes = 2;
+    Sample copy;
+    copies = 0;
+    uint32_t before = buffer.getSequence();
+    uint32_t sequence = buffer.read(copy);
+    printf("复制途中发布 2 次：复制 %u 次，序号 %u -> %u，样本 %u\n", copies, before, sequence, copy.fields[0]);
+    CHECK(copies == 2);
+    CHECK(sequence == before + 2);
+    CHECK(copy.isConsistent());
+    CHECK(copy.fields[0] == nextValue - 1);
+  }
+  
+  // 没有序号检查时会得到撕裂的样本（验证上面的场景确实打断了复制）
+  {
+    pendingPublishes = 2;
+    Sample torn;
+    torn = buffer.latest();
+    CHECK(!torn.isConsistent());
+    midCopy = nullptr;
+  }
+  
+  // 每次读取都被打断若干次：结果始终完整且与返回的序号一致
+  {
+    midCopy = interruptPublish;
+    uint16_t inconsistent = 0;
+    for (uint16_t i = 0; i < 1000; i++) {
+      pendingPublishes = i % 3;
+      Sample copy;
+      uint32_t sequence = buffer.read(copy);
+      // 第一次发布写入的值为1，序号与值一一对应
+      if (!copy.isConsistent() || copy.fields[0] != sequence) inconsistent++;
+    }
+    midCopy = nullptr;
+    CHECK(inconsistent == 0);
+  }
+  
+  return testResult("SnapshotBufferTest");
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+// 定点FFT与频谱特征：与双精度DFT的结果比较，以及采样周期改变时的重采样
+#include "HostTest.h"
+#include "Sensors/SpectrumAnalyzer.h"
+
+static const uint16_t N = SpectrumAnalyzer::FFT_SIZE;
+static const double SAMPLE_UNITS = 32.0;
+
+static uint32_t randomState = 88172645UL;
+
+// 标准正态分布（Box-Muller）
+static double gaussian() {
+  double u[2];
+  for (uint8_t i = 0; i < 2; i++) {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    u[i] = (randomState + 1.0) / 4294967297.0;
+  }
+  return sqrt(-2.0 * log(u[0])) * cos(2.0 * M_PI * u[1]);
+}
+
+// 定点FFT（输出为 DFT/N）与双精度DFT之差的最大模值 (LSB)
+template<uint16_t Size>
+static double fftError() {
+  FixedFFT<Size> fft;
+  double x[Size];
+  for (uint16_t n = 0; n < Size; n++) {
+    x[n] = 8000.0 * sin(2.0 * M_PI * 5 * n / Size) + 3000.0 * cos(2.0 * M_PI * 13 * n / Size) + 500.0 * gaussian();
+    fft.re[n] = static_cast<int16_t>(lround(x[n]));
+  }
+  fft.begin();
+  while (!fft.step(SPECTRUM_BUTTERFLIES_PER_PASS)) {}
+  
+  double worst = 0.0;
+  for (uint16_t k = 0; k < Size; k++) {
+    double re = 0.0;
+    double im = 0.0;
+    for (uint16_t n = 0; n < Size; n++) {
+      re += lround(x[n]) * cos(2.0 * M_PI * k * n / Size);
+      im -= lround(x[n]) * sin(2.0 * M_PI * k * n / Size);
+    }
+    worst = max(worst, hypot(re / Size - fft.re[k], im / Size - fft.im[k]));
+  }
+  printf("FFT N=%u: 与双精度DFT的最大误差 %.2f LSB\n", static_cast<unsigned>(Size), worst);
+  return worst;
+}
+
+// 双精度参考：与 SpectrumAnalyzer 相同的量化、去均值、Hann窗与频段划分
+struct ReferenceSpectrum {
+  uint16_t dominantBin;
+  double peakRatio;
+  double noiseRatio;
+  double acRms;
+  double noiseRms;
+};
+
+static ReferenceSpectrum referenceSpectrum(const double* readings) {
+  double x[N];
+  double mean = 0.0;
+  for (uint16_t n = 0; n < N; n++) {
+    x[n] = lround(readings[n] * SAMPLE_UNITS) / SAMPLE_UNITS;
+    mean += x[n] / N;
+  }
+  double energy[N / 2 + 1];
+  double total = 0.0;
+  double noise = 0.0;
+  ReferenceSpectrum result = { 1, 0.0, 0.0, 0.0, 0.0 };
+  for (uint16_t k = 1; k <= N / 2; k++) {
+    double re = 0.0;
+    double im = 0.0;
+    for (uint16_t n = 0; n < N; n++) {
+      double w = 0.5 - 0.5 * cos(2.0 * M_PI * n / N);
+      re += (x[n] - mean) * w * cos(2.0 * M_PI * k * n / N);
+      im -= (x[n] - mean) * w * sin(2.0 * M_PI * k * n / N);
+    }
+    double power = (re * re + im * im) / (static_cast<double>(N) * N);
+    energy[k] = (k < N / 2) ? 2.0 * power : power;
+    total += energy[k];
+    if (k >= N / 4) noise += energy[k];
+    if (energy[k] > energy[result.dominantBin]) result.dominantBin = k;
+  }
+  double peak = 0.0;
+  for (uint16_t k = result.dominantBin - 1; k <= result.dominantBin + 1 && k <= N / 2; k++) {
+    if (k > 0) peak += energy[k];
+  }
+  result.peakRatio = peak / total;
+  result.noiseRatio = noise / total;
+  result.acRms = sqrt(total / 0.375);
+  result.noiseRms = sqrt(noise / 0.375);
+  return result;
+}
+
+// 逐个送入读数，每个读数后运行一次 update()；帧完成时返回送入的读数个数
+static uint16_t feed(SpectrumAnalyzer& analyzer, const double* readings, uint16_t count, unsigned long periodMs) {
+  unsigned long previous = analyzer.getFeatures(0).timestamp;
+  for (uint16_t i = 0; i < count; i++) {
+    hostAdvanceMillis(periodMs);
+    analyzer.addSample(0, SensorValue(static_cast<float>(readings[i])), periodMs);
+    for (uint8_t pass = 0; pass < 40; pass++) {
+      analyzer.update();
+    }
+    if (analyzer.getFeatures(0).timestamp != previous) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+static void compareWithReference(const char* name, const double* readings) {
+  SpectrumAnalyzer analyzer;
+  CHECK(feed(analyzer, readings, N, 100) == N);
+  const SpectrumFeatures& f = analyzer.getFeatures(0);
+  ReferenceSpectrum ref = referenceSpectrum(readings);
+  printf("%-8s 主频 %2u/%2u，峰值占比 %.3f/%.3f，高频占比 %.3f/%.3f，交流 %.3f/%.3f，高频 %.3f/%.3f\n",
+         name, f.dominantBin, ref.dominantBin, f.peakRatio, ref.peakRatio, f.noiseRatio, ref.noiseRatio,
+         f.acRms, ref.acRms, f.noiseRms, ref.noiseRms);
+  CHECK(f.dominantBin == ref.dominantBin);
+  CHECK_NEAR(f.peakRatio, ref.peakRatio, 0.02);
+  CHECK_NEAR(f.noiseRatio, ref.noiseRatio, 0.02);
+  CHECK_NEAR(f.acRms, ref.acRms, 0.02 * ref.acRms + 0.02);
+  CHECK_NEAR(f.noiseRms, ref.noiseRms, 0.03 * ref.noiseRms + 0.02);
+}
+
+// 正弦波在时刻 t (ms) 的读数
+static double sineAt(double t, double periodMs) {
+  return 500.0 + 20.0 * sin(2.0 * M_PI * t / periodMs);
+}
+
+// 先以 fromPeriod 采样 before 个读数，再以 toPeriod 采样直到帧完成
+static void checkPeriodChange(unsigned long fromPeriod, unsigned long toPeriod, uint16_t before) {
+  const double SIGNAL_PERIOD = 1600.0;  // ms
+  SpectrumAnalyzer analyzer;
+  double readings[N];
+  double t = 0.0;
+  for (uint16_t i = 0; i < before; i++, t += fromPeriod) {
+    readings[i] = sineAt(t, SIGNAL_PERIOD);
+  }
+  CHECK(feed(analyzer, readings, before, fromPeriod) == 0);
+  
+  // 已缓存的时间跨度按新周期折算的样本数
+  t -= fromPeriod;
+  uint16_t carried = min(static_cast<uint16_t>((before - 1) * fromPeriod / toPeriod + 1), N);
+  double after[N];
+  for (uint16_t i = 0; i < N; i++) {
+    after[i] = sineAt(t + (i + 1) * static_cast<double>(toPeriod), SIGNAL_PERIOD);
+  }
+  uint16_t used = feed(analyzer, after, N, toPeriod);
+  printf("周期 %lu -> %lu ms：沿用 %u 个样本，再送入 %u 个后完成一帧\n", fromPeriod, toPeriod, carried, used);
+  CHECK(used == (carried >= N ? 1 : N - carried));
+  
+  // 帧按新周期解释：主频与连续以新周期采样的结果相同
+  const SpectrumFeatures& f = analyzer.getFeatures(0);
+  double expectedBin = N * static_cast<double>(toPeriod) / SIGNAL_PERIOD;
+  CHECK_NEAR(f.dominantBin, expectedBin, 0.5);
+  CHECK_NEAR(f.dominantFrequency, 1000.0 / SIGNAL_PERIOD, 1000.0 / (N * toPeriod));
+  CHECK(f.type == SPECTRUM_PERIODIC);
+  CHECK_NEAR(f.acRms, 20.0 / sqrt(2.0), 1.0);
+}
+
+int main() {
+  // 每级结果右移1位的舍入误差不超过半个LSB，log2(N) 级累积
+  CHECK(fftError<64>() < 0.5 * 6 + 0.5);
+  CHECK(fftError<128>() < 0.5 * 7 + 0.5);
+  CHECK(fftError<256>() < 0.5 * 8 + 0.5);
+  
+  double readings[N];
+  for (uint16_t n = 0; n < N; n++) readings[n] = 500.0 + 10.0 * sin(2.0 * M_PI * 8 * n / N) + 0.3 * gaussian();
+  compareWithReference("脉动", readings);
+  for (uint16_t n = 0; n < N; n++) readings[n] = 500.0 + 5.0 * gaussian();
+  compareWithReference("白噪声", readings);
+  for (uint16_t n = 0; n < N; n++) readings[n] = 500.0 + 0.5 * n + 0.2 * gaussian();
+  compareWithReference("漂移", readings);
+  for (uint16_t n = 0; n < N; n++) readings[n] = 500.0 + 30.0 * gaussian() + 4.0 * sin(2.0 * M_PI * 3 * n / N);
+  compareWithReference("强噪声", readings);
+  
+  // 帧未攒满时采样周期改变：已缓存的样本重采样后沿用，不重新开始
+  checkPeriodChange(100, 200, 40);
+  checkPeriodChange(200, 100, 20);
+  checkPeriodChange(100, 150, 63);
+  
+  return testResult("SpectrumAnalyzerTest");
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+// 毛刺剔除：排序网络（0-1原理与全排列）、截尾和，以及 SensorManager 中 Hampel 滤波的修复、计数与阶跃接受
+// 以 SENSOR_SOURCE_SYNTHETIC 编译，污染物通道的合成信号在每次转换前设定
+#include "HostTest.h"
+#include "Sensors/SensorManager.h"
+
+static const unsigned long LOOP_INTERVAL = 10;  // 主循环周期 (ms)
+
+// 插入排序作为参考
+template<typename T>
+static void referenceSort(T* v, uint8_t n) {
+  for (uint8_t i = 1; i < n; i++) {
+    T key = v[i];
+    int8_t j = i - 1;
+    while (j >= 0 && v[j] > key) {
+      v[j + 1] = v[j];
+      j--;
+    }
+    v[j + 1] = key;
+  }
+}
+
+template<uint8_t N, typename T>
+static bool isSorted(const T* v) {
+  for (uint8_t i = 1; i < N; i++) {
+    if (v[i - 1] > v[i]) return false;
+  }
+  return true;
+}
+
+// 0-1原理：比较网络能排序全部 2^N 个0-1序列，则能排序任意序列
+template<uint8_t N, typename T>
+static uint16_t checkZeroOne() {
+  uint16_t failures = 0;
+  for (uint16_t bits = 0; bits < (1U << N); bits++) {
+    T v[N];
+    for (uint8_t i = 0; i < N; i++) v[i] = (bits >> i) & 1;
+    SortingNetwork<N>::sort(v);
+    if (!isSorted<N>(v)) failures++;
+  }
+  return failures;
+}
+
+// 全排列（Heap 算法），并检查中值
+template<uint8_t N>
+static uint32_t checkPermutations(uint32_t& count) {
+  uint16_t base[N];
+  uint8_t c[N] = { 0 };
+  for (uint8_t i = 0; i < N; i++) base[i] = 100 + 37 * i;
+  uint32_t failures = 0;
+  count = 0;
+  uint8_t i = 0;
+  while (true) {
+    uint16_t v[N];
+    for (uint8_t j = 0; j < N; j++) v[j] = base[j];
+    count++;
+    uint16_t median = sortedMedian<N>(v);
+    if (!isSorted<N>(v) || median != 100 + 37 * (N / 2)) failures++;
+    
+    while (i < N && c[i] >= i) c[i++] = 0;
+    if (i >= N) break;
+    uint8_t swapWith = (i % 2 == 0) ? 0 : c[i];
+    uint16_t t = base[swapWith];
+    base[swapWith] = base[i];
+    base[i] = t;
+    c[i]++;
+    i = 0;
+  }
+  return failures;
+}
+
+static uint32_t randomState = 88172645UL;
+
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// 污染物通道的合成信号：恒定值，没有噪声与随机毛刺
+static void setPollution(SensorManager& manager, float raw) {
+  SyntheticChannel channel = { raw, 0.0f, 0.0f, 0.0f, 0.0f };
+  manager.getSource().getSignal().setChannel(1, channel);
+}
+
+// 以当前信号申请一批污染物转换，并推进到该批次处理完毕
+static void feedPollution(SensorManager& manager, float raw) {
+  setPollution(manager, raw);
+  AdcSnapshot snap;
+  manager.getSource().snapshot(1, snap);
+  uint32_t sequence = snap.sequence;
+  while (manager.getSource().snapshot(1, snap), snap.sequence == sequence) {
+    hostAdvanceMillis(LOOP_INTERVAL);
+    manager.update();
+  }
+  hostAdvanceMillis(LOOP_INTERVAL);
+  manager.update();
+}
+
+int main() {
+  // 排序网络：0-1原理覆盖全部输入，另以不同取值的全排列检查中值
+  {
+    uint16_t zeroOne5 = checkZeroOne<5, uint16_t>();
+    uint16_t zeroOne7 = checkZeroOne<7, uint16_t>();
+    uint16_t zeroOne9 = checkZeroOne<9, uint16_t>();
+    uint16_t zeroOneFloat = checkZeroOne<9, float>();
+    CHECK(zeroOne5 == 0);
+    CHECK(zeroOne7 == 0);
+    CHECK(zeroOne9 == 0);
+    CHECK(zeroOneFloat == 0);
+    
+    uint32_t count5, count7, count9;
+    CHECK(checkPermutations<5>(count5) == 0);
+    CHECK(checkPermutations<7>(count7) == 0);
+    CHECK(checkPermutations<9>(count9) == 0);
+    printf("0-1序列 %u/%u/%u 个，全排列 %u/%u/%u 个，均已排序\n", 1U << 5, 1U << 7, 1U << 9,
+           count5, count7, count9);
+    CHECK(count5 == 120 && count7 == 5040 && count9 == 362880);
+  }
+  
+  // 截尾和：与参考排序去掉两端后的和相同，含重复值与整个ADC量程
+  {
+    uint16_t failures = 0;
+    for (uint16_t trial = 0; trial < 10000; trial++) {
+      uint16_t v[9];
+      uint16_t reference[9];
+      uint16_t range = (trial % 2) ? 1024 : 4;
+      for (uint8_t i = 0; i < 9; i++) v[i] = reference[i] = nextRandom() % range;
+      referenceSort(reference, 9);
+      uint32_t expected = 0;
+      for (uint8_t i = 2; i < 7; i++) expected += reference[i];
+      if (trimmedSum<9, 2>(v) != expected) failures++;
+      
+      uint16_t w[5];
+      for (uint8_t i = 0; i < 5; i++) w[i] = reference[i];
+      uint32_t expected5 = reference[1] + reference[2] + reference[3];
+      if (trimmedSum<5, 1>(w) != expected5) failures++;
+    }
+    CHECK(failures == 0);
+    
+    // 两个毛刺被截去
+    uint16_t window[9] = { 512, 530, 0, 498, 1023, 505, 520, 515, 509 };
+    uint32_t trimmed = trimmedSum<9, 2>(window);
+    CHECK(trimmed == 505 + 509 + 512 + 515 + 520);
+  }
+  
+  // Hampel 滤波：孤立毛刺修复为中值并计数，不判为故障；真实阶跃在窗口过半后接受
+  {
+    SensorManager manager;
+    manager.getSource().getSignal().setSpikes(0.0f, 0.0f);
+    setPollution(manager, 400.0f);
+    CHECK(manager.initialize());
+    
+    for (uint8_t i = 0; i < 3 * HAMPEL_WINDOW_SIZE; i++) feedPollution(manager, 400.0f);
+    SensorData before = manager.readAllSensors();
+    uint16_t spikes = manager.getSpikeCount(1);
+    CHECK(!before.sensorFaults[1]);
+    
+    // 孤立毛刺：读数不变
+    feedPollution(manager, 700.0f);
+    SensorData spiked = manager.readAllSensors();
+    printf("毛刺：读数 %.2f -> %.2f ppm，毛刺计数 %u -> %u\n", before.pollutionLevel, spiked.pollutionLevel,
+           spikes, manager.getSpikeCount(1));
+    CHECK(manager.getSpikeCount(1) == spikes + 1);
+    CHECK_NEAR(spiked.pollutionLevel, before.pollutionLevel, 1e-3);
+    CHECK(!spiked.sensorFaults[1]);
+    for (uint8_t i = 0; i < 3 * HAMPEL_WINDOW_SIZE; i++) {
+      feedPollution(manager, 400.0f);
+      CHECK(!manager.readAllSensors().sensorFaults[1]);
+    }
+    CHECK(manager.getSpikeCount(1) == spikes + 1);
+    
+    // 阶跃（小于突变判定的30%）：前 HAMPEL_WINDOW_SIZE/2 个样本仍视为毛刺，之后被接受
+    spikes = manager.getSpikeCount(1);
+    float level = manager.readAllSensors().pollutionLevel;
+    for (uint8_t i = 0; i < HAMPEL_WINDOW_SIZE / 2; i++) {
+      feedPollution(manager, 480.0f);
+      CHECK_NEAR(manager.readAllSensors().pollutionLevel, level, 1e-3);
+    }
+    CHECK(manager.getSpikeCount(1) == spikes + HAMPEL_WINDOW_SIZE / 2);
+    feedPollution(manager, 480.0f);
+    float accepted = manager.readAllSensors().pollutionLevel;
+    CHECK(accepted > level);
+    CHECK(manager.getSpikeCount(1) == spikes + HAMPEL_WINDOW_SIZE / 2);
+    for (uint8_t i = 0; i < 10 * HAMPEL_WINDOW_SIZE; i++) {
+      feedPollution(manager, 480.0f);
+      CHECK(!manager.readAllSensors().sensorFaults[1]);
+    }
+    printf("阶跃：第 %u 个样本起接受，读数 %.2f -> %.2f ppm，稳定后 %.2f ppm\n", HAMPEL_WINDOW_SIZE / 2 + 1,
+           level, accepted, manager.readAllSensors().pollutionLevel);
+    CHECK(manager.getSpikeCount(1) == spikes + HAMPEL_WINDOW_SIZE / 2);
+    CHECK(manager.readAllSensors().pollutionLevel > accepted);
+  }
+  
+  return testResult("SpikeRejectionTest");
+}
\ No newline at end of file
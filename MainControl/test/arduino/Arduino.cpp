@@ -0,0 +1,133 @@
+#include "Arduino.h"
+#include "EEPROM.h"
+
+HardwareSerial Serial;
+EEPROMClass EEPROM;
+
+static unsigned long hostMicros = 0;
+static int analogValues[A7 + 1] = {0};
+static uint32_t randomState = 1;
+
+unsigned long millis() {
+  return hostMicros / 1000UL;
+}
+
+unsigned long micros() {
+  return hostMicros;
+}
+
+void delay(unsigned long ms) {
+  hostMicros += ms * 1000UL;
+}
+
+void delayMicroseconds(unsigned int us) {
+  hostMicros += us;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t) {
+  return LOW;
+}
+
+int analogRead(uint8_t pin) {
+  return pin <= A7 ? analogValues[pin] : 0;
+}
+
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh) {
+  return (value - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+}
+
+long random(long maxValue) {
+  if (maxValue <= 0) return 0;
+  // xorshift32，与板上的序列不同，但可复现
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return static_cast<long>(randomState % static_cast<unsigned long>(maxValue));
+}
+
+long random(long minValue, long maxValue) {
+  return minValue >= maxValue ? minValue : minValue + random(maxValue - minValue);
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) randomState = static_cast<uint32_t>(seed);
+}
+
+void hostSetMicros(unsigned long now) {
+  hostMicros = now;
+}
+
+void hostAdvanceMicros(unsigned long interval) {
+  hostMicros += interval;
+}
+
+void hostAdvanceMillis(unsigned long interval) {
+  hostMicros += interval * 1000UL;
+}
+
+void hostSetAnalog(uint8_t pin, int value) {
+  if (pin <= A7) analogValues[pin] = value;
+}
+
+void hostSerialEcho(bool enable) {
+  Serial.setEcho(enable);
+}
+
+// ========== String ==========
+
+static std::string formatInteger(unsigned long value, unsigned char base, bool negative) {
+  if (base < 2 || base > 16) base = DEC;
+  char buffer[8 * sizeof(unsigned long) + 2];
+  char* p = buffer + sizeof(buffer) - 1;
+  *p = '\0';
+  do {
+    *--p = "0123456789ABCDEF"[value % base];
+    value /= base;
+  } while (value > 0);
+  if (negative) *--p = '-';
+  return std::string(p);
+}
+
+String::String(int value, unsigned char base) : String(static_cast<long>(value), base) {}
+
+String::String(unsigned int value, unsigned char base) : String(static_cast<unsigned long>(value), base) {}
+
+String::String(long value, unsigned char base) {
+  // 与Arduino相同：只有十进制输出负号
+  if (value < 0 && base == DEC) {
+    text = formatInteger(0UL - static_cast<unsigned long>(value), base, true);
+  } else {
+    text = formatInteger(static_cast<unsigned long>(value), base, false);
+  }
+}
+
+String::String(unsigned long value, unsigned char base) : text(formatInteger(value, base, false)) {}
+
+String::String(double value, unsigned char decimals) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  text = buffer;
+}
+
+// ========== Serial ==========
+
+void HardwareSerial::flush() {
+  if (echo) fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+  if (echo && value != '\r') putchar(value);
+  return 1;
+}
+
+size_t HardwareSerial::print(const char* value) {
+  size_t length = strlen(value);
+  for (size_t i = 0; i < length; i++) {
+    write(static_cast<uint8_t>(value[i]));
+  }
+  return length;
+}
\ No newline at end of file
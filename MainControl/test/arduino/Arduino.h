@@ -0,0 +1,139 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// 主机测试用的Arduino接口替代，只提供 src/ 中与硬件无关的模块用到的部分
+// 时钟由测试程序推进（hostAdvanceMicros 等），与真实时间无关，仿真可快于实时运行；
+// delay() 只推进时钟。模拟输入由 hostSetAnalog() 设置，Serial 默认丢弃输出。
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LED_BUILTIN 13
+
+#define A0 54
+#define A1 55
+#define A2 56
+#define A3 57
+#define A4 58
+#define A5 59
+#define A6 60
+#define A7 61
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+
+#define DEC 10
+#define HEX 16
+
+// 程序存储器：主机上与普通内存相同
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(p) (*reinterpret_cast<const uint8_t*>(p))
+#define pgm_read_word(p) (*reinterpret_cast<const uint16_t*>(p))
+#define pgm_read_dword(p) (*reinterpret_cast<const uint32_t*>(p))
+#define pgm_read_float(p) (*reinterpret_cast<const float*>(p))
+#define memcpy_P memcpy
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define sq(x) ((x) * (x))
+
+#define noInterrupts()
+#define interrupts()
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh);
+long random(long maxValue);
+long random(long minValue, long maxValue);
+void randomSeed(unsigned long seed);
+
+// ========== 仅主机 ==========
+void hostSetMicros(unsigned long now);
+void hostAdvanceMicros(unsigned long interval);
+void hostAdvanceMillis(unsigned long interval);
+void hostSetAnalog(uint8_t pin, int value);
+void hostSerialEcho(bool enable);       // 将 Serial 输出写到标准输出
+
+class String {
+private:
+  std::string text;
+  
+public:
+  String(const char* value = "") : text(value != nullptr ? value : "") {}
+  String(char value) : text(1, value) {}
+  String(int value, unsigned char base = DEC);
+  String(unsigned int value, unsigned char base = DEC);
+  String(long value, unsigned char base = DEC);
+  String(unsigned long value, unsigned char base = DEC);
+  String(double value, unsigned char decimals = 2);
+  
+  unsigned int length() const { return static_cast<unsigned int>(text.size()); }
+  const char* c_str() const { return text.c_str(); }
+  char charAt(unsigned int index) const { return index < text.size() ? text[index] : 0; }
+  
+  String& operator+=(const String& other) { text += other.text; return *this; }
+  friend String operator+(const String& a, const String& b) { String result(a); result += b; return result; }
+  friend bool operator==(const String& a, const String& b) { return a.text == b.text; }
+  friend bool operator!=(const String& a, const String& b) { return a.text != b.text; }
+};
+
+class HardwareSerial {
+private:
+  bool echo;
+  
+public:
+  HardwareSerial() : echo(false) {}
+  
+  void begin(unsigned long) {}
+  void setEcho(bool enable) { echo = enable; }
+  int available() { return 0; }
+  int read() { return -1; }
+  void flush();
+  operator bool() const { return true; }
+  
+  size_t write(uint8_t value);
+  size_t print(const char* value);
+  size_t print(const String& value) { return print(value.c_str()); }
+  size_t print(char value) { return write(static_cast<uint8_t>(value)); }
+  size_t print(int value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned int value, int base = DEC) { return print(String(value, base)); }
+  size_t print(long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(double value, int decimals = 2) { return print(String(value, decimals)); }
+  
+  size_t println() { return print("\r\n"); }
+  template<typename T>
+  size_t println(const T& value) { return print(value) + println(); }
+  template<typename T>
+  size_t println(const T& value, int format) { return print(value, format) + println(); }
+};
+
+extern HardwareSerial Serial;
+
+#endif // ARDUINO_H
\ No newline at end of file
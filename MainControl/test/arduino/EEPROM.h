@@ -0,0 +1,42 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <Arduino.h>
+
+// 主机测试用的EEPROM：4KB内存，初始为擦除状态 (0xFF)
+class EEPROMClass {
+private:
+  uint8_t memory[4096];
+  
+public:
+  EEPROMClass() { clear(); }
+  
+  // 仅主机：恢复擦除状态
+  void clear() { memset(memory, 0xFF, sizeof(memory)); }
+  
+  uint16_t length() const { return sizeof(memory); }
+  uint8_t read(int address) const { return inRange(address, 1) ? memory[address] : 0xFF; }
+  void write(int address, uint8_t value) { if (inRange(address, 1)) memory[address] = value; }
+  void update(int address, uint8_t value) { write(address, value); }
+  
+  template<typename T>
+  T& get(int address, T& value) const {
+    if (inRange(address, sizeof(T))) memcpy(&value, memory + address, sizeof(T));
+    return value;
+  }
+  
+  template<typename T>
+  const T& put(int address, const T& value) {
+    if (inRange(address, sizeof(T))) memcpy(memory + address, &value, sizeof(T));
+    return value;
+  }
+  
+private:
+  bool inRange(int address, size_t size) const {
+    return address >= 0 && static_cast<size_t>(address) + size <= sizeof(memory);
+  }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_H
\ No newline at end of file
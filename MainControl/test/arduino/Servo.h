@@ -0,0 +1,23 @@
+#ifndef SERVO_H
+#define SERVO_H
+
+#include <Arduino.h>
+
+// 主机测试用的舵机：只记录最后写入的角度
+class Servo {
+private:
+  int8_t pin;
+  int angle;
+  
+public:
+  Servo() : pin(-1), angle(0) {}
+  
+  uint8_t attach(int newPin) { pin = static_cast<int8_t>(newPin); return 0; }
+  void detach() { pin = -1; }
+  bool attached() const { return pin >= 0; }
+  void write(int value) { angle = constrain(value, 0, 180); }
+  void writeMicroseconds(int value) { angle = map(value, 544, 2400, 0, 180); }
+  int read() const { return angle; }
+};
+
+#endif // SERVO_H
\ No newline at end of file